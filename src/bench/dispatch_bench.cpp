@@ -0,0 +1,159 @@
+// dispatch_bench.cpp — head → node task dispatch throughput over gRPC
+//
+// Starts in-process NodeService servers on localhost that accept every
+// task without running anything, registers them with a ClusterScheduler
+// backed by GrpcNodeClient, then submits independent tasks and waits for
+// every dispatch to be acknowledged. Repeats for several per-node windows
+// and batch sizes (max_batch 1 = one ExecuteTask-sized call per task). The
+// "blocking" row issues one synchronous ExecuteTask at a time, as the head
+// used to.
+//
+// `latency_us` makes each node hold every reply that long, standing in for
+// network round-trip time (loopback has next to none).
+//
+// Usage:  ./bench_dispatch [tasks] [nodes] [latency_us]   (default: 20000 2 0)
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <grpcpp/grpcpp.h>
+
+#include "distributed/generated/orion.grpc.pb.h"
+#include "distributed/cluster/node_registry.h"
+#include "distributed/cluster/cluster_scheduler.h"
+#include "distributed/rpc/grpc_node_client.h"
+
+using Clock = std::chrono::steady_clock;
+
+namespace {
+
+    // Accepts every task; measures the transport, not execution
+    class AcceptingNode final : public orion::NodeService::Service {
+    public:
+        explicit AcceptingNode(std::chrono::microseconds latency) : latency_(latency) {}
+
+        grpc::Status ExecuteTask(grpc::ServerContext*, const orion::TaskRequest*,
+                                 orion::TaskReply* reply) override {
+            if (latency_.count() > 0) std::this_thread::sleep_for(latency_);
+            reply->set_accepted(true);
+            return grpc::Status::OK;
+        }
+
+        grpc::Status ExecuteTasks(grpc::ServerContext*, const orion::TaskBatch*,
+                                  orion::TaskBatchReply*) override {
+            if (latency_.count() > 0) std::this_thread::sleep_for(latency_);
+            return grpc::Status::OK;
+        }
+
+        grpc::Status FreeObjects(grpc::ServerContext*, const orion::ObjectIdList*,
+                                 orion::Empty*) override {
+            return grpc::Status::OK;
+        }
+
+    private:
+        std::chrono::microseconds latency_;
+    };
+
+    struct LocalNode {
+        explicit LocalNode(std::chrono::microseconds latency) : service(latency) {}
+
+        AcceptingNode service;
+        std::unique_ptr<grpc::Server> server;
+        int port = 0;
+    };
+
+    double run(orion::distributed::NodeRegistry& registry, size_t window, size_t batch,
+               const std::vector<orion::ObjectId>& ids) {
+        orion::distributed::GrpcNodeClient client(registry, window);
+        orion::distributed::ClusterScheduler scheduler(registry, client, {.max_batch = batch});
+
+        auto t0 = Clock::now();
+        for (const auto& id : ids) {
+            orion::Task task;
+            task.id = id;
+            task.function_name = "noop";
+            scheduler.submit(std::move(task));
+        }
+        scheduler.flush();
+        client.flush();
+        auto t1 = Clock::now();
+        return double(ids.size()) / std::chrono::duration<double>(t1 - t0).count();
+    }
+
+    // One blocking round trip per task, nodes taken round-robin
+    double run_blocking(orion::distributed::NodeRegistry& registry,
+                        const std::vector<orion::ObjectId>& ids) {
+        std::vector<std::unique_ptr<orion::NodeService::Stub>> stubs;
+        for (const auto& n : registry.nodes()) {
+            stubs.push_back(orion::NodeService::NewStub(
+                grpc::CreateChannel(n.address, grpc::InsecureChannelCredentials())));
+        }
+
+        auto t0 = Clock::now();
+        for (size_t i = 0; i < ids.size(); ++i) {
+            orion::TaskRequest req;
+            req.set_task(ids[i].value());
+            req.set_function_name("noop");
+            orion::TaskReply reply;
+            grpc::ClientContext ctx;
+            stubs[i % stubs.size()]->ExecuteTask(&ctx, req, &reply);
+        }
+        auto t1 = Clock::now();
+        return double(ids.size()) / std::chrono::duration<double>(t1 - t0).count();
+    }
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    size_t tasks = (argc > 1) ? std::stoul(argv[1]) : 20000;
+    size_t nodes = (argc > 2) ? std::stoul(argv[2]) : 2;
+    std::chrono::microseconds latency((argc > 3) ? std::stoul(argv[3]) : 0);
+
+    orion::distributed::GrpcNodeClient::set_verbose(false);
+
+    std::vector<std::unique_ptr<LocalNode>> servers;
+    orion::distributed::NodeRegistry registry;
+    for (size_t i = 0; i < nodes; ++i) {
+        auto n = std::make_unique<LocalNode>(latency);
+        grpc::ServerBuilder builder;
+        builder.AddListeningPort("127.0.0.1:0", grpc::InsecureServerCredentials(), &n->port);
+        builder.RegisterService(&n->service);
+        n->server = builder.BuildAndStart();
+        if (!n->server) {
+            std::cerr << "failed to start node server\n";
+            return 1;
+        }
+        registry.register_node({"node-" + std::to_string(i + 1),
+                                "127.0.0.1:" + std::to_string(n->port), 2, true});
+        servers.push_back(std::move(n));
+    }
+
+    std::vector<orion::ObjectId> ids;
+    ids.reserve(tasks);
+    for (size_t i = 0; i < tasks; ++i) ids.push_back(orion::ObjectId::generate());
+
+    std::cout << "nodes: " << nodes << "  tasks: " << tasks
+              << "  latency: " << latency.count() << "us\n";
+    std::cout << std::left << std::setw(14) << "window/node" << std::setw(12) << "max_batch"
+              << "tasks/sec\n";
+    std::cout << std::left << std::setw(26) << "blocking"
+              << std::fixed << std::setprecision(0) << run_blocking(registry, ids) << "\n";
+
+    const std::pair<size_t, size_t> cases[] = {
+        {1, 1}, {16, 1}, {64, 1}, {64, 16}, {64, 64}, {64, 256},
+    };
+    for (auto [window, batch] : cases) {
+        double rate = run(registry, window, batch, ids);
+        std::cout << std::left << std::setw(14) << window << std::setw(12) << batch
+                  << std::fixed << std::setprecision(0) << rate << "\n";
+    }
+
+    for (auto& n : servers) n->server->Shutdown();
+    return 0;
+}
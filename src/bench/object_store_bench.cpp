@@ -0,0 +1,119 @@
+// object_store_bench.cpp — ObjectStore throughput under contention
+//
+// Scales threads 1 → 64 over a read-mostly mix (90% get/contains, 10% put)
+// against a pre-populated store, and compares the sharded ObjectStore with a
+// single-mutex std::unordered_map store (the pre-sharding design).
+//
+// Usage:  ./bench_object_store [ops_per_thread] [max_threads]   (default: 200000 64)
+
+#include <any>
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "core/object_store.h"
+
+using Clock = std::chrono::steady_clock;
+
+namespace {
+
+    constexpr size_t kKeys = 100000;
+
+    // Reference: one lock, one map
+    class GlobalLockStore {
+    public:
+        void put(const orion::ObjectId& id, std::any value) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            store_[id] = std::move(value);
+        }
+        std::optional<std::any> get(const orion::ObjectId& id) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto it = store_.find(id);
+            if (it == store_.end()) return std::nullopt;
+            return it->second;
+        }
+        bool contains(const orion::ObjectId& id) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return store_.find(id) != store_.end();
+        }
+
+    private:
+        std::unordered_map<orion::ObjectId, std::any> store_;
+        std::mutex mutex_;
+    };
+
+    template <typename Store>
+    double run(Store& store, const std::vector<orion::ObjectId>& keys,
+               size_t threads, size_t ops_per_thread) {
+        std::atomic<bool> go{false};
+        std::atomic<size_t> sink{0};
+        std::vector<std::thread> pool;
+
+        for (size_t t = 0; t < threads; ++t) {
+            pool.emplace_back([&, t] {
+                uint64_t x = 0x9E3779B97F4A7C15ULL * (t + 1);
+                size_t hits = 0;
+                while (!go.load(std::memory_order_acquire)) {}
+
+                for (size_t i = 0; i < ops_per_thread; ++i) {
+                    x ^= x >> 12; x ^= x << 25; x ^= x >> 27;
+                    const orion::ObjectId key = keys[(x * 2685821657736338717ULL) % keys.size()];
+                    unsigned op = unsigned(x % 10);
+                    if (op == 0) {
+                        store.put(key, int(i));
+                    } else if (op < 5) {
+                        hits += store.contains(key);
+                    } else {
+                        hits += store.get(key).has_value();
+                    }
+                }
+                sink.fetch_add(hits);
+            });
+        }
+
+        auto t0 = Clock::now();
+        go.store(true, std::memory_order_release);
+        for (auto& th : pool) th.join();
+        auto t1 = Clock::now();
+
+        double secs = std::chrono::duration<double>(t1 - t0).count();
+        return double(threads * ops_per_thread) / secs / 1e6;
+    }
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    size_t ops_per_thread = (argc > 1) ? std::stoul(argv[1]) : 200000;
+    size_t max_threads    = (argc > 2) ? std::stoul(argv[2]) : 64;
+
+    std::vector<orion::ObjectId> keys;
+    keys.reserve(kKeys);
+    for (size_t i = 0; i < kKeys; ++i) keys.push_back("obj-" + std::to_string(i));
+
+    std::cout << "hardware threads: " << std::thread::hardware_concurrency() << "\n";
+    std::cout << std::left << std::setw(10) << "threads"
+              << std::setw(20) << "global-lock Mops/s"
+              << std::setw(20) << "sharded Mops/s" << "\n";
+
+    for (size_t threads = 1; threads <= max_threads; threads *= 2) {
+        GlobalLockStore global;
+        orion::ObjectStore sharded;
+        for (const auto& k : keys) {
+            global.put(k, 0);
+            sharded.put(k, 0);
+        }
+
+        double g = run(global, keys, threads, ops_per_thread);
+        double s = run(sharded, keys, threads, ops_per_thread);
+        std::cout << std::left << std::setw(10) << threads << std::fixed << std::setprecision(2)
+                  << std::setw(20) << g << std::setw(20) << s << "\n";
+    }
+    return 0;
+}
@@ -0,0 +1,161 @@
+// pending_bench.cpp — ClusterScheduler cost per submit and per report against a backlog
+//
+// Parks `backlog` tasks in a ClusterScheduler, each waiting for two objects
+// still being produced on different nodes (so they cannot be forwarded
+// either). Then, against that backlog, it times:
+//   submit   `submits` independent tasks, one submit() each
+//   report   their outputs, one on_objects_created() per node
+//   release  the two objects the backlog waits for; every backlog task is
+//            dispatched
+// The NodeClient is a stand-in that accepts every batch at once and runs
+// nothing, so only the head's own work is measured. Submit and report cost
+// should not grow with the backlog; release is linear in it.
+//
+// Usage:  ./bench_pending [max_backlog] [submits]   (default: 1000000 10000)
+
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "distributed/cluster/node_registry.h"
+#include "distributed/cluster/cluster_scheduler.h"
+#include "distributed/rpc/node_client.h"
+
+using Clock = std::chrono::steady_clock;
+
+namespace {
+
+    // Accepts every batch at once and remembers where each task went
+    class NullClient : public orion::distributed::NodeClient {
+    public:
+        orion::ObjectRef submit_task(const std::string& node_id, orion::Task task) override {
+            std::lock_guard<std::mutex> lock(mu_);
+            placed_[task.id] = node_id;
+            return orion::ObjectRef{task.id};
+        }
+
+        void submit_tasks(const std::string& node_id, std::vector<orion::Task> tasks,
+                          DispatchDone done) override {
+            {
+                std::lock_guard<std::mutex> lock(mu_);
+                for (const auto& task : tasks) placed_[task.id] = node_id;
+            }
+            dispatched_ += tasks.size();
+            if (done) done(true, {});
+        }
+
+        std::string node_of(orion::ObjectId id) {
+            std::lock_guard<std::mutex> lock(mu_);
+            return placed_.at(id);
+        }
+
+        size_t dispatched() const { return dispatched_; }
+
+    private:
+        std::unordered_map<orion::ObjectId, std::string> placed_;
+        std::atomic<size_t> dispatched_{0};
+        std::mutex mu_;
+    };
+
+    struct Result {
+        double submit_us = 0;    // per submit()
+        double report_us = 0;    // per reported object
+        double release_ns = 0;   // per backlog task dispatched
+    };
+
+    double seconds_since(Clock::time_point start) {
+        return std::chrono::duration<double>(Clock::now() - start).count();
+    }
+
+    orion::Task make_task(std::vector<orion::ObjectId> deps = {}) {
+        orion::Task task;
+        task.id = orion::ObjectId::generate();
+        task.function_name = "sim";
+        for (const auto& dep : deps) task.deps.push_back(orion::ObjectRef{dep});
+        return task;
+    }
+
+    Result run(size_t backlog, size_t submits) {
+        orion::distributed::NodeRegistry registry;
+        for (int i = 1; i <= 4; ++i) {
+            registry.register_node({"node-" + std::to_string(i), "sim", 8, true});
+        }
+        NullClient client;
+        orion::distributed::DispatchOptions options;
+        options.max_linger = std::chrono::microseconds(0);   // dispatch within schedule()
+        orion::distributed::ClusterScheduler scheduler(registry, client, options);
+
+        // Two producers, placed on different nodes by load
+        const orion::ObjectId gate_a = scheduler.submit(make_task()).id;
+        const orion::ObjectId gate_b = scheduler.submit(make_task()).id;
+        if (client.node_of(gate_a) == client.node_of(gate_b)) {
+            std::cerr << "[bench] both gates on " << client.node_of(gate_a) << "\n";
+        }
+        for (size_t i = 0; i < backlog; ++i) scheduler.submit(make_task({gate_a, gate_b}));
+        if (scheduler.pending_count() != backlog) {
+            std::cerr << "[bench] " << scheduler.pending_count() << " of " << backlog
+                      << " tasks waiting\n";
+        }
+
+        Result result;
+        std::vector<orion::Task> tasks;
+        tasks.reserve(submits);
+        for (size_t i = 0; i < submits; ++i) tasks.push_back(make_task());
+        std::vector<orion::ObjectId> ids;
+        for (const auto& task : tasks) ids.push_back(task.id);
+
+        auto start = Clock::now();
+        for (auto& task : tasks) scheduler.submit(std::move(task));
+        result.submit_us = seconds_since(start) * 1e6 / double(submits);
+
+        std::unordered_map<std::string, std::vector<orion::ObjectId>> by_node;
+        for (const auto& id : ids) by_node[client.node_of(id)].push_back(id);
+        start = Clock::now();
+        for (const auto& [node_id, outputs] : by_node) {
+            scheduler.on_objects_created(outputs, node_id);
+        }
+        result.report_us = seconds_since(start) * 1e6 / double(submits);
+
+        const size_t before = client.dispatched();
+        start = Clock::now();
+        scheduler.on_objects_created({gate_a}, client.node_of(gate_a));
+        scheduler.on_objects_created({gate_b}, client.node_of(gate_b));
+        const double release = seconds_since(start);
+        if (client.dispatched() - before != backlog) {
+            std::cerr << "[bench] released " << client.dispatched() - before << " of "
+                      << backlog << " tasks\n";
+        }
+        result.release_ns = backlog ? release * 1e9 / double(backlog) : 0;
+        return result;
+    }
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    size_t max_backlog = (argc > 1) ? std::stoul(argv[1]) : 1000000;
+    size_t submits = (argc > 2) ? std::stoul(argv[2]) : 10000;
+
+    std::cout << "submits: " << submits << "  nodes: 4 x 8 workers\n\n";
+    std::cout << std::left << std::setw(12) << "backlog" << std::setw(18) << "submit (us/task)"
+              << std::setw(20) << "report (us/object)" << "release (ns/task)\n";
+
+    std::vector<size_t> backlogs{0};
+    for (size_t b = 1000; b <= max_backlog; b *= 10) backlogs.push_back(b);
+    for (size_t backlog : backlogs) {
+        Result r = run(backlog, submits);
+        std::cout << std::left << std::setw(12) << backlog << std::fixed << std::setprecision(2)
+                  << std::setw(18) << r.submit_us << std::setw(20) << r.report_us;
+        if (backlog) {
+            std::cout << std::setprecision(0) << r.release_ns;
+        } else {
+            std::cout << "-";
+        }
+        std::cout << "\n";
+    }
+    return 0;
+}
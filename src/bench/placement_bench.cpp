@@ -0,0 +1,359 @@
+// placement_bench.cpp — ClusterScheduler placement policies on a simulated cluster
+//
+// Runs a join/aggregate DAG through a ClusterScheduler whose NodeClient is a
+// simulation: nothing executes, but every node remembers which objects it
+// holds, and a dispatched task whose inputs live elsewhere counts their bytes
+// as moved (the node keeps the copy, as the ObjectFetcher does). Time moves
+// in ticks, one per head round trip; each tick a node works on up to
+// `workers` of its queued tasks whose inputs it holds and reports the
+// outputs of those it finishes, with sizes, as a real node would, followed
+// by a heartbeat with its queue depth. The head then rebalances
+// (ClusterScheduler::rebalance), as it does on every FailureDetector tick;
+// a node gives back tasks it has not started. An input a node is still
+// producing itself (a forwarded dependent,
+// DispatchOptions::forward_dependents) is not moved, and its consumer may
+// run in the same tick once it is done.
+//
+// Nodes are deliberately uneven (1, 2, 4, 8, ... workers) so that following
+// the data alone piles work onto whichever node produced it.
+//
+// The join DAG, per partition i:
+//   scan_a[i], scan_b[i]          16 MiB each, no inputs
+//   filter[i]  (scan_a[i])         4 MiB
+//   join[i]    (filter[i], scan_b[i])  1 MiB
+// then one aggregate per 4 joins (64 KiB) and a final reduce over those.
+//
+// The chain DAG: `partitions` / 4 independent chains of 32 steps, 1 MiB
+// each. Its tasks are short next to a head round trip: a worker can run 8 of
+// them, one after another, per tick.
+//
+// The skewed DAG: `partitions` * 4 independent tasks, 1 MiB each. One in
+// eight takes 16 ticks, the rest one. Placement cannot know which, so some
+// nodes end up with a long queue behind their slow tasks while others idle.
+//
+// Usage:  ./bench_placement [partitions] [nodes]   (default: 64 4)
+
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "distributed/cluster/node_registry.h"
+#include "distributed/cluster/cluster_scheduler.h"
+#include "distributed/rpc/node_client.h"
+
+namespace {
+
+    constexpr uint64_t kMiB = 1 << 20;
+
+    struct SimTask {
+        orion::ObjectId id;
+        uint64_t bytes = 0;                      // output size
+        std::vector<orion::ObjectId> deps;
+        size_t cost = 1;                         // rounds of work
+    };
+
+    // Accepts tasks at once and queues them on the simulated node
+    class SimClient : public orion::distributed::NodeClient {
+    public:
+        SimClient(const std::unordered_map<orion::ObjectId, uint64_t>& sizes,
+                  const std::unordered_map<orion::ObjectId, size_t>& costs)
+            : sizes_(sizes), costs_(costs) {}
+
+        orion::ObjectRef submit_task(const std::string& node_id, orion::Task task) override {
+            std::lock_guard<std::mutex> lock(mu_);
+            accept_locked(node_id, task);
+            return orion::ObjectRef{task.id};
+        }
+
+        void submit_tasks(const std::string& node_id, std::vector<orion::Task> tasks,
+                          DispatchDone done) override {
+            {
+                std::lock_guard<std::mutex> lock(mu_);
+                for (const auto& task : tasks) accept_locked(node_id, task);
+            }
+            if (done) done(true, {});
+        }
+
+        // Give back the tasks among `task_ids` that have not started
+        void steal_tasks(const std::string& node_id,
+                         const std::vector<orion::ObjectId>& task_ids,
+                         StealDone done) override {
+            std::vector<orion::ObjectId> stolen;
+            {
+                std::lock_guard<std::mutex> lock(mu_);
+                auto& node = nodes_[node_id];
+                const std::unordered_set<orion::ObjectId> asked(task_ids.begin(), task_ids.end());
+                for (auto it = node.queue.begin(); it != node.queue.end();) {
+                    if (it->started || !asked.count(it->id)) {
+                        ++it;
+                        continue;
+                    }
+                    stolen.push_back(it->id);
+                    node.producing.erase(it->id);
+                    it = node.queue.erase(it);
+                }
+            }
+            if (done) done(std::move(stolen));
+        }
+
+        // One tick on `node_id`: `steps` rounds in which each of `workers`
+        // puts one round into a queued task whose inputs are held there:
+        // the tasks it has started first, then new ones in queue order.
+        // Outputs are held from the next round on.
+        std::vector<orion::ObjectId> run(const std::string& node_id, size_t workers,
+                                         size_t steps) {
+            std::lock_guard<std::mutex> lock(mu_);
+            auto& node = nodes_[node_id];
+            std::vector<orion::ObjectId> done;
+            for (size_t step = 0; step < steps; ++step) {
+                const size_t before = done.size();
+                size_t busy = 0;
+                for (bool started : {true, false}) {
+                    for (auto it = node.queue.begin(); busy < workers && it != node.queue.end();) {
+                        const bool ready = it->started == started &&
+                            std::all_of(it->deps.begin(), it->deps.end(),
+                                        [&](orion::ObjectId d) { return node.held.count(d); });
+                        if (!ready) {
+                            ++it;
+                            continue;
+                        }
+                        ++busy;
+                        it->started = true;
+                        if (--it->remaining > 0) {
+                            ++it;
+                            continue;
+                        }
+                        done.push_back(it->id);
+                        node.producing.erase(it->id);
+                        it = node.queue.erase(it);
+                    }
+                }
+                node.held.insert(done.begin() + before, done.end());
+            }
+            return done;
+        }
+
+        // Tasks not started / started, as the node's heartbeat reports them
+        orion::distributed::NodeLoad load(const std::string& node_id) {
+            std::lock_guard<std::mutex> lock(mu_);
+            orion::distributed::NodeLoad load;
+            for (const auto& q : nodes_[node_id].queue) ++(q.started ? load.running : load.queued);
+            return load;
+        }
+
+        uint64_t bytes_moved() {
+            std::lock_guard<std::mutex> lock(mu_);
+            return bytes_moved_;
+        }
+
+    private:
+        struct Queued {
+            orion::ObjectId id;
+            std::vector<orion::ObjectId> deps;
+            size_t remaining = 1;   // rounds of work left
+            bool started = false;
+        };
+        struct Node {
+            std::deque<Queued> queue;
+            std::unordered_set<orion::ObjectId> held;
+            std::unordered_set<orion::ObjectId> producing;   // queued here
+        };
+
+        void accept_locked(const std::string& node_id, const orion::Task& task) {
+            auto& node = nodes_[node_id];
+            Queued queued{task.id, {}, costs_.at(task.id)};
+            for (const auto& dep : task.deps) {
+                queued.deps.push_back(dep.id);
+                if (node.producing.count(dep.id)) continue;
+                if (node.held.insert(dep.id).second) bytes_moved_ += sizes_.at(dep.id);
+            }
+            node.producing.insert(task.id);
+            node.queue.push_back(std::move(queued));
+        }
+
+        const std::unordered_map<orion::ObjectId, uint64_t>& sizes_;
+        const std::unordered_map<orion::ObjectId, size_t>& costs_;
+        std::unordered_map<std::string, Node> nodes_;
+        uint64_t bytes_moved_ = 0;
+        std::mutex mu_;
+    };
+
+    std::vector<SimTask> build_dag(size_t partitions) {
+        std::vector<SimTask> dag;
+        auto add = [&](uint64_t bytes, std::vector<orion::ObjectId> deps) {
+            dag.push_back({orion::ObjectId::generate(), bytes, std::move(deps)});
+            return dag.back().id;
+        };
+
+        std::vector<orion::ObjectId> joins;
+        for (size_t i = 0; i < partitions; ++i) {
+            auto scan_a = add(16 * kMiB, {});
+            auto scan_b = add(16 * kMiB, {});
+            auto filter = add(4 * kMiB, {scan_a});
+            joins.push_back(add(1 * kMiB, {filter, scan_b}));
+        }
+        std::vector<orion::ObjectId> aggs;
+        for (size_t i = 0; i < joins.size(); i += 4) {
+            std::vector<orion::ObjectId> group(joins.begin() + i,
+                                               joins.begin() + std::min(i + 4, joins.size()));
+            aggs.push_back(add(64 * 1024, std::move(group)));
+        }
+        add(8, std::move(aggs));
+        return dag;
+    }
+
+    std::vector<SimTask> build_chains(size_t chains, size_t length) {
+        std::vector<SimTask> dag;
+        for (size_t c = 0; c < chains; ++c) {
+            std::vector<orion::ObjectId> prev;
+            for (size_t i = 0; i < length; ++i) {
+                dag.push_back({orion::ObjectId::generate(), 1 * kMiB, prev});
+                prev = {dag.back().id};
+            }
+        }
+        return dag;
+    }
+
+    std::vector<SimTask> build_skewed(size_t tasks) {
+        std::vector<SimTask> dag;
+        for (size_t i = 0; i < tasks; ++i) {
+            dag.push_back({orion::ObjectId::generate(), 1 * kMiB, {}, i % 8 == 0 ? 16u : 1u});
+        }
+        return dag;
+    }
+
+    struct Result {
+        uint64_t bytes_moved = 0;
+        size_t ticks = 0;
+    };
+
+    // `steps`: tasks a worker finishes per tick
+    Result run(const std::vector<SimTask>& dag, const std::vector<size_t>& workers,
+               orion::distributed::DispatchOptions options, size_t steps = 1) {
+        std::unordered_map<orion::ObjectId, uint64_t> sizes;
+        std::unordered_map<orion::ObjectId, size_t> costs;
+        for (const auto& t : dag) {
+            sizes[t.id] = t.bytes;
+            costs[t.id] = t.cost;
+        }
+
+        orion::distributed::NodeRegistry registry;
+        std::vector<std::string> node_ids;
+        for (size_t i = 0; i < workers.size(); ++i) {
+            node_ids.push_back("node-" + std::to_string(i + 1));
+            registry.register_node({node_ids.back(), "sim", int(workers[i]), true});
+        }
+
+        SimClient client(sizes, costs);
+        options.max_linger = std::chrono::microseconds(0);   // dispatch within schedule()
+        orion::distributed::ClusterScheduler scheduler(registry, client, options);
+
+        for (const auto& t : dag) {
+            orion::Task task;
+            task.id = t.id;
+            task.function_name = "sim";
+            for (const auto& dep : t.deps) task.deps.push_back(orion::ObjectRef{dep});
+            scheduler.submit(std::move(task));
+        }
+
+        Result result;
+        size_t finished = 0;
+        size_t idle_ticks = 0;
+        while (finished < dag.size()) {
+            std::vector<std::vector<orion::ObjectId>> done(node_ids.size());
+            size_t progress = 0;
+            for (size_t n = 0; n < node_ids.size(); ++n) {
+                done[n] = client.run(node_ids[n], workers[n], steps);
+                progress += done[n].size();
+            }
+            // Long tasks finish nothing for a while; give up only well past that
+            idle_ticks = progress ? 0 : idle_ticks + 1;
+            if (idle_ticks > 64) {
+                std::cerr << "stalled after " << finished << " of " << dag.size() << " tasks\n";
+                break;
+            }
+            ++result.ticks;
+            finished += progress;
+
+            for (size_t n = 0; n < node_ids.size(); ++n) {
+                if (done[n].empty()) continue;
+                std::vector<uint64_t> out_sizes;
+                for (const auto& id : done[n]) out_sizes.push_back(sizes.at(id));
+                scheduler.on_objects_created(done[n], node_ids[n], out_sizes);
+            }
+            // Heartbeats: the queue depth each node would report
+            for (const auto& node_id : node_ids) {
+                registry.heartbeat(node_id, client.load(node_id));
+            }
+            scheduler.rebalance();
+        }
+        result.bytes_moved = client.bytes_moved();
+        return result;
+    }
+
+    using orion::distributed::Placement;
+
+    struct Case {
+        const char* name;
+        orion::distributed::DispatchOptions options;
+    };
+
+    void report(const char* title, const std::vector<SimTask>& dag,
+                const std::vector<size_t>& workers, const std::vector<Case>& cases,
+                size_t steps) {
+        uint64_t total_bytes = 0;
+        for (const auto& t : dag) total_bytes += t.bytes;
+        std::cout << "\n" << title << "  tasks: " << dag.size()
+                  << "  data produced: " << total_bytes / kMiB << " MiB\n";
+        std::cout << std::left << std::setw(22) << "policy" << std::setw(16) << "moved (MiB)"
+                  << "makespan (ticks)\n";
+        for (const auto& c : cases) {
+            Result r = run(dag, workers, c.options, steps);
+            std::cout << std::left << std::setw(22) << c.name << std::setw(16)
+                      << std::fixed << std::setprecision(1) << double(r.bytes_moved) / kMiB
+                      << r.ticks << "\n";
+        }
+    }
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    size_t partitions = (argc > 1) ? std::stoul(argv[1]) : 64;
+    size_t nodes = (argc > 2) ? std::stoul(argv[2]) : 4;
+
+    std::vector<size_t> workers;
+    for (size_t i = 0; i < nodes; ++i) workers.push_back(size_t(1) << (i % 4));
+
+    std::cout << "partitions: " << partitions << "  nodes: " << nodes << "  workers:";
+    for (size_t w : workers) std::cout << " " << w;
+    std::cout << "\n";
+
+    const std::vector<Case> cases = {
+        {"round-robin",          {.placement = Placement::RoundRobin}},
+        {"power of two",         {.placement = Placement::PowerOfTwo}},
+        {"locality, slack 0",    {.placement = Placement::Locality, .locality_slack = 0.0}},
+        {"locality, slack 2",    {.placement = Placement::Locality, .locality_slack = 2.0}},
+        {"  ... no forwarding",  {.placement = Placement::Locality, .locality_slack = 2.0,
+                                  .forward_dependents = false}},
+        {"locality, no load",    {.placement = Placement::Locality, .locality_slack = 1e9}},
+    };
+    report("join DAG", build_dag(partitions), workers, cases, 1);
+    report("chain DAG", build_chains(std::max<size_t>(partitions / 4, 1), 32), workers, cases, 8);
+
+    const std::vector<Case> stealing = {
+        {"power of two",         {.placement = Placement::PowerOfTwo}},
+        {"  ... no stealing",    {.placement = Placement::PowerOfTwo, .work_stealing = false}},
+        {"locality, slack 2",    {.placement = Placement::Locality, .locality_slack = 2.0}},
+        {"  ... no stealing",    {.placement = Placement::Locality, .locality_slack = 2.0,
+                                  .work_stealing = false}},
+    };
+    report("skewed DAG", build_skewed(partitions * 4), workers, stealing, 1);
+    return 0;
+}
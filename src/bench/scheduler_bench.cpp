@@ -0,0 +1,107 @@
+// scheduler_bench.cpp — dependency-tracking cost of the local Scheduler
+//
+// Workers are created but never started, so dispatched tasks just sit in
+// their queues. The bench plays the role of the workers by putting each
+// output object itself, which isolates the scheduler's per-completion cost
+// (on_object_created + schedule) from task execution.
+//
+// Shapes:
+//   chain   t1 <- t2 <- ... <- tN      each put releases exactly one task
+//   fanout  N tasks share one root and each has a private input
+//
+// Usage:  ./bench_scheduler [max_tasks]   (default: 100000)
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <memory>
+#include <chrono>
+
+#include "core/object_store.h"
+#include "core/scheduler.h"
+#include "core/worker.h"
+
+using Clock = std::chrono::steady_clock;
+
+namespace {
+
+    struct Harness {
+        orion::ObjectStore store;
+        std::vector<std::unique_ptr<orion::Worker>> workers;
+        std::unique_ptr<orion::Scheduler> scheduler;
+
+        explicit Harness(size_t num_workers) {
+            std::vector<orion::Worker*> ptrs;
+            for (size_t i = 0; i < num_workers; ++i) {
+                workers.push_back(std::make_unique<orion::Worker>(store));
+                ptrs.push_back(workers.back().get());
+            }
+            scheduler = std::make_unique<orion::Scheduler>(ptrs, store);
+        }
+    };
+
+    orion::Task make_task(std::string id, std::vector<orion::ObjectRef> deps) {
+        return orion::Task{std::move(id), std::move(deps),
+                           [](std::vector<std::any>) -> std::any { return 0; }};
+    }
+
+    // Returns ns per completion
+    double run_chain(size_t n) {
+        Harness h(4);
+        for (size_t i = 1; i <= n; ++i) {
+            h.scheduler->submit(make_task("c" + std::to_string(i),
+                                          {orion::ObjectRef{"c" + std::to_string(i - 1)}}));
+        }
+
+        auto t0 = Clock::now();
+        for (size_t i = 0; i < n; ++i) {
+            h.store.put("c" + std::to_string(i), 0);
+        }
+        auto t1 = Clock::now();
+
+        if (h.scheduler->pending_count() != 0) {
+            std::cerr << "[bench] chain: " << h.scheduler->pending_count() << " tasks stuck\n";
+        }
+        return std::chrono::duration<double, std::nano>(t1 - t0).count() / double(n);
+    }
+
+    double run_fanout(size_t n) {
+        Harness h(4);
+        for (size_t i = 0; i < n; ++i) {
+            h.scheduler->submit(make_task("f" + std::to_string(i),
+                                          {orion::ObjectRef{"root"},
+                                           orion::ObjectRef{"in" + std::to_string(i)}}));
+        }
+
+        auto t0 = Clock::now();
+        h.store.put("root", 0);
+        for (size_t i = 0; i < n; ++i) {
+            h.store.put("in" + std::to_string(i), 0);
+        }
+        auto t1 = Clock::now();
+
+        if (h.scheduler->pending_count() != 0) {
+            std::cerr << "[bench] fanout: " << h.scheduler->pending_count() << " tasks stuck\n";
+        }
+        return std::chrono::duration<double, std::nano>(t1 - t0).count() / double(n + 1);
+    }
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    size_t max_tasks = (argc > 1) ? std::stoul(argv[1]) : 100000;
+
+    std::cout << std::left << std::setw(10) << "tasks"
+              << std::setw(18) << "chain ns/put"
+              << std::setw(18) << "fanout ns/put" << "\n";
+
+    for (size_t n = 1000; n <= max_tasks; n *= 10) {
+        double chain  = run_chain(n);
+        double fanout = run_fanout(n);
+        std::cout << std::left << std::setw(10) << n
+                  << std::setw(18) << std::fixed << std::setprecision(1) << chain
+                  << std::setw(18) << fanout << "\n";
+    }
+    return 0;
+}
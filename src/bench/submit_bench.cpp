@@ -0,0 +1,154 @@
+// submit_bench.cpp — allocations and throughput of Runtime::submit
+//
+// Replaces global operator new to count heap allocations, then pushes tiny
+// tasks (return a constant / add one to a shared input) through a
+// reference-counting Runtime, dropping every returned ref. A warm-up round
+// first grows every queue, table and pool to its steady-state size; the
+// measured round reports throughput and allocations per task, on the
+// submitting thread (Task construction + submit) and on all threads
+// (scheduling, execution, the stored result).
+//
+// Usage:  ./bench_submit [tasks] [workers]   (default: 1000000 4)
+
+#include <any>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "core/worker.h"
+#include "local/runtime.h"
+
+using Clock = std::chrono::steady_clock;
+
+namespace {
+
+    std::atomic<uint64_t> g_allocs{0};
+    thread_local uint64_t t_allocs = 0;
+
+} // namespace
+
+void* operator new(std::size_t size) {
+    g_allocs.fetch_add(1, std::memory_order_relaxed);
+    ++t_allocs;
+    if (void* p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+
+void* operator new(std::size_t size, std::align_val_t align) {
+    g_allocs.fetch_add(1, std::memory_order_relaxed);
+    ++t_allocs;
+    std::size_t a = static_cast<std::size_t>(align);
+    if (void* p = std::aligned_alloc(a, (size + a - 1) / a * a)) return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete(void* p, std::align_val_t) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept { std::free(p); }
+
+namespace {
+
+    struct Result {
+        double tasks_per_sec = 0;
+        double submit_allocs = 0;   // per task, on the submitting thread
+        double total_allocs = 0;    // per task, all threads
+    };
+
+    // Ids are built (and interned) before the timed region
+    std::vector<orion::ObjectId> make_ids(size_t first, size_t n) {
+        std::vector<orion::ObjectId> ids;
+        ids.reserve(n);
+        for (size_t i = first; i < first + n; ++i) ids.push_back("t" + std::to_string(i));
+        return ids;
+    }
+
+    // Fire-and-forget: every returned ref is dropped at once, so each result
+    // is freed on arrival and the store stays at its steady-state size.
+    // Completion is counted through the free callback.
+    template <typename Submit>
+    Result run(orion::Runtime& rt, std::atomic<size_t>& freed,
+               const std::vector<orion::ObjectId>& ids, Submit submit) {
+        const size_t target = freed.load() + ids.size();
+        uint64_t g0 = g_allocs.load();
+        uint64_t t0_allocs = t_allocs;
+        auto t0 = Clock::now();
+
+        for (const auto& id : ids) submit(rt, id);
+        uint64_t t1_allocs = t_allocs;
+        while (freed.load(std::memory_order_acquire) < target) {
+            std::this_thread::yield();
+        }
+
+        auto t1 = Clock::now();
+        double n = double(ids.size());
+        Result r;
+        r.tasks_per_sec = n / std::chrono::duration<double>(t1 - t0).count();
+        r.submit_allocs = double(t1_allocs - t0_allocs) / n;
+        r.total_allocs = double(g_allocs.load() - g0) / n;
+        return r;
+    }
+
+    template <typename Submit>
+    Result measure(size_t tasks, size_t workers, orion::ExecutionMode mode, Submit submit) {
+        std::atomic<size_t> freed{0};
+        orion::Runtime rt(workers, orion::RuntimeOptions{.mode = mode, .reference_counting = true});
+        rt.set_on_free_callback([&](const orion::ObjectId&) {
+            freed.fetch_add(1, std::memory_order_release);
+        });
+
+        // Input of the 1-dep case; held for the whole run
+        auto root = rt.submit(orion::Task{"root", {}, [] { return std::any(1); }});
+        rt.wait(root);
+
+        // Warm-up grows queues, tables and pools; then measure a fresh batch
+        run(rt, freed, make_ids(0, tasks), submit);
+        Result r = run(rt, freed, make_ids(tasks, tasks), submit);
+
+        rt.shutdown();
+        return r;
+    }
+
+    void row(const char* name, const Result& r) {
+        std::cout << std::left << std::setw(26) << name
+                  << std::setw(14) << std::fixed << std::setprecision(0) << r.tasks_per_sec
+                  << std::setw(16) << std::setprecision(2) << r.submit_allocs
+                  << std::setw(16) << r.total_allocs << "\n";
+    }
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    size_t tasks   = (argc > 1) ? std::stoul(argv[1]) : 1000000;
+    size_t workers = (argc > 2) ? std::stoul(argv[2]) : 4;
+
+    orion::Worker::set_verbose(false);
+
+    auto no_deps = [](orion::Runtime& rt, orion::ObjectId id) {
+        rt.submit(orion::Task{id, {}, [] { return std::any(42); }});
+    };
+    static const orion::ObjectId root{"root"};
+    auto one_dep = [](orion::Runtime& rt, orion::ObjectId id) {
+        rt.submit(orion::Task{id, {orion::ObjectRef{root}},
+            [](const std::vector<orion::ObjectHandle>& in) -> std::any {
+                return orion::object_cast<int>(in[0]) + 1;
+            }});
+    };
+
+    std::cout << std::left << std::setw(26) << "case"
+              << std::setw(14) << "tasks/sec"
+              << std::setw(16) << "allocs/task"
+              << std::setw(16) << "(all threads)" << "\n";
+
+    row("round-robin, no deps", measure(tasks, workers, orion::ExecutionMode::RoundRobin, no_deps));
+    row("round-robin, 1 dep", measure(tasks, workers, orion::ExecutionMode::RoundRobin, one_dep));
+    row("work-stealing, no deps", measure(tasks, workers, orion::ExecutionMode::WorkStealing, no_deps));
+    row("work-stealing, 1 dep", measure(tasks, workers, orion::ExecutionMode::WorkStealing, one_dep));
+    return 0;
+}
@@ -0,0 +1,294 @@
+// transport_bench.cpp — gRPC vs raw TCP between head and nodes, on loopback
+//
+// Starts one in-process node per transport: a gRPC NodeService and a
+// TcpNodeServer-style TcpLoop listener. Both decode the tasks they are sent
+// and accept all of them without running anything, and serve objects from a
+// local ObjectStore. A stand-in ClusterHead answers GetObjectLocation. Then,
+// for GrpcNodeClient and TcpNodeClient in turn:
+//   latency     one 1-task ExecuteTasks call at a time: round trip, from
+//               submit_tasks() to its done callback
+//   throughput  `tasks` independent tasks through a ClusterScheduler, with
+//               max_batch 1 and 64, until every batch is acknowledged
+//   objects     ObjectFetcher::fetch of a vector<uint8> (4 KiB, then ×16 up
+//               to max_object_mb) into an empty store, the way a node pulls a
+//               remote input (including the GetObjectLocation call to the
+//               head, which is gRPC both ways)
+//
+// Usage:  ./bench_transport [tasks] [round_trips] [max_object_mb]
+//         (default: 50000 5000 64)
+
+#include <algorithm>
+#include <chrono>
+#include <future>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <grpcpp/grpcpp.h>
+
+#include "distributed/generated/orion.grpc.pb.h"
+#include "distributed/cluster/node_registry.h"
+#include "distributed/cluster/cluster_scheduler.h"
+#include "distributed/object_fetcher.h"
+#include "distributed/rpc/grpc_node_client.h"
+#include "distributed/rpc/tcp_node_client.h"
+#include "core/object_store.h"
+
+using Clock = std::chrono::steady_clock;
+
+namespace {
+
+    using orion::distributed::FrameHeader;
+    using orion::distributed::FrameType;
+    using orion::distributed::TcpConnection;
+    using orion::distributed::Transport;
+    using orion::distributed::WireReader;
+    using orion::distributed::WireWriter;
+
+    // Accepts every task and serves objects from `store`
+    class GrpcNode final : public orion::NodeService::Service {
+    public:
+        explicit GrpcNode(orion::ObjectStore& store) : store_(store) {}
+
+        grpc::Status ExecuteTasks(grpc::ServerContext*, const orion::TaskBatch*,
+                                  orion::TaskBatchReply*) override {
+            return grpc::Status::OK;
+        }
+
+        grpc::Status FreeObjects(grpc::ServerContext*, const orion::ObjectIdList*,
+                                 orion::Empty*) override {
+            return grpc::Status::OK;
+        }
+
+        grpc::Status GetObject(grpc::ServerContext*, const orion::ObjectLocationRequest* req,
+                               grpc::ServerWriter<orion::ObjectChunk>* writer) override {
+            return orion::distributed::ObjectFetcher::serve(
+                store_, orion::ObjectId::from_value(req->object()), writer);
+        }
+
+    private:
+        orion::ObjectStore& store_;
+    };
+
+    // The same over TCP: decodes every task, accepts all, serves objects
+    void handle_tcp(orion::ObjectStore& store, TcpConnection& conn, const FrameHeader& header,
+                    std::string_view payload) {
+        WireReader in(payload);
+        switch (header.type) {
+            case FrameType::ExecuteTasks: {
+                const uint32_t count = in.u32();
+                for (uint32_t i = 0; i < count && in.ok(); ++i) {
+                    orion::Task task;
+                    in.task(task);
+                }
+                std::string reply;
+                WireWriter(reply).ids({});
+                conn.send(FrameType::ExecuteTasksReply, header.request_id, std::move(reply));
+                return;
+            }
+            case FrameType::GetObject:
+                orion::distributed::ObjectFetcher::serve(
+                    store, orion::ObjectId::from_value(in.u64()), conn, header.request_id);
+                return;
+            default:
+                return;
+        }
+    }
+
+    // Says every object lives on node-1, at whichever address is current
+    class Head final : public orion::ClusterHead::Service {
+    public:
+        std::string node_address;
+
+        grpc::Status GetObjectLocation(grpc::ServerContext*, const orion::ObjectLocationRequest*,
+                                       orion::ObjectLocationReply* reply) override {
+            reply->set_node_id("node-1");
+            reply->set_address(node_address);
+            return grpc::Status::OK;
+        }
+    };
+
+    double seconds_since(Clock::time_point start) {
+        return std::chrono::duration<double>(Clock::now() - start).count();
+    }
+
+    orion::Task make_task() {
+        orion::Task task;
+        task.id = orion::ObjectId::generate();
+        task.function_name = "noop";
+        task.deps.push_back(orion::ObjectRef{orion::ObjectId::generate()});
+        task.args.push_back(std::string(4, '\0'));
+        return task;
+    }
+
+    struct Latency {
+        double p50_us = 0;
+        double p99_us = 0;
+    };
+
+    Latency round_trips(orion::distributed::NodeClient& client, size_t n) {
+        std::vector<double> us;
+        us.reserve(n);
+        for (size_t i = 0; i < n; ++i) {
+            std::vector<orion::Task> tasks;
+            tasks.push_back(make_task());
+            std::promise<void> acked;
+            const auto start = Clock::now();
+            client.submit_tasks("node-1", std::move(tasks),
+                                [&](bool, std::vector<orion::ObjectId>) { acked.set_value(); });
+            acked.get_future().wait();
+            us.push_back(seconds_since(start) * 1e6);
+        }
+        std::sort(us.begin(), us.end());
+        return {us[us.size() / 2], us[us.size() * 99 / 100]};
+    }
+
+    double throughput(orion::distributed::NodeRegistry& registry,
+                      orion::distributed::NodeClient& client, size_t tasks, size_t batch) {
+        orion::distributed::ClusterScheduler scheduler(registry, client, {.max_batch = batch});
+        const auto start = Clock::now();
+        for (size_t i = 0; i < tasks; ++i) {
+            orion::Task task;
+            task.id = orion::ObjectId::generate();
+            task.function_name = "noop";
+            scheduler.submit(std::move(task));
+        }
+        scheduler.flush();
+        client.flush();
+        return double(tasks) / seconds_since(start);
+    }
+
+    // Seconds per fetch of `id` into an empty store
+    double fetch_seconds(Transport transport, const std::string& head_address,
+                         orion::ObjectId id, size_t repeats) {
+        orion::ObjectStore local;
+        local.enable_reference_counting();
+        orion::distributed::ObjectFetcher fetcher(
+            local, head_address, "node-2", {},
+            orion::distributed::ObjectFetcher::kDefaultThreads, transport);
+
+        fetcher.fetch(id);   // warm: connections, stubs
+        local.retain(id);
+        local.release(id);
+
+        const auto start = Clock::now();
+        for (size_t i = 0; i < repeats; ++i) {
+            if (!fetcher.fetch(id)) {
+                std::cerr << "[bench] fetch failed\n";
+                return 0;
+            }
+            local.retain(id);   // frees it again
+            local.release(id);
+        }
+        return seconds_since(start) / double(repeats);
+    }
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    const size_t tasks = (argc > 1) ? std::stoul(argv[1]) : 50000;
+    const size_t trips = (argc > 2) ? std::stoul(argv[2]) : 5000;
+    const size_t max_object_mb = (argc > 3) ? std::stoul(argv[3]) : 64;
+
+    orion::distributed::GrpcNodeClient::set_verbose(false);
+    orion::distributed::TcpNodeClient::set_verbose(false);
+
+    // Objects both nodes serve
+    orion::ObjectStore store;
+    std::vector<std::pair<size_t, orion::ObjectId>> objects;
+    for (size_t bytes = 4 << 10; bytes <= (max_object_mb << 20); bytes *= 16) {
+        const orion::ObjectId id = orion::ObjectId::generate();
+        store.put(id, std::vector<uint8_t>(bytes, 7));
+        objects.emplace_back(bytes, id);
+    }
+
+    // gRPC node
+    GrpcNode grpc_node(store);
+    int grpc_port = 0;
+    grpc::ServerBuilder node_builder;
+    node_builder.AddListeningPort("127.0.0.1:0", grpc::InsecureServerCredentials(), &grpc_port);
+    node_builder.RegisterService(&grpc_node);
+    auto grpc_server = node_builder.BuildAndStart();
+
+    // TCP node
+    orion::distributed::TcpLoop tcp_node;
+    const int tcp_port = tcp_node.listen(
+        "127.0.0.1:0", [&](TcpConnection& conn, const FrameHeader& header,
+                           std::string_view payload) {
+            handle_tcp(store, conn, header, payload);
+        });
+
+    // Head, for object locations
+    Head head;
+    int head_port = 0;
+    grpc::ServerBuilder head_builder;
+    head_builder.AddListeningPort("127.0.0.1:0", grpc::InsecureServerCredentials(), &head_port);
+    head_builder.RegisterService(&head);
+    auto head_server = head_builder.BuildAndStart();
+
+    if (!grpc_server || tcp_port < 0 || !head_server) {
+        std::cerr << "failed to start servers\n";
+        return 1;
+    }
+    const std::string head_address = "127.0.0.1:" + std::to_string(head_port);
+
+    struct Side {
+        const char* name;
+        Transport transport;
+        std::string address;
+    };
+    const Side sides[] = {
+        {"grpc", Transport::Grpc, "127.0.0.1:" + std::to_string(grpc_port)},
+        {"tcp", Transport::Tcp, "127.0.0.1:" + std::to_string(tcp_port)},
+    };
+
+    std::cout << "loopback, 1 node  tasks: " << tasks << "  round trips: " << trips << "\n\n";
+    std::cout << std::left << std::setw(10) << "transport" << std::setw(12) << "p50 (us)"
+              << std::setw(12) << "p99 (us)" << std::setw(22) << "tasks/sec batch=1"
+              << "tasks/sec batch=64\n";
+    for (const auto& side : sides) {
+        orion::distributed::NodeRegistry registry;
+        registry.register_node({"node-1", side.address, 2, true});
+
+        std::unique_ptr<orion::distributed::NodeClient> client;
+        if (side.transport == Transport::Tcp) {
+            client = std::make_unique<orion::distributed::TcpNodeClient>(registry);
+        } else {
+            client = std::make_unique<orion::distributed::GrpcNodeClient>(registry);
+        }
+        round_trips(*client, std::min<size_t>(trips, 100));   // warm up
+        const Latency latency = round_trips(*client, trips);
+        const double rate1 = throughput(registry, *client, tasks, 1);
+        const double rate64 = throughput(registry, *client, tasks, 64);
+
+        std::cout << std::left << std::setw(10) << side.name << std::fixed << std::setprecision(1)
+                  << std::setw(12) << latency.p50_us << std::setw(12) << latency.p99_us
+                  << std::setprecision(0) << std::setw(22) << rate1 << rate64 << "\n";
+    }
+
+    std::cout << "\n" << std::left << std::setw(12) << "object" << std::setw(24)
+              << "grpc (us / MB/s)" << "tcp (us / MB/s)\n";
+    for (const auto& [bytes, id] : objects) {
+        const size_t repeats = std::max<size_t>(5, (256u << 20) / bytes / 4);
+        std::cout << std::left << std::setw(12)
+                  << (bytes >= (1 << 20) ? std::to_string(bytes >> 20) + " MiB"
+                                         : std::to_string(bytes >> 10) + " KiB");
+        for (const auto& side : sides) {
+            head.node_address = side.address;
+            const double s = fetch_seconds(side.transport, head_address, id, std::min<size_t>(repeats, 2000));
+            std::ostringstream cell;
+            cell << std::fixed << std::setprecision(0) << s * 1e6 << " / "
+                 << double(bytes) / s / 1e6;
+            std::cout << std::setw(24) << cell.str();
+        }
+        std::cout << "\n";
+    }
+
+    tcp_node.stop();
+    grpc_server->Shutdown();
+    head_server->Shutdown();
+    return 0;
+}
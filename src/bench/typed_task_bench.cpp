@@ -0,0 +1,137 @@
+// typed_task_bench.cpp — per-task overhead of typed vs std::any tasks
+//
+// invoke   Worker::run_task on one thread against a store whose inputs are
+//          already present: argument collection, the call, result boxing and
+//          the put, with no scheduling. Two int inputs, and one 8 KB
+//          std::vector<double> input (the std::any path copies it).
+// runtime  N independent tiny tasks (a + b over two shared inputs) through a
+//          Runtime, submit to last completion, ns per task.
+//
+// Usage:  ./bench_typed_task [tasks] [workers]   (default: 200000 4)
+
+#include <any>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "core/object_store.h"
+#include "core/typed_ref.h"
+#include "core/worker.h"
+#include "local/runtime.h"
+
+using Clock = std::chrono::steady_clock;
+
+namespace {
+
+    double ns_per(Clock::time_point t0, Clock::time_point t1, size_t n) {
+        return std::chrono::duration<double, std::nano>(t1 - t0).count() / double(n);
+    }
+
+    // Prebuilt task ids, so formatting and interning stay out of the timed loops
+    std::vector<orion::ObjectId> make_ids(const char* prefix, size_t n) {
+        std::vector<orion::ObjectId> ids;
+        ids.reserve(n);
+        for (size_t i = 0; i < n; ++i) ids.push_back(prefix + std::to_string(i));
+        return ids;
+    }
+
+    template <typename MakeTask>
+    double run_invoke(size_t n, MakeTask make_task) {
+        orion::ObjectStore store;
+        store.put("a", 20);
+        store.put("b", 22);
+        store.put("vec", std::vector<double>(1024, 1.0));
+
+        auto ids = make_ids("t", n);
+        std::vector<orion::Task> tasks;
+        tasks.reserve(n);
+        for (size_t i = 0; i < n; ++i) tasks.push_back(make_task(ids[i]));
+
+        auto t0 = Clock::now();
+        for (auto& task : tasks) orion::Worker::run_task(task, store);
+        auto t1 = Clock::now();
+        return ns_per(t0, t1, n);
+    }
+
+    template <typename Submit>
+    double run_runtime(size_t n, size_t workers, Submit submit) {
+        orion::Runtime rt(workers);
+        auto a = rt.submit([] { return 20; });
+        auto b = rt.submit([] { return 22; });
+        rt.wait(a);
+        rt.wait(b);
+
+        auto ids = make_ids("r", n);
+        std::vector<orion::ObjectRef> refs;
+        refs.reserve(n);
+
+        auto t0 = Clock::now();
+        for (size_t i = 0; i < n; ++i) refs.push_back(submit(rt, ids[i], a, b));
+        rt.wait_all(refs);
+        auto t1 = Clock::now();
+
+        rt.shutdown();
+        return ns_per(t0, t1, n);
+    }
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    size_t tasks   = (argc > 1) ? std::stoul(argv[1]) : 200000;
+    size_t workers = (argc > 2) ? std::stoul(argv[2]) : 4;
+
+    orion::Worker::set_verbose(false);
+
+    const orion::TypedRef<int> a{{"a"}}, b{{"b"}};
+    const orion::TypedRef<std::vector<double>> vec{{"vec"}};
+
+    double any_int = run_invoke(tasks, [&](orion::ObjectId id) {
+        return orion::Task{id, {a.ref, b.ref},
+            [](std::vector<std::any> in) -> std::any {
+                return std::any_cast<int>(in[0]) + std::any_cast<int>(in[1]);
+            }};
+    });
+    double typed_int = run_invoke(tasks, [&](orion::ObjectId id) {
+        return orion::make_typed_task(id, [](const int& x, const int& y) { return x + y; }, a, b);
+    });
+
+    double any_vec = run_invoke(tasks / 10, [&](orion::ObjectId id) {
+        return orion::Task{id, {vec.ref},
+            [](std::vector<std::any> in) -> std::any {
+                const auto& v = std::any_cast<const std::vector<double>&>(in[0]);
+                return std::accumulate(v.begin(), v.end(), 0.0);
+            }};
+    });
+    double typed_vec = run_invoke(tasks / 10, [&](orion::ObjectId id) {
+        return orion::make_typed_task(id, [](const std::vector<double>& v) {
+            return std::accumulate(v.begin(), v.end(), 0.0);
+        }, vec);
+    });
+
+    double any_rt = run_runtime(tasks, workers,
+        [](orion::Runtime& rt, orion::ObjectId id, auto& x, auto& y) {
+            return rt.submit(orion::Task{id, {x, y},
+                [](std::vector<std::any> in) -> std::any {
+                    return std::any_cast<int>(in[0]) + std::any_cast<int>(in[1]);
+                }});
+        });
+    double typed_rt = run_runtime(tasks, workers,
+        [](orion::Runtime& rt, orion::ObjectId id, auto& x, auto& y) {
+            return rt.submit(id, [](const int& l, const int& r) { return l + r; }, x, y).ref;
+        });
+
+    std::cout << std::left << std::setw(22) << "case"
+              << std::setw(16) << "std::any ns" << std::setw(16) << "typed ns" << "\n";
+    auto row = [](const char* name, double erased, double typed) {
+        std::cout << std::left << std::setw(22) << name
+                  << std::setw(16) << std::fixed << std::setprecision(1) << erased
+                  << std::setw(16) << typed << "\n";
+    };
+    row("invoke int+int", any_int, typed_int);
+    row("invoke sum(8KB vec)", any_vec, typed_vec);
+    row("runtime int+int", any_rt, typed_rt);
+    return 0;
+}
@@ -0,0 +1,175 @@
+// work_stealing_bench.cpp — round-robin Workers vs WorkStealingPool on skewed work
+//
+// Two workloads, each run under both ExecutionModes:
+//   independent  N tasks submitted by the driver; every 16th task is long
+//   fanout       one root task; its N dependents are released on a worker
+//                thread by the on-put callback (exercises local LIFO + stealing)
+//
+// Reported per run: wall time, task latency (submit -> finish) p50/p99/max,
+// and core utilization = busy time / (wall time * threads).
+//
+// Usage:  ./bench_work_stealing [threads] [tasks]   (default: 4 2000)
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "local/runtime.h"
+
+using Clock = std::chrono::steady_clock;
+
+namespace {
+
+    constexpr auto kShort = std::chrono::microseconds(50);
+    constexpr auto kLong  = std::chrono::milliseconds(5);
+
+    void spin_for(Clock::duration d) {
+        auto start = Clock::now();
+        while (Clock::now() - start < d) {
+            // busy spin
+        }
+    }
+
+    struct Sample {
+        Clock::time_point submitted;
+        Clock::time_point finished;
+        Clock::duration busy{};
+    };
+
+    struct Result {
+        double wall_ms;
+        double p50_us;
+        double p99_us;
+        double max_us;
+        double utilization;
+    };
+
+    Result summarize(const std::vector<Sample>& samples, Clock::time_point t0,
+                     Clock::time_point t1, size_t threads) {
+        std::vector<double> lat;
+        lat.reserve(samples.size());
+        Clock::duration busy{};
+        for (const auto& s : samples) {
+            lat.push_back(std::chrono::duration<double, std::micro>(s.finished - s.submitted).count());
+            busy += s.busy;
+        }
+        std::sort(lat.begin(), lat.end());
+        auto pct = [&](double p) { return lat[std::min(lat.size() - 1, size_t(p * lat.size()))]; };
+
+        double wall = std::chrono::duration<double, std::milli>(t1 - t0).count();
+        double busy_ms = std::chrono::duration<double, std::milli>(busy).count();
+        return {wall, pct(0.50), pct(0.99), lat.back(), busy_ms / (wall * double(threads))};
+    }
+
+    orion::Task timed_task(std::string id, std::vector<orion::ObjectRef> deps,
+                           Sample* sample, Clock::duration cost) {
+        return orion::Task{std::move(id), std::move(deps),
+            [sample, cost](std::vector<std::any>) -> std::any {
+                auto start = Clock::now();
+                spin_for(cost);
+                sample->finished = Clock::now();
+                sample->busy = sample->finished - start;
+                return 0;
+            }};
+    }
+
+    Clock::duration cost_of(size_t i) {
+        return (i % 16 == 0) ? Clock::duration(kLong) : Clock::duration(kShort);
+    }
+
+    Result run_independent(orion::ExecutionMode mode, size_t threads, size_t n) {
+        orion::Runtime rt(threads, mode);
+        std::vector<Sample> samples(n);
+        std::vector<orion::ObjectRef> refs;
+        refs.reserve(n);
+
+        auto t0 = Clock::now();
+        for (size_t i = 0; i < n; ++i) {
+            samples[i].submitted = Clock::now();
+            refs.push_back(rt.submit(timed_task("ind-" + std::to_string(i), {},
+                                                &samples[i], cost_of(i))));
+        }
+        for (const auto& r : refs) rt.wait(r);
+        auto t1 = Clock::now();
+
+        rt.shutdown();
+        return summarize(samples, t0, t1, threads);
+    }
+
+    Result run_fanout(orion::ExecutionMode mode, size_t threads, size_t n) {
+        orion::Runtime rt(threads, mode);
+        std::vector<Sample> samples(n);
+        std::vector<orion::ObjectRef> refs;
+        refs.reserve(n);
+
+        // Dependents first, so they are all released together by the root's put
+        for (size_t i = 0; i < n; ++i) {
+            refs.push_back(rt.submit(timed_task("fan-" + std::to_string(i),
+                                                {orion::ObjectRef{"fan-root"}},
+                                                &samples[i], cost_of(i))));
+        }
+
+        auto t0 = Clock::now();
+        rt.submit(orion::Task{"fan-root", {},
+            [&samples](std::vector<std::any>) -> std::any {
+                auto now = Clock::now();
+                for (auto& s : samples) s.submitted = now;
+                return 0;
+            }});
+        for (const auto& r : refs) rt.wait(r);
+        auto t1 = Clock::now();
+
+        rt.shutdown();
+        return summarize(samples, t0, t1, threads);
+    }
+
+    void print_row(const char* workload, const char* mode, const Result& r) {
+        std::cout << std::left << std::setw(13) << workload
+                  << std::setw(15) << mode
+                  << std::fixed << std::setprecision(1)
+                  << std::setw(11) << r.wall_ms
+                  << std::setw(11) << r.p50_us
+                  << std::setw(11) << r.p99_us
+                  << std::setw(11) << r.max_us
+                  << std::setprecision(2) << r.utilization << "\n";
+    }
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    size_t threads = (argc > 1) ? std::stoul(argv[1]) : 4;
+    size_t tasks   = (argc > 2) ? std::stoul(argv[2]) : 2000;
+
+    orion::Worker::set_verbose(false);
+
+    std::vector<std::pair<const char*, orion::ExecutionMode>> modes = {
+        {"round-robin",   orion::ExecutionMode::RoundRobin},
+        {"work-stealing", orion::ExecutionMode::WorkStealing},
+    };
+
+    std::vector<std::pair<const char*, Result>> rows;
+    for (const auto& [name, mode] : modes) {
+        rows.emplace_back(name, run_independent(mode, threads, tasks));
+    }
+    for (const auto& [name, mode] : modes) {
+        rows.emplace_back(name, run_fanout(mode, threads, tasks));
+    }
+
+    std::cout << "\n" << threads << " threads, " << tasks << " tasks, 1/16 long ("
+              << std::chrono::duration_cast<std::chrono::milliseconds>(kLong).count()
+              << " ms) vs short ("
+              << std::chrono::duration_cast<std::chrono::microseconds>(kShort).count()
+              << " us)\n\n";
+    std::cout << std::left << std::setw(13) << "workload" << std::setw(15) << "mode"
+              << std::setw(11) << "wall ms" << std::setw(11) << "p50 us"
+              << std::setw(11) << "p99 us" << std::setw(11) << "max us"
+              << "util\n";
+    for (size_t i = 0; i < rows.size(); ++i) {
+        print_row(i < modes.size() ? "independent" : "fanout", rows[i].first, rows[i].second);
+    }
+    return 0;
+}
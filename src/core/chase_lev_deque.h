@@ -0,0 +1,138 @@
+// chase_lev_deque.h — lock-free work-stealing deque (Chase & Lev, 2005)
+//
+// Memory orderings follow Lê, Pop, Cohen & Zappa Nardelli,
+// "Correct and Efficient Work-Stealing for Weak Memory Models" (PPoPP '13).
+//
+// - push/pop are called only by the owning thread and operate on the bottom (LIFO)
+// - steal may be called by any thread and takes from the top (FIFO)
+// - T must be trivially copyable (we store raw pointers)
+//
+// Grown buffers are retired, not freed, because a thief may still be reading
+// the old one; they are released when the deque is destroyed.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+namespace orion {
+
+    template <typename T>
+    class ChaseLevDeque {
+        static_assert(std::is_trivially_copyable_v<T>,
+                      "ChaseLevDeque stores elements in std::atomic<T>");
+
+        struct Buffer {
+            explicit Buffer(int64_t capacity)
+                : capacity(capacity), mask(capacity - 1),
+                  slots(std::make_unique<std::atomic<T>[]>(capacity)) {}
+
+            T get(int64_t i) const { return slots[i & mask].load(std::memory_order_relaxed); }
+            void put(int64_t i, T v) { slots[i & mask].store(v, std::memory_order_relaxed); }
+
+            int64_t capacity;
+            int64_t mask;
+            std::unique_ptr<std::atomic<T>[]> slots;
+        };
+
+    public:
+        // capacity must be a power of two
+        explicit ChaseLevDeque(int64_t capacity = 256) {
+            retired_.push_back(std::make_unique<Buffer>(capacity));
+            buffer_.store(retired_.back().get(), std::memory_order_relaxed);
+        }
+
+        ChaseLevDeque(const ChaseLevDeque&) = delete;
+        ChaseLevDeque& operator=(const ChaseLevDeque&) = delete;
+
+        // Owner only
+        void push(T item) {
+            int64_t b = bottom_.load(std::memory_order_relaxed);
+            int64_t t = top_.load(std::memory_order_acquire);
+            Buffer* buf = buffer_.load(std::memory_order_relaxed);
+
+            if (b - t > buf->capacity - 1) {
+                buf = grow(buf, t, b);
+            }
+            buf->put(b, item);
+            std::atomic_thread_fence(std::memory_order_release);
+            bottom_.store(b + 1, std::memory_order_relaxed);
+        }
+
+        // Owner only — newest item first
+        std::optional<T> pop() {
+            int64_t b = bottom_.load(std::memory_order_relaxed) - 1;
+            Buffer* buf = buffer_.load(std::memory_order_relaxed);
+            bottom_.store(b, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            int64_t t = top_.load(std::memory_order_relaxed);
+
+            if (t > b) {
+                // empty
+                bottom_.store(b + 1, std::memory_order_relaxed);
+                return std::nullopt;
+            }
+
+            T item = buf->get(b);
+            if (t == b) {
+                // last element: race against thieves for it
+                bool won = top_.compare_exchange_strong(t, t + 1,
+                                                        std::memory_order_seq_cst,
+                                                        std::memory_order_relaxed);
+                bottom_.store(b + 1, std::memory_order_relaxed);
+                if (!won) return std::nullopt;
+            }
+            return item;
+        }
+
+        // Any thread — oldest item first. Returns nullopt when empty or
+        // when another thief won the race; callers just move on.
+        std::optional<T> steal() {
+            int64_t t = top_.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            int64_t b = bottom_.load(std::memory_order_acquire);
+
+            if (t >= b) return std::nullopt;
+
+            Buffer* buf = buffer_.load(std::memory_order_acquire);
+            T item = buf->get(t);
+            if (!top_.compare_exchange_strong(t, t + 1,
+                                              std::memory_order_seq_cst,
+                                              std::memory_order_relaxed)) {
+                return std::nullopt;
+            }
+            return item;
+        }
+
+        // Approximate; safe to call from any thread
+        int64_t size() const {
+            int64_t b = bottom_.load(std::memory_order_relaxed);
+            int64_t t = top_.load(std::memory_order_relaxed);
+            return b > t ? b - t : 0;
+        }
+
+    private:
+        Buffer* grow(Buffer* old, int64_t t, int64_t b) {
+            auto bigger = std::make_unique<Buffer>(old->capacity * 2);
+            for (int64_t i = t; i < b; ++i) {
+                bigger->put(i, old->get(i));
+            }
+            Buffer* raw = bigger.get();
+            retired_.push_back(std::move(bigger));
+            buffer_.store(raw, std::memory_order_release);
+            return raw;
+        }
+
+        alignas(64) std::atomic<int64_t> top_{0};
+        alignas(64) std::atomic<int64_t> bottom_{0};
+        std::atomic<Buffer*> buffer_{nullptr};
+
+        // Owner-only; keeps every buffer alive for the deque's lifetime
+        std::vector<std::unique_ptr<Buffer>> retired_;
+    };
+
+} // namespace orion
@@ -0,0 +1,135 @@
+// co_task.h — C++20 coroutine tasks that can co_await ObjectRefs
+//
+//   orion::CoTask add_one(orion::ObjectRef in) {
+//       int a = orion::object_cast<int>(co_await in);   // suspends if `in` is missing
+//       co_return a + 1;
+//   }
+//
+//   auto ref = rt.submit("B", add_one(orion::ObjectRef{"A"}));
+//
+// A coroutine waiting on a missing object parks itself in an ObjectStore
+// continuation and gives its worker thread back. When the object is put the
+// continuation posts the resumption to the executor, so any number of
+// logical tasks can be in flight on a fixed pool of threads.
+//
+// The co_return value is put into the store under the task's id, which
+// releases dependents exactly like a regular Task result. An exception that
+// escapes the body (its own, or one rethrown by co_await on a failed object)
+// fails that id instead (ObjectStore::put_error).
+
+#pragma once
+
+#include <any>
+#include <coroutine>
+#include <exception>
+#include <functional>
+#include <utility>
+
+#include "object_ref.h"
+#include "object_store.h"
+
+namespace orion {
+
+    class CoTask {
+    public:
+        using Executor = std::function<void(std::function<void()>)>;
+
+        struct promise_type;
+        using Handle = std::coroutine_handle<promise_type>;
+
+        // Suspends until the awaited object is in the store
+        struct ObjectAwaiter {
+            promise_type& promise;
+            ObjectRef ref;
+
+            bool await_ready() const { return promise.store->resident(ref.id); }
+
+            bool await_suspend(Handle h) const {
+                Executor executor = promise.executor;
+                // false => object landed while registering; resume immediately
+                return promise.store->when_ready(ref.id, [executor, h] {
+                    executor([h] { h.resume(); });
+                });
+            }
+
+            // Shared, zero-copy view of the object
+            ObjectHandle await_resume() const { return promise.store->get_handle_blocking(ref.id); }
+        };
+
+        // Publishes the result (or the failure) and frees the frame
+        struct FinalAwaiter {
+            bool await_ready() const noexcept { return false; }
+
+            void await_suspend(Handle h) const noexcept {
+                ObjectStore* store = h.promise().store;
+                ObjectId id = std::move(h.promise().id);
+                std::any result = std::move(h.promise().result);
+                std::exception_ptr error = std::move(h.promise().error);
+                h.destroy();
+                // After destroy: put may run dependents inline on this thread
+                if (error) {
+                    store->put_error(id, std::move(error));
+                } else {
+                    store->put(id, std::move(result));
+                }
+            }
+
+            void await_resume() const noexcept {}
+        };
+
+        struct promise_type {
+            ObjectStore* store = nullptr;
+            ObjectId id;
+            Executor executor;
+            std::any result;
+            std::exception_ptr error;
+
+            CoTask get_return_object() { return CoTask(Handle::from_promise(*this)); }
+            std::suspend_always initial_suspend() noexcept { return {}; }
+            FinalAwaiter final_suspend() noexcept { return {}; }
+
+            void return_value(std::any value) { result = std::move(value); }
+
+            // Same as a throwing Task::work: the output fails, the thread
+            // that resumed the coroutine carries on
+            void unhandled_exception() { error = std::current_exception(); }
+
+            ObjectAwaiter await_transform(ObjectRef ref) { return {*this, std::move(ref)}; }
+
+            template <typename Awaitable>
+            Awaitable&& await_transform(Awaitable&& a) { return std::forward<Awaitable>(a); }
+        };
+
+        CoTask(CoTask&& other) noexcept : handle_(std::exchange(other.handle_, {})) {}
+        CoTask& operator=(CoTask&& other) noexcept {
+            if (this != &other) {
+                if (handle_) handle_.destroy();
+                handle_ = std::exchange(other.handle_, {});
+            }
+            return *this;
+        }
+        CoTask(const CoTask&) = delete;
+        CoTask& operator=(const CoTask&) = delete;
+
+        // A task that was never launched still owns its frame
+        ~CoTask() {
+            if (handle_) handle_.destroy();
+        }
+
+        // Bind the task to a store/output id and schedule its first resume.
+        // From here on the frame owns itself and is destroyed at co_return.
+        void launch(ObjectStore& store, ObjectId id, Executor executor) && {
+            Handle h = std::exchange(handle_, {});
+            h.promise().store = &store;
+            h.promise().id = std::move(id);
+            h.promise().executor = executor;
+            executor([h] { h.resume(); });
+        }
+
+    private:
+        explicit CoTask(Handle h) : handle_(h) {}
+
+        Handle handle_;
+    };
+
+} // namespace orion
@@ -0,0 +1,125 @@
+// flat_table.h — open-addressing hash table (linear probing)
+//
+// Used for the ObjectStore shards. Entries live in one contiguous array, so a
+// lookup is a hash, a mask and a short forward scan with no pointer chasing.
+// Erased entries leave tombstones, which are dropped on the next rehash.
+//
+// Not thread-safe; callers lock around it.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace orion {
+
+    template <typename K, typename V, typename Hash = std::hash<K>>
+    class FlatTable {
+    public:
+        explicit FlatTable(size_t initial_capacity = 16) {
+            size_t cap = 16;
+            while (cap < initial_capacity) cap <<= 1;
+            slots_.resize(cap);
+        }
+
+        V* find(const K& key) {
+            return find_hashed(key, Hash{}(key));
+        }
+
+        V* find_hashed(const K& key, size_t hash) {
+            const size_t mask = slots_.size() - 1;
+            for (size_t i = hash & mask;; i = (i + 1) & mask) {
+                Slot& s = slots_[i];
+                if (s.state == State::Empty) return nullptr;
+                if (s.state == State::Full && s.hash == hash && s.entry->first == key) {
+                    return &s.entry->second;
+                }
+            }
+        }
+
+        // Returns true if the key was newly inserted
+        bool insert_or_assign(const K& key, V value) {
+            return insert_or_assign_hashed(key, Hash{}(key), std::move(value));
+        }
+
+        bool insert_or_assign_hashed(const K& key, size_t hash, V value) {
+            if (V* existing = find_hashed(key, hash)) {
+                *existing = std::move(value);
+                return false;
+            }
+            if ((used_ + 1) * 10 > slots_.size() * 7) {
+                // Grow only if live entries need it; otherwise just purge tombstones
+                rehash(size_ * 10 >= slots_.size() * 5 ? slots_.size() * 2 : slots_.size());
+            }
+            place(hash, std::pair<K, V>(key, std::move(value)));
+            ++size_;
+            return true;
+        }
+
+        bool erase(const K& key) {
+            return erase_hashed(key, Hash{}(key));
+        }
+
+        bool erase_hashed(const K& key, size_t hash) {
+            const size_t mask = slots_.size() - 1;
+            for (size_t i = hash & mask;; i = (i + 1) & mask) {
+                Slot& s = slots_[i];
+                if (s.state == State::Empty) return false;
+                if (s.state == State::Full && s.hash == hash && s.entry->first == key) {
+                    s.state = State::Tombstone;
+                    s.entry.reset();
+                    --size_;
+                    return true;
+                }
+            }
+        }
+
+        size_t size() const { return size_; }
+
+        template <typename Fn>
+        void for_each(Fn&& fn) {
+            for (auto& s : slots_) {
+                if (s.state == State::Full) fn(s.entry->first, s.entry->second);
+            }
+        }
+
+    private:
+        enum class State : uint8_t { Empty, Full, Tombstone };
+
+        struct Slot {
+            State state = State::Empty;
+            size_t hash = 0;
+            std::optional<std::pair<K, V>> entry;
+        };
+
+        // Caller guarantees the key is absent and there is room
+        void place(size_t hash, std::pair<K, V>&& entry) {
+            const size_t mask = slots_.size() - 1;
+            size_t i = hash & mask;
+            while (slots_[i].state == State::Full) i = (i + 1) & mask;
+            if (slots_[i].state == State::Empty) ++used_;
+            slots_[i].state = State::Full;
+            slots_[i].hash = hash;
+            slots_[i].entry.emplace(std::move(entry));
+        }
+
+        void rehash(size_t new_capacity) {
+            std::vector<Slot> old = std::move(slots_);
+            slots_.clear();
+            slots_.resize(new_capacity);
+            used_ = 0;
+            for (auto& s : old) {
+                if (s.state == State::Full) place(s.hash, std::move(*s.entry));
+            }
+        }
+
+        std::vector<Slot> slots_;
+        size_t size_ = 0;   // live entries
+        size_t used_ = 0;   // live entries + tombstones
+    };
+
+} // namespace orion
@@ -0,0 +1,174 @@
+// inline_vector.h — vector with inline capacity for the first N elements
+//
+// Task dependency lists are almost always short; keeping the first N refs
+// inside the Task means building and moving a typical task does not touch
+// the heap. Grows onto the heap past N like a std::vector.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace orion {
+
+    template <typename T, size_t N>
+    class InlineVector {
+        static_assert(N > 0, "InlineVector needs at least one inline slot");
+
+    public:
+        using value_type = T;
+        using size_type = size_t;
+        using iterator = T*;
+        using const_iterator = const T*;
+        using reference = T&;
+        using const_reference = const T&;
+
+        InlineVector() noexcept = default;
+
+        InlineVector(std::initializer_list<T> init) {
+            reserve(init.size());
+            for (const T& v : init) push_back(v);
+        }
+
+        // Interop with code that builds a plain std::vector first
+        InlineVector(std::vector<T> v) {
+            reserve(v.size());
+            for (T& x : v) push_back(std::move(x));
+        }
+
+        InlineVector(const InlineVector& other) {
+            reserve(other.size_);
+            for (const T& v : other) push_back(v);
+        }
+
+        InlineVector(InlineVector&& other) noexcept(std::is_nothrow_move_constructible_v<T>) {
+            steal(other);
+        }
+
+        InlineVector& operator=(const InlineVector& other) {
+            if (this != &other) {
+                clear();
+                reserve(other.size_);
+                for (const T& v : other) push_back(v);
+            }
+            return *this;
+        }
+
+        InlineVector& operator=(InlineVector&& other) noexcept(std::is_nothrow_move_constructible_v<T>) {
+            if (this != &other) {
+                clear();
+                release_heap();
+                steal(other);
+            }
+            return *this;
+        }
+
+        ~InlineVector() {
+            clear();
+            release_heap();
+        }
+
+        size_t size() const noexcept { return size_; }
+        size_t capacity() const noexcept { return capacity_; }
+        bool empty() const noexcept { return size_ == 0; }
+
+        T* data() noexcept { return data_; }
+        const T* data() const noexcept { return data_; }
+
+        iterator begin() noexcept { return data_; }
+        iterator end() noexcept { return data_ + size_; }
+        const_iterator begin() const noexcept { return data_; }
+        const_iterator end() const noexcept { return data_ + size_; }
+
+        T& operator[](size_t i) noexcept { return data_[i]; }
+        const T& operator[](size_t i) const noexcept { return data_[i]; }
+
+        T& at(size_t i) {
+            if (i >= size_) throw std::out_of_range("InlineVector::at");
+            return data_[i];
+        }
+        const T& at(size_t i) const {
+            if (i >= size_) throw std::out_of_range("InlineVector::at");
+            return data_[i];
+        }
+
+        T& front() noexcept { return data_[0]; }
+        T& back() noexcept { return data_[size_ - 1]; }
+        const T& front() const noexcept { return data_[0]; }
+        const T& back() const noexcept { return data_[size_ - 1]; }
+
+        void reserve(size_t n) {
+            if (n > capacity_) grow(n);
+        }
+
+        void push_back(const T& v) { emplace_back(v); }
+        void push_back(T&& v) { emplace_back(std::move(v)); }
+
+        template <typename... A>
+        T& emplace_back(A&&... args) {
+            if (size_ == capacity_) {
+                // Construct first: args may alias an element about to move
+                T tmp(std::forward<A>(args)...);
+                grow(capacity_ * 2);
+                return *::new (static_cast<void*>(data_ + size_++)) T(std::move(tmp));
+            }
+            return *::new (static_cast<void*>(data_ + size_++)) T(std::forward<A>(args)...);
+        }
+
+        void pop_back() noexcept { data_[--size_].~T(); }
+
+        void clear() noexcept {
+            std::destroy(data_, data_ + size_);
+            size_ = 0;
+        }
+
+    private:
+        T* inline_data() noexcept { return reinterpret_cast<T*>(inline_); }
+        bool on_heap() const noexcept { return capacity_ > N; }
+
+        void grow(size_t n) {
+            T* fresh = static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t{alignof(T)}));
+            std::uninitialized_move(data_, data_ + size_, fresh);
+            std::destroy(data_, data_ + size_);
+            release_heap();
+            data_ = fresh;
+            capacity_ = n;
+        }
+
+        void release_heap() noexcept {
+            if (on_heap()) {
+                ::operator delete(data_, std::align_val_t{alignof(T)});
+            }
+            data_ = inline_data();
+            capacity_ = N;
+        }
+
+        void steal(InlineVector& other) {
+            if (other.on_heap()) {
+                data_ = other.data_;
+                capacity_ = other.capacity_;
+                size_ = other.size_;
+                other.data_ = other.inline_data();
+                other.capacity_ = N;
+                other.size_ = 0;
+                return;
+            }
+            std::uninitialized_move(other.data_, other.data_ + other.size_, data_);
+            size_ = other.size_;
+            other.clear();
+        }
+
+        alignas(T) unsigned char inline_[N * sizeof(T)];
+        T* data_ = inline_data();
+        size_t size_ = 0;
+        size_t capacity_ = N;
+    };
+
+} // namespace orion
@@ -56,8 +56,8 @@ int main() {
 
     auto t0 = steady_clock::now();
 
-    scheduler.submit(t1);
-    scheduler.submit(t2);
+    scheduler.submit(std::move(t1));
+    scheduler.submit(std::move(t2));
     scheduler.schedule();
 
     // Block until both complete
@@ -0,0 +1,216 @@
+// object_codec.h — byte encodings for stored payload types
+//
+// The ObjectStore holds type-erased std::any payloads. A type registered here
+// can be sized and turned into bytes and back, which is what lets the store
+// account it against a memory budget, spill it to disk and send it to another
+// node. Unregistered types keep working; they just always stay in memory and
+// on the node that produced them.
+//
+// The codec name identifies a type across processes: a receiver looks the
+// codec up by the name the sender attached.
+//
+// Common scalars, std::string and vectors of arithmetic types are registered
+// up front. Register your own with register_type / register_trivial /
+// register_vector before the first put of that type.
+
+#pragma once
+
+#include <any>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <typeindex>
+#include <unordered_map>
+#include <vector>
+#include <cstdint>
+
+namespace orion {
+
+    class ObjectCodec {
+    public:
+        struct Entry {
+            std::string name;
+            std::function<size_t(const std::any&)> size;                  // payload bytes
+            std::function<void(const std::any&, std::string& out)> encode; // appends to out
+            std::function<std::any(std::string_view bytes)> decode;
+
+            // Optional, for payloads held as one contiguous run of bytes that
+            // is exactly their encoding (scalars, strings, vectors of trivial
+            // types). Object transfer then reads and writes the payload in
+            // place instead of going through an encoded copy.
+            std::function<std::string_view(const std::any&)> view;
+            // Make `value` a payload of `bytes` encoded bytes and return where
+            // they go (valid until `value` is moved or changed); nullptr if no
+            // payload of this type has that size, and only then (0 included).
+            // A receiver fails the transfer on nullptr rather than decode.
+            std::function<char*(std::any& value, size_t bytes)> prepare;
+        };
+
+        // First registration of a type wins; returns false if it already had one
+        static bool register_type(std::type_index type, Entry entry) {
+            Registry& r = registry();
+            std::unique_lock<std::shared_mutex> lock(r.mutex);
+            return add_locked(r, type, std::move(entry));
+        }
+
+        // Trivially copyable T, stored as its raw bytes
+        template <typename T>
+        static bool register_trivial(std::string name) {
+            return register_type(typeid(T), trivial_entry<T>(std::move(name)));
+        }
+
+        // std::vector<T> of trivially copyable T, stored as the element bytes
+        template <typename T>
+        static bool register_vector(std::string name) {
+            return register_type(typeid(std::vector<T>), vector_entry<T>(std::move(name)));
+        }
+
+        // nullptr if the type has no codec. Entries are never removed, so the
+        // pointer stays valid for the life of the process.
+        static const Entry* find(std::type_index type) {
+            Registry& r = registry();
+            std::shared_lock<std::shared_mutex> lock(r.mutex);
+            auto it = r.entries.find(type);
+            return it == r.entries.end() ? nullptr : it->second.get();
+        }
+
+        // Codec registered under `name`; nullptr if there is none
+        static const Entry* find_by_name(std::string_view name) {
+            Registry& r = registry();
+            std::shared_lock<std::shared_mutex> lock(r.mutex);
+            auto it = r.by_name.find(std::string(name));
+            return it == r.by_name.end() ? nullptr : it->second;
+        }
+
+        // Bytes a payload accounts for: its codec size, or sizeof(std::any)
+        // for types without a codec
+        static size_t size_of(const std::any& value) {
+            if (const Entry* codec = find(value.type())) return codec->size(value);
+            return sizeof(std::any);
+        }
+
+    private:
+        struct Registry {
+            std::shared_mutex mutex;
+            std::unordered_map<std::type_index, std::unique_ptr<const Entry>> entries;
+            std::unordered_map<std::string, const Entry*> by_name;   // first name wins
+        };
+
+        static bool add_locked(Registry& r, std::type_index type, Entry entry) {
+            auto [it, added] = r.entries.emplace(type, std::make_unique<const Entry>(std::move(entry)));
+            if (added) r.by_name.emplace(it->second->name, it->second.get());
+            return added;
+        }
+
+        static Registry& registry() {
+            static Registry* r = [] {
+                auto* reg = new Registry;   // leaked: codecs outlive every store
+                install_builtins(*reg);
+                return reg;
+            }();
+            return *r;
+        }
+
+        template <typename T>
+        static Entry trivial_entry(std::string name) {
+            static_assert(std::is_trivially_copyable_v<T>);
+            return Entry{
+                std::move(name),
+                [](const std::any&) { return sizeof(T); },
+                [](const std::any& v, std::string& out) {
+                    const T& x = std::any_cast<const T&>(v);
+                    out.append(reinterpret_cast<const char*>(&x), sizeof(T));
+                },
+                [](std::string_view bytes) {
+                    if (bytes.size() != sizeof(T)) {
+                        throw std::invalid_argument("trivial codec: " + std::to_string(bytes.size()) +
+                                                    " bytes for a " + std::to_string(sizeof(T)) +
+                                                    "-byte type");
+                    }
+                    T x;
+                    std::memcpy(&x, bytes.data(), sizeof(T));
+                    return std::any(x);
+                },
+                [](const std::any& v) {
+                    return std::string_view(reinterpret_cast<const char*>(std::any_cast<T>(&v)),
+                                            sizeof(T));
+                },
+                [](std::any& v, size_t bytes) -> char* {
+                    if (bytes != sizeof(T)) return nullptr;
+                    return reinterpret_cast<char*>(&v.emplace<T>());
+                }};
+        }
+
+        template <typename T>
+        static Entry vector_entry(std::string name) {
+            static_assert(std::is_trivially_copyable_v<T>);
+            return Entry{
+                std::move(name),
+                [](const std::any& v) {
+                    return std::any_cast<const std::vector<T>&>(v).size() * sizeof(T);
+                },
+                [](const std::any& v, std::string& out) {
+                    const auto& xs = std::any_cast<const std::vector<T>&>(v);
+                    out.append(reinterpret_cast<const char*>(xs.data()), xs.size() * sizeof(T));
+                },
+                [](std::string_view bytes) {
+                    if (bytes.size() % sizeof(T) != 0) {
+                        throw std::invalid_argument("vector codec: " + std::to_string(bytes.size()) +
+                                                    " bytes is not a whole number of elements");
+                    }
+                    std::vector<T> xs(bytes.size() / sizeof(T));
+                    std::memcpy(xs.data(), bytes.data(), xs.size() * sizeof(T));
+                    return std::any(std::move(xs));
+                },
+                [](const std::any& v) {
+                    const auto& xs = std::any_cast<const std::vector<T>&>(v);
+                    return std::string_view(reinterpret_cast<const char*>(xs.data()),
+                                            xs.size() * sizeof(T));
+                },
+                [](std::any& v, size_t bytes) -> char* {
+                    if (bytes % sizeof(T) != 0) return nullptr;
+                    auto& xs = v.emplace<std::vector<T>>(bytes / sizeof(T));
+                    // An empty vector may have no data(); nullptr means a bad size
+                    if (xs.empty()) xs.reserve(1);
+                    return reinterpret_cast<char*>(xs.data());
+                }};
+        }
+
+        static void install_builtins(Registry& r) {
+            auto add = [&r](std::type_index type, Entry entry) {
+                add_locked(r, type, std::move(entry));
+            };
+
+            add(typeid(bool),     trivial_entry<bool>("bool"));
+            add(typeid(int),      trivial_entry<int>("int"));
+            add(typeid(int64_t),  trivial_entry<int64_t>("int64"));
+            add(typeid(uint64_t), trivial_entry<uint64_t>("uint64"));
+            add(typeid(float),    trivial_entry<float>("float"));
+            add(typeid(double),   trivial_entry<double>("double"));
+
+            add(typeid(std::vector<int>),     vector_entry<int>("vector<int>"));
+            add(typeid(std::vector<int64_t>), vector_entry<int64_t>("vector<int64>"));
+            add(typeid(std::vector<float>),   vector_entry<float>("vector<float>"));
+            add(typeid(std::vector<double>),  vector_entry<double>("vector<double>"));
+            add(typeid(std::vector<uint8_t>), vector_entry<uint8_t>("vector<uint8>"));
+            add(typeid(std::vector<char>),    vector_entry<char>("vector<char>"));
+
+            add(typeid(std::string), Entry{
+                "string",
+                [](const std::any& v) { return std::any_cast<const std::string&>(v).size(); },
+                [](const std::any& v, std::string& out) { out += std::any_cast<const std::string&>(v); },
+                [](std::string_view bytes) { return std::any(std::string(bytes)); },
+                [](const std::any& v) { return std::string_view(std::any_cast<const std::string&>(v)); },
+                [](std::any& v, size_t bytes) -> char* {
+                    return v.emplace<std::string>(bytes, '\0').data();
+                }});
+        }
+    };
+
+} // namespace orion
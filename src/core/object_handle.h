@@ -0,0 +1,25 @@
+// object_handle.h — shared, immutable view of a stored object
+//
+// The ObjectStore keeps every value behind a shared_ptr<const std::any>.
+// Readers that take an ObjectHandle share the stored payload instead of
+// copying it, and the payload stays alive for as long as any handle does.
+
+#pragma once
+
+#include <any>
+#include <memory>
+
+namespace orion {
+
+    using ObjectHandle = std::shared_ptr<const std::any>;
+
+    // Typed, non-copying access to a handle's payload.
+    // Throws std::bad_any_cast on a type mismatch or an empty handle.
+    template <typename T>
+    const T& object_cast(const ObjectHandle& handle) {
+        const T* value = handle ? std::any_cast<T>(handle.get()) : nullptr;
+        if (!value) throw std::bad_any_cast();
+        return *value;
+    }
+
+} // namespace orion
@@ -0,0 +1,79 @@
+// object_id.cpp — interning table and id generation
+
+#include "object_id.h"
+
+#include <atomic>
+#include <mutex>
+#include <ostream>
+#include <shared_mutex>
+#include <stdexcept>
+#include <unordered_map>
+
+namespace orion {
+
+    namespace {
+
+#ifdef ORION_KEEP_NAMES
+        constexpr bool kKeepNames = true;
+#else
+        constexpr bool kKeepNames = false;
+#endif
+
+        struct Names {
+            std::shared_mutex mutex;
+            std::unordered_map<uint64_t, std::string> by_value;
+            std::atomic<bool> keep{kKeepNames};
+            std::atomic<uint64_t> next_generated{1};
+        };
+
+        // Leaked, so ids can still be printed during static destruction
+        Names& names() {
+            static Names* n = new Names();
+            return *n;
+        }
+
+    } // namespace
+
+    ObjectId ObjectId::generate() noexcept {
+        return from_value(kGeneratedBit |
+                          names().next_generated.fetch_add(1, std::memory_order_relaxed));
+    }
+
+    void ObjectId::intern(uint64_t value, std::string_view name) {
+        Names& n = names();
+        if (!n.keep.load(std::memory_order_relaxed)) return;
+        {
+            std::shared_lock<std::shared_mutex> lock(n.mutex);
+            auto it = n.by_value.find(value);
+            if (it != n.by_value.end()) {
+                if (it->second == name) return;
+                throw std::invalid_argument("ObjectId collision: '" + std::string(name) +
+                                            "' and '" + it->second + "'");
+            }
+        }
+        std::unique_lock<std::shared_mutex> lock(n.mutex);
+        n.by_value.try_emplace(value, name);
+    }
+
+    std::string ObjectId::name() const {
+        {
+            Names& n = names();
+            std::shared_lock<std::shared_mutex> lock(n.mutex);
+            auto it = n.by_value.find(value_);
+            if (it != n.by_value.end()) return it->second;
+        }
+        static constexpr char kHex[] = "0123456789abcdef";
+        std::string out(17, '#');
+        for (int i = 0; i < 16; ++i) out[16 - i] = kHex[(value_ >> (4 * i)) & 0xf];
+        return out;
+    }
+
+    void ObjectId::set_keep_names(bool keep) noexcept {
+        names().keep.store(keep, std::memory_order_relaxed);
+    }
+
+    std::ostream& operator<<(std::ostream& os, ObjectId id) {
+        return os << id.name();
+    }
+
+} // namespace orion
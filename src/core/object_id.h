@@ -0,0 +1,100 @@
+// object_id.h — compact 64-bit object / task identifiers
+//
+// An ObjectId is a single uint64_t: hashing is a multiply-xorshift, equality
+// is one compare, and it travels as a fixed64 on the wire.
+//
+// Named ids ("A", "task-7") are derived from the name with a fixed hash, so
+// every process maps a name to the same id without talking to the others.
+// In debug builds (ORION_KEEP_NAMES) the name is also recorded in a
+// process-wide table (the interning table), which is only read to print ids
+// in logs and to catch hash collisions. The table never shrinks, so other
+// builds leave it off unless set_keep_names(true) is called. Unknown names,
+// including every id that arrives over the wire, print as "#<hex>".
+//
+// Generated ids (ObjectId::generate) never collide with named ones: named
+// ids have the top bit clear, generated ids have it set. A generated id is
+// unique within its process only.
+
+#pragma once
+
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iosfwd>
+#include <string>
+#include <string_view>
+
+namespace orion {
+
+    class ObjectId {
+    public:
+        constexpr ObjectId() noexcept = default;   // null id
+
+        // Named id; records the name for debugging while names are kept
+        ObjectId(std::string_view name) : value_(hash_name(name)) { intern(value_, name); }
+        ObjectId(const std::string& name) : ObjectId(std::string_view(name)) {}
+        ObjectId(const char* name) : ObjectId(std::string_view(name)) {}
+
+        // Id received from elsewhere (wire, disk); not interned
+        static constexpr ObjectId from_value(uint64_t value) noexcept {
+            ObjectId id;
+            id.value_ = value;
+            return id;
+        }
+
+        // Fresh id, unique within this process; no name is recorded
+        static ObjectId generate() noexcept;
+
+        constexpr uint64_t value() const noexcept { return value_; }
+        constexpr explicit operator bool() const noexcept { return value_ != 0; }
+
+        // The interned name, or "#<16 hex digits>" if it is not known here
+        std::string name() const;
+
+        // Start (or stop) recording names. Off by default outside debug
+        // builds: with a distinct name per task, a long-running process
+        // would grow the table by one entry per task.
+        static void set_keep_names(bool keep) noexcept;
+
+        friend constexpr bool operator==(ObjectId, ObjectId) noexcept = default;
+        friend constexpr auto operator<=>(ObjectId, ObjectId) noexcept = default;
+
+        // FNV-1a, finalised with the murmur3 mixer; top bit cleared, never 0
+        static constexpr uint64_t hash_name(std::string_view name) noexcept {
+            uint64_t h = 0xcbf29ce484222325ULL;
+            for (char c : name) {
+                h ^= static_cast<unsigned char>(c);
+                h *= 0x100000001b3ULL;
+            }
+            h = mix(h) & ~kGeneratedBit;
+            return h ? h : 1;
+        }
+
+        static constexpr uint64_t mix(uint64_t h) noexcept {
+            h ^= h >> 33;
+            h *= 0xff51afd7ed558ccdULL;
+            h ^= h >> 33;
+            h *= 0xc4ceb9fe1a85ec53ULL;
+            h ^= h >> 33;
+            return h;
+        }
+
+    private:
+        static constexpr uint64_t kGeneratedBit = 1ULL << 63;
+
+        static void intern(uint64_t value, std::string_view name);
+
+        uint64_t value_ = 0;
+    };
+
+    std::ostream& operator<<(std::ostream& os, ObjectId id);
+
+} // namespace orion
+
+template <>
+struct std::hash<orion::ObjectId> {
+    size_t operator()(orion::ObjectId id) const noexcept {
+        return size_t(orion::ObjectId::mix(id.value()));
+    }
+};
@@ -6,14 +6,19 @@
 #define OBJECT_REF_H
 
 
-#include <string>
+#include <memory>
 
-namespace orion {
+#include "object_id.h"
 
-    using ObjectId = std::string;
+namespace orion {
 
     struct ObjectRef {
         ObjectId id;
+
+        // Set on refs handed out by a reference-counting Runtime: the object
+        // stays alive while any copy of this ref (or a pending task using it)
+        // exists. Plain refs built from an id leave it null.
+        std::shared_ptr<const void> owner = nullptr;
     };
 }
 
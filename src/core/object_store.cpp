@@ -3,47 +3,597 @@
 //
 
 #include "object_store.h"
+#include "slab_pool.h"
+
+#include <algorithm>
+#include <stdexcept>
 
 
 namespace orion {
 
+    // Shared by every copy of one owning ObjectRef
+    struct ObjectStore::Owner {
+        std::weak_ptr<Lifetime> lifetime;
+        ObjectId id;
+
+        Owner(std::weak_ptr<Lifetime> lifetime, ObjectId id)
+            : lifetime(std::move(lifetime)), id(std::move(id)) {}
+
+        ~Owner() {
+            auto life = lifetime.lock();
+            if (!life) return;
+
+            ObjectHandle payload;
+            {
+                std::shared_lock<std::shared_mutex> lock(life->mutex);
+                if (life->store) {
+                    life->store->drop_holder(id, payload);
+                }
+            }
+            // The payload may own further refs; let it go after unlocking
+        }
+    };
+
+    ObjectStore::ObjectStore()
+        : lifetime_(std::make_shared<Lifetime>()) {
+        lifetime_->store = this;
+    }
+
+    ObjectStore::~ObjectStore() {
+        // Waits out any token destructor that is mid-release
+        std::unique_lock<std::shared_mutex> lock(lifetime_->mutex);
+        lifetime_->store = nullptr;
+    }
+
+    ObjectStore::Shard& ObjectStore::shard_for(const ObjectId& id, size_t& hash) {
+        hash = std::hash<ObjectId>{}(id);
+        // Fibonacci hashing on the top bits; the table inside the shard uses
+        // the low bits, so the two never correlate.
+        size_t index = (uint64_t(hash) * 0x9E3779B97F4A7C15ULL) >> 58;
+        static_assert(kShards == 64, "shard index uses the top 6 bits");
+        return shards_[index];
+    }
+
     void ObjectStore::put(const ObjectId& id, std::any value) {
+        put_handle(id, std::allocate_shared<const std::any>(SlabAllocator<std::any>{}, std::move(value)));
+    }
+
+    void ObjectStore::put_handle(const ObjectId& id, ObjectHandle value) {
+        // Sizing is only needed for the memory budget and the put observer
+        const ObjectCodec::Entry* codec = nullptr;
+        size_t bytes = 0;
+        if (spill_ || put_observer_) {
+            codec = ObjectCodec::find(value->type());
+            bytes = codec ? codec->size(*value) : sizeof(std::any);
+        }
+        Entry entry(std::move(value), bytes, 0);
+        entry.codec = codec;
+        publish(id, std::move(entry));
+    }
+
+    void ObjectStore::put_error(const ObjectId& id, std::exception_ptr error) {
+        Entry entry;
+        entry.error = std::move(error);
+        publish(id, std::move(entry));
+    }
+
+    void ObjectStore::publish(const ObjectId& id, Entry entry) {
+        const bool sized = spill_ || put_observer_;
+        const size_t bytes = entry.bytes;
+
+        std::vector<Continuation> ready;
+        std::optional<SpillLocation> stale;
+        bool freed = false;
         {
-            std::lock_guard<std::mutex> lock(mutex_);
-            store_[id] = std::move(value);
+            size_t hash;
+            Shard& shard = shard_for(id, hash);
+            std::unique_lock<std::shared_mutex> lock(shard.mutex);
+
+            // Every holder let go before it was produced: drop it on arrival
+            size_t* holders = shard.holders.find_hashed(id, hash);
+            if (holders && *holders == 0) {
+                shard.holders.erase_hashed(id, hash);
+                freed = true;
+            } else {
+                if (sized) {
+                    if (Entry* old = shard.objects.find_hashed(id, hash)) {
+                        if (old->value) memory_bytes_.fetch_sub(old->bytes, std::memory_order_relaxed);
+                        stale = old->spilled;
+                    }
+                    memory_bytes_.fetch_add(bytes, std::memory_order_relaxed);
+                }
+                if (spill_) {
+                    entry.last_access.store(tick_.fetch_add(1, std::memory_order_relaxed),
+                                            std::memory_order_relaxed);
+                }
+                shard.objects.insert_or_assign_hashed(id, hash, std::move(entry));
+            }
+
+            take_waiters_locked(shard, id, ready);
         }
 
-        // Notify waiting threads
-        cv_.notify_all();
+        if (stale) {
+            spill_->post([this, loc = *stale] { spill_->discard(loc); });
+        }
+
+        // Resume anything parked on this object
+        for (auto& fn : ready) {
+            fn();
+        }
 
         // Trigger callback if registered (notify scheduler)
         if (on_put_callback_) {
             on_put_callback_(id);
         }
+        if (put_observer_) {
+            put_observer_(id, bytes);
+        }
+        if (freed && on_free_callback_) {
+            on_free_callback_(id);
+        }
+
+        maybe_evict();
+    }
+
+    void ObjectStore::take_waiters_locked(Shard& shard, const ObjectId& id,
+                                          std::vector<Continuation>& ready) {
+        auto it = shard.waiting.find(id);
+        if (it == shard.waiting.end()) return;
+
+        // Wake only the threads parked on this id
+        for (Waiter* w : it->second.parked) {
+            {
+                std::lock_guard<std::mutex> wl(w->mutex);
+                w->ready = true;
+            }
+            w->cv.notify_one();
+        }
+        ready = std::move(it->second.continuations);
+        shard.waiting.erase(it);
+    }
+
+    bool ObjectStore::when_ready(const ObjectId& id, Continuation fn) {
+        bool queue_restore = false;
+        {
+            size_t hash;
+            Shard& shard = shard_for(id, hash);
+            std::unique_lock<std::shared_mutex> lock(shard.mutex);
+            Entry* entry = shard.objects.find_hashed(id, hash);
+            // A failed object is ready too: the reader gets its error. Queuing
+            // another restore of an entry that cannot decode would only fail
+            // again and run `fn` again.
+            if (entry && (entry->value || entry->error)) {
+                return false;
+            }
+            if (entry) queue_restore = begin_restore_locked(*entry);
+            shard.waiting[id].continuations.push_back(std::move(fn));
+        }
+        if (queue_restore) {
+            spill_->post([this, id] { restore(id); });
+        }
+        return true;
+    }
+
+    bool ObjectStore::when_restored(const ObjectId& id, Continuation fn) {
+        bool queue_restore = false;
+        {
+            size_t hash;
+            Shard& shard = shard_for(id, hash);
+            std::unique_lock<std::shared_mutex> lock(shard.mutex);
+            Entry* entry = shard.objects.find_hashed(id, hash);
+            if (!entry || entry->value || entry->error) {
+                return false;
+            }
+            queue_restore = begin_restore_locked(*entry);
+            shard.waiting[id].continuations.push_back(std::move(fn));
+        }
+        if (queue_restore) {
+            spill_->post([this, id] { restore(id); });
+        }
+        return true;
     }
 
     void ObjectStore::set_on_put_callback(OnPutCallback callback) {
         on_put_callback_ = std::move(callback);
     }
 
+    void ObjectStore::set_put_observer(PutObserver observer) {
+        put_observer_ = std::move(observer);
+    }
+
+    void ObjectStore::enable_reference_counting() {
+        reference_counting_.store(true, std::memory_order_relaxed);
+    }
+
+    bool ObjectStore::reference_counting() const {
+        return reference_counting_.load(std::memory_order_relaxed);
+    }
+
+    void ObjectStore::retain(const ObjectId& id) {
+        if (!reference_counting()) return;
+
+        size_t hash;
+        Shard& shard = shard_for(id, hash);
+        std::unique_lock<std::shared_mutex> lock(shard.mutex);
+        if (size_t* holders = shard.holders.find_hashed(id, hash)) {
+            ++*holders;
+        } else {
+            shard.holders.insert_or_assign_hashed(id, hash, 1);
+        }
+    }
+
+    void ObjectStore::release(const ObjectId& id) {
+        ObjectHandle payload;
+        drop_holder(id, payload);
+    }
+
+    bool ObjectStore::drop_holder(const ObjectId& id, ObjectHandle& payload) {
+        if (!reference_counting()) return false;
+
+        std::optional<SpillLocation> stale;
+        {
+            size_t hash;
+            Shard& shard = shard_for(id, hash);
+            std::unique_lock<std::shared_mutex> lock(shard.mutex);
+            size_t* holders = shard.holders.find_hashed(id, hash);
+            if (!holders || *holders == 0 || --*holders > 0) return false;
+
+            // Not produced yet: keep the zero count so put() drops it
+            Entry* entry = shard.objects.find_hashed(id, hash);
+            if (!entry) return false;
+
+            if (entry->value) memory_bytes_.fetch_sub(entry->bytes, std::memory_order_relaxed);
+            payload = std::move(entry->value);
+            stale = entry->spilled;
+            shard.objects.erase_hashed(id, hash);
+            shard.holders.erase_hashed(id, hash);
+        }
+
+        if (stale) {
+            spill_->post([this, loc = *stale] { spill_->discard(loc); });
+        }
+        if (on_free_callback_) {
+            on_free_callback_(id);
+        }
+        return true;
+    }
+
+    std::shared_ptr<const void> ObjectStore::make_owner(const ObjectId& id) {
+        if (!reference_counting()) return nullptr;
+
+        retain(id);
+        return std::allocate_shared<const Owner>(SlabAllocator<Owner>{}, lifetime_, id);
+    }
+
+    void ObjectStore::set_on_free_callback(OnFreeCallback callback) {
+        on_free_callback_ = std::move(callback);
+    }
+
     std::optional<std::any> ObjectStore::get(const ObjectId& id) {
-        std::lock_guard<std::mutex> lock(mutex_);
-        auto it = store_.find(id);
-        if (it != store_.end()) {
-            return it->second;
+        if (ObjectHandle handle = get_handle(id)) {
+            return *handle;
         }
         return std::nullopt;
     }
 
+    ObjectHandle ObjectStore::get_handle(const ObjectId& id) {
+        {
+            size_t hash;
+            Shard& shard = shard_for(id, hash);
+            std::shared_lock<std::shared_mutex> lock(shard.mutex);
+            Entry* entry = shard.objects.find_hashed(id, hash);
+            if (!entry) {
+                return nullptr;
+            }
+            if (entry->error) {
+                std::rethrow_exception(entry->error);
+            }
+            if (entry->value) {
+                if (spill_) {
+                    // Approximate LRU: remember the latest tick, skip the
+                    // store if it is already current
+                    const uint64_t tick = touch_tick();
+                    if (entry->last_access.load(std::memory_order_relaxed) != tick) {
+                        entry->last_access.store(tick, std::memory_order_relaxed);
+                    }
+                }
+                return entry->value;
+            }
+        }
+        // Spilled: a miss, not a wait. Blocking readers use get_handle_blocking.
+        return nullptr;
+    }
+
+    bool ObjectStore::contains(const ObjectId& id) {
+        size_t hash;
+        Shard& shard = shard_for(id, hash);
+        std::shared_lock<std::shared_mutex> lock(shard.mutex);
+        return shard.objects.find_hashed(id, hash) != nullptr;
+    }
+
+    bool ObjectStore::resident(const ObjectId& id) {
+        size_t hash;
+        Shard& shard = shard_for(id, hash);
+        std::shared_lock<std::shared_mutex> lock(shard.mutex);
+        Entry* entry = shard.objects.find_hashed(id, hash);
+        return entry && entry->value;
+    }
+
+    size_t ObjectStore::size() {
+        size_t total = 0;
+        for (auto& shard : shards_) {
+            std::shared_lock<std::shared_mutex> lock(shard.mutex);
+            total += shard.objects.size();
+        }
+        return total;
+    }
+
+    std::optional<size_t> ObjectStore::park(const std::vector<ObjectId>& ids, bool need_resident) {
+        Waiter self;
+        std::optional<size_t> hit;
+        std::vector<ObjectId> to_restore;
+
+        auto ready = [need_resident](const Entry* entry) {
+            return entry && (!need_resident || entry->value || entry->error);
+        };
+
+        // Register under each id's shard; stop early if one is already there
+        size_t registered = 0;
+        for (; registered < ids.size(); ++registered) {
+            size_t hash;
+            Shard& shard = shard_for(ids[registered], hash);
+            std::unique_lock<std::shared_mutex> lock(shard.mutex);
+            Entry* entry = shard.objects.find_hashed(ids[registered], hash);
+            if (ready(entry)) {
+                hit = registered;
+                break;
+            }
+            if (entry && begin_restore_locked(*entry)) {
+                to_restore.push_back(ids[registered]);
+            }
+            shard.waiting[ids[registered]].parked.push_back(&self);
+        }
+
+        for (auto& id : to_restore) {
+            spill_->post([this, id = std::move(id)] { restore(id); });
+        }
+
+        if (!hit) {
+            std::unique_lock<std::mutex> wl(self.mutex);
+            self.cv.wait(wl, [&] { return self.ready; });
+        }
+
+        // Deregister. Taking each shard lock also guarantees no put is still
+        // touching `self` when we return.
+        for (size_t i = 0; i < registered; ++i) {
+            size_t hash;
+            Shard& shard = shard_for(ids[i], hash);
+            std::unique_lock<std::shared_mutex> lock(shard.mutex);
+
+            auto it = shard.waiting.find(ids[i]);
+            if (it != shard.waiting.end()) {
+                auto& parked = it->second.parked;
+                parked.erase(std::remove(parked.begin(), parked.end(), &self), parked.end());
+                if (parked.empty() && it->second.continuations.empty()) {
+                    shard.waiting.erase(it);
+                }
+            }
+            if (!hit && ready(shard.objects.find_hashed(ids[i], hash))) {
+                hit = i;
+            }
+        }
+        return hit;
+    }
+
+    void ObjectStore::wait(const ObjectId& id) {
+        if (contains(id)) return;
+        park({id});
+    }
+
     std::any ObjectStore::get_blocking(const ObjectId& id) {
-        std::unique_lock<std::mutex> lock(mutex_);
+        return *get_handle_blocking(id);
+    }
+
+    ObjectHandle ObjectStore::get_handle_blocking(const ObjectId& id) {
+        // Wait until the object appears (and is back in memory if spilled)
+        while (true) {
+            {
+                size_t hash;
+                Shard& shard = shard_for(id, hash);
+                std::shared_lock<std::shared_mutex> lock(shard.mutex);
+                Entry* entry = shard.objects.find_hashed(id, hash);
+                if (entry && entry->value) {
+                    return entry->value;
+                }
+                // Failed, or its payload on disk could not be decoded; a new
+                // put replaces it
+                if (entry && entry->error) {
+                    std::rethrow_exception(entry->error);
+                }
+            }
+            park({id}, /*need_resident=*/true);
+        }
+    }
 
-        // Wait until the object appears
-        cv_.wait(lock, [&] {
-            return store_.find(id) != store_.end();
-        });
+    void ObjectStore::wait_all(const std::vector<ObjectId>& ids) {
+        // Total wait is bounded by the slowest object either way; waiting
+        // in order keeps each thread registered on one slot at a time.
+        for (const auto& id : ids) {
+            wait(id);
+        }
+    }
 
-        return store_[id];
+    size_t ObjectStore::wait_any(const std::vector<ObjectId>& ids) {
+        // park() would register no waiter and sleep forever
+        if (ids.empty()) throw std::invalid_argument("ObjectStore::wait_any: no ids");
+        while (true) {
+            for (size_t i = 0; i < ids.size(); ++i) {
+                if (contains(ids[i])) return i;
+            }
+            if (auto hit = park(ids)) return *hit;
+        }
+    }
+
+    // ── Spilling ─────────────────────────────────────────────────────────
+
+    void ObjectStore::enable_spilling(SpillConfig config) {
+        if (config.memory_budget == 0) return;   // unlimited
+        spill_ = std::make_unique<SpillManager>(std::move(config));
+    }
+
+    SpillStats ObjectStore::spill_stats() {
+        SpillStats stats = spill_ ? spill_->stats() : SpillStats{};
+        stats.memory_bytes = memory_bytes_.load(std::memory_order_relaxed);
+        return stats;
+    }
+
+    bool ObjectStore::begin_restore_locked(Entry& entry) {
+        if (!entry.spilled || entry.restoring) return false;
+        entry.restoring = true;
+        entry.restore_requested = std::chrono::steady_clock::now();
+        return true;
+    }
+
+    void ObjectStore::maybe_evict() {
+        if (!spill_) return;
+        if (memory_bytes_.load(std::memory_order_relaxed) <= spill_->config().memory_budget) return;
+        if (eviction_queued_.exchange(true, std::memory_order_acq_rel)) return;
+        spill_->post([this] { evict_cold(); });
+    }
+
+    void ObjectStore::evict_cold() {
+        eviction_queued_.store(false, std::memory_order_release);
+
+        const SpillConfig& config = spill_->config();
+        const size_t used = memory_bytes_.load(std::memory_order_relaxed);
+        if (used <= config.memory_budget) return;
+        const size_t target = used - static_cast<size_t>(config.memory_budget * config.low_watermark);
+
+        // Snapshot the spillable residents, coldest first
+        struct Candidate {
+            uint64_t tick;
+            size_t shard;
+            ObjectId id;
+        };
+        std::vector<Candidate> candidates;
+        for (size_t i = 0; i < kShards; ++i) {
+            std::shared_lock<std::shared_mutex> lock(shards_[i].mutex);
+            shards_[i].objects.for_each([&](const ObjectId& id, Entry& entry) {
+                if (entry.value && entry.codec && !entry.restoring) {
+                    candidates.push_back({entry.last_access.load(std::memory_order_relaxed), i, id});
+                }
+            });
+        }
+        std::sort(candidates.begin(), candidates.end(),
+                  [](const Candidate& a, const Candidate& b) { return a.tick < b.tick; });
+
+        size_t released = 0;
+        std::string buffer;
+        for (const auto& c : candidates) {
+            if (released >= target) break;
+            Shard& shard = shards_[c.shard];
+
+            // Skip anything touched since the snapshot
+            ObjectHandle value;
+            const ObjectCodec::Entry* codec;
+            {
+                std::shared_lock<std::shared_mutex> lock(shard.mutex);
+                Entry* entry = shard.objects.find(c.id);
+                if (!entry || !entry->value ||
+                    entry->last_access.load(std::memory_order_relaxed) != c.tick) continue;
+                value = entry->value;
+                codec = entry->codec;
+            }
+
+            const auto start = std::chrono::steady_clock::now();
+            buffer.clear();
+            codec->encode(*value, buffer);
+            const SpillLocation loc = spill_->write(buffer);
+
+            bool spilled = false;
+            {
+                std::unique_lock<std::shared_mutex> lock(shard.mutex);
+                Entry* entry = shard.objects.find(c.id);
+                if (entry && entry->value == value && !entry->restoring) {
+                    entry->value.reset();
+                    entry->spilled = loc;
+                    memory_bytes_.fetch_sub(entry->bytes, std::memory_order_relaxed);
+                    released += entry->bytes;
+                    spilled = true;
+                }
+            }
+
+            // Freed or replaced while we were writing
+            if (!spilled) {
+                spill_->discard(loc);
+                continue;
+            }
+            spill_->record_spill(loc.length, std::chrono::steady_clock::now() - start);
+        }
+    }
+
+    void ObjectStore::restore(const ObjectId& id) {
+        size_t hash;
+        Shard& shard = shard_for(id, hash);
+
+        SpillLocation loc;
+        const ObjectCodec::Entry* codec;
+        std::chrono::steady_clock::time_point requested;
+        {
+            std::shared_lock<std::shared_mutex> lock(shard.mutex);
+            Entry* entry = shard.objects.find_hashed(id, hash);
+            if (!entry || entry->value || !entry->spilled) return;
+            loc = *entry->spilled;
+            codec = entry->codec;
+            requested = entry->restore_requested;
+        }
+
+        ObjectHandle value;
+        try {
+            value = std::allocate_shared<const std::any>(SlabAllocator<std::any>{}, codec->decode(spill_->view(loc)));
+        } catch (...) {
+            // Fail the readers parked on it instead of leaving them waiting
+            // on a dead restore; continuations run and hit the error on read
+            std::vector<Continuation> failed;
+            {
+                std::unique_lock<std::shared_mutex> lock(shard.mutex);
+                if (Entry* entry = shard.objects.find_hashed(id, hash)) {
+                    entry->restoring = false;
+                    entry->error = std::current_exception();
+                }
+                take_waiters_locked(shard, id, failed);
+            }
+            for (auto& fn : failed) {
+                fn();
+            }
+            throw;
+        }
+
+        std::vector<Continuation> ready;
+        {
+            std::unique_lock<std::shared_mutex> lock(shard.mutex);
+            Entry* entry = shard.objects.find_hashed(id, hash);
+            // Whoever detaches a location from its entry discards it; if the
+            // entry was freed or replaced meanwhile, that already happened.
+            if (!entry || !entry->spilled || entry->spilled->segment != loc.segment ||
+                entry->spilled->offset != loc.offset) return;
+
+            entry->value = std::move(value);
+            entry->spilled.reset();
+            entry->restoring = false;
+            entry->last_access.store(tick_.fetch_add(1, std::memory_order_relaxed),
+                                     std::memory_order_relaxed);
+            memory_bytes_.fetch_add(entry->bytes, std::memory_order_relaxed);
+            take_waiters_locked(shard, id, ready);
+        }
+
+        spill_->discard(loc);
+        spill_->record_restore(loc.length, std::chrono::steady_clock::now() - requested);
+
+        for (auto& fn : ready) {
+            fn();
+        }
+        maybe_evict();
     }
 
-}
\ No newline at end of file
+}
@@ -5,35 +5,254 @@
 #ifndef OBJECT_STORE_H
 #define OBJECT_STORE_H
 #include <mutex>
+#include <shared_mutex>
+#include <condition_variable>
 #include <unordered_map>
 #include <any>
+#include <array>
 #include <optional>
 #include <functional>
+#include <vector>
+#include <memory>
+#include <atomic>
+#include <chrono>
+#include <exception>
 
 #include "object_ref.h"
+#include "object_handle.h"
+#include "object_codec.h"
+#include "flat_table.h"
+#include "spill_manager.h"
 
 
 namespace orion {
 
     // Simple in-memory object store.
-    // Maps ObjectId -> std::any
+    // Maps ObjectId -> immutable, reference-counted std::any (ObjectHandle)
+    //
+    // The id space is split over kShards independent shards, each with its own
+    // reader/writer lock and open-addressing table, so threads touching
+    // different objects rarely contend. Lookups (get / contains) only take the
+    // shard lock in shared mode.
+    //
+    // Waiting is per object: each missing id that someone waits on gets a
+    // WaitSlot holding the parked threads and continuations for that id only,
+    // so a put wakes exactly the waiters of the object it created.
+    //
+    // With reference counting enabled, each retained object carries a holder
+    // count (owning ObjectRefs, pending consumer tasks, remote owners). The
+    // object is erased as soon as that count reaches zero. Objects that were
+    // never retained are kept until the store is destroyed.
+    //
+    // With a memory budget (enable_spilling), payloads whose type has an
+    // ObjectCodec are accounted by size. Once the budget is exceeded, the
+    // least recently used ones are written to mmap'd segment files on the
+    // SpillManager's I/O thread. A spilled object still exists (contains()
+    // is true) but is not resident; reading it queues a restore and the
+    // reader waits like it would for a put. If the codec fails to decode it,
+    // the object is failed with the codec's exception.
+    //
+    // A failed object (put_error, or a restore that could not decode) exists
+    // but has no value: it counts as ready for waiters and continuations, and
+    // reads rethrow its exception until it is put again.
     class ObjectStore {
     public:
-        using OnPutCallback = std::function<void(const ObjectId&)>;
+        using OnPutCallback  = std::function<void(const ObjectId&)>;
+        using PutObserver    = std::function<void(const ObjectId&, size_t bytes)>;
+        using OnFreeCallback = std::function<void(const ObjectId&)>;
+        using Continuation   = std::function<void()>;
+
+        static constexpr size_t kShards = 64;
+
+        ObjectStore();
+        ~ObjectStore();
+        ObjectStore(const ObjectStore&) = delete;
+        ObjectStore& operator=(const ObjectStore&) = delete;
 
         void put(const ObjectId& id, std::any value);
+        // Store an already-shared payload without re-boxing it
+        void put_handle(const ObjectId& id, ObjectHandle value);
+        // Store `id` as failed (e.g. its task threw): wakes its waiters like a
+        // put, and reads of it rethrow `error`
+        void put_error(const ObjectId& id, std::exception_ptr error);
+
+        // Copying reads (the payload is copied out of the store). get and
+        // get_handle never wait: they miss (nullopt / nullptr) while the
+        // object is absent or spilled, and rethrow a failed object's error.
         std::optional<std::any> get(const ObjectId& id);
         // Blocking get: waits until object exists
         std::any get_blocking(const ObjectId& id);
 
+        // Zero-copy reads: share the stored payload
+        ObjectHandle get_handle(const ObjectId& id);            // nullptr unless resident
+        ObjectHandle get_handle_blocking(const ObjectId& id);   // waits out puts and restores
+
+        // Presence check without copying the value out (true while spilled)
+        bool contains(const ObjectId& id);
+        // Present and in memory: a read will not wait for a restore
+        bool resident(const ObjectId& id);
+
+        // Block until the object exists, without copying it out
+        void wait(const ObjectId& id);
+        // Block until every object exists
+        void wait_all(const std::vector<ObjectId>& ids);
+        // Block until at least one object exists; returns its index in `ids`
+        // (the lowest index if several are present). Throws
+        // std::invalid_argument if `ids` is empty.
+        size_t wait_any(const std::vector<ObjectId>& ids);
+
+        // Run `fn` once `id` is resident (put, or restored from disk) or
+        // failed. Returns false (and does not keep fn) if it already is, so
+        // callers can continue inline. Continuations run on the putting or
+        // restoring thread, outside the store lock.
+        bool when_ready(const ObjectId& id, Continuation fn);
+        // The same for an object that must already exist: keeps `fn` only
+        // while `id` is spilled, and queues its restore. Returns false if
+        // `id` is absent, resident or failed, so a caller serving a read
+        // never waits on a put that may not come.
+        bool when_restored(const ObjectId& id, Continuation fn);
+
         // Register callback to be invoked when objects are created
         void set_on_put_callback(OnPutCallback callback);
+        // Second on-put hook for observers outside the local scheduler (a
+        // node reporting finished objects). Runs after the callback above and
+        // gets the payload's size (ObjectCodec::size_of). Set before the
+        // first put.
+        void set_put_observer(PutObserver observer);
+
+        // Number of stored objects (sums all shards)
+        size_t size();
+
+        // ── Reference counting (off by default) ──────────────────────────
+        void enable_reference_counting();
+        bool reference_counting() const;
+
+        // Add / drop one holder of `id`. Dropping the last holder frees the
+        // object; if it has not been put yet, it is freed on arrival.
+        // No-ops while reference counting is off.
+        void retain(const ObjectId& id);
+        void release(const ObjectId& id);
+
+        // Owner token for ObjectRef::owner: retains `id` now and releases it
+        // when the last copy is destroyed (safe to outlive the store).
+        // nullptr while reference counting is off.
+        std::shared_ptr<const void> make_owner(const ObjectId& id);
+
+        // Called after an object has been freed, outside the store lock
+        void set_on_free_callback(OnFreeCallback callback);
+
+        // ── Spilling (off by default) ────────────────────────────────────
+        // Call before the first put.
+        void enable_spilling(SpillConfig config);
+        // memory_bytes is kept whenever objects are sized: with spilling on
+        // or a put observer set
+        SpillStats spill_stats();
 
     private:
-        std::unordered_map<ObjectId, std::any> store_;
-        std::mutex mutex_;
-        std::condition_variable cv_;
+        // One blocked thread. Lives on that thread's stack. A put only touches
+        // it while holding the lock of the shard it is registered in, and the
+        // thread re-takes every such lock before returning.
+        struct Waiter {
+            std::mutex mutex;
+            std::condition_variable cv;
+            bool ready = false;
+        };
+
+        struct WaitSlot {
+            std::vector<Waiter*> parked;
+            std::vector<Continuation> continuations;
+        };
+
+        struct Entry {
+            ObjectHandle value;                            // null while spilled or failed
+            size_t bytes = 0;                              // budgeted size (spilling only)
+            const ObjectCodec::Entry* codec = nullptr;     // null = cannot spill
+            std::optional<SpillLocation> spilled;
+            bool restoring = false;
+            std::chrono::steady_clock::time_point restore_requested;
+            std::exception_ptr error;                      // failed: put_error, or a restore could not decode
+            std::atomic<uint64_t> last_access{0};          // LRU tick; written under a shared lock
+
+            Entry() = default;
+            Entry(ObjectHandle value, size_t bytes, uint64_t tick)
+                : value(std::move(value)), bytes(bytes), last_access(tick) {}
+            // Moved on insert and by table rehash (under the exclusive shard lock)
+            Entry(Entry&& other) noexcept { *this = std::move(other); }
+            Entry& operator=(Entry&& other) noexcept {
+                value = std::move(other.value);
+                bytes = other.bytes;
+                codec = other.codec;
+                spilled = other.spilled;
+                restoring = other.restoring;
+                restore_requested = other.restore_requested;
+                error = other.error;
+                last_access.store(other.last_access.load(std::memory_order_relaxed),
+                                  std::memory_order_relaxed);
+                return *this;
+            }
+        };
+
+        struct alignas(64) Shard {
+            std::shared_mutex mutex;
+            FlatTable<ObjectId, Entry> objects;
+            std::unordered_map<ObjectId, WaitSlot> waiting;
+            FlatTable<ObjectId, size_t> holders;   // retained ids only
+        };
+
+        // Lets owner tokens that outlive the store find out it is gone
+        struct Lifetime {
+            std::shared_mutex mutex;
+            ObjectStore* store;
+        };
+        struct Owner;
+
+        Shard& shard_for(const ObjectId& id, size_t& hash);
+
+        // Park the caller until one of `ids` has been put (and, with
+        // `need_resident`, is in memory or failed). Returns the lowest index
+        // present on wake-up (nullopt if it has since been removed).
+        std::optional<size_t> park(const std::vector<ObjectId>& ids, bool need_resident = false);
+
+        // Insert `entry` under `id`, wake its waiters and run the put hooks
+        void publish(const ObjectId& id, Entry entry);
+
+        // Hand the parked threads and continuations of `id` over for waking.
+        // Caller holds the shard lock exclusively.
+        void take_waiters_locked(Shard& shard, const ObjectId& id,
+                                 std::vector<Continuation>& ready);
+
+        // Mark a spilled entry as restoring and report whether the caller
+        // must queue the restore. Caller holds the shard lock exclusively.
+        bool begin_restore_locked(Entry& entry);
+
+        // I/O thread jobs
+        void evict_cold();
+        void restore(const ObjectId& id);
+
+        // Queue an eviction pass if resident bytes exceed the budget
+        void maybe_evict();
+
+        uint64_t touch_tick() const { return tick_.load(std::memory_order_relaxed); }
+
+        // Drop one holder; returns true if that freed the object. The freed
+        // payload is moved into `payload`, so the caller decides where it is
+        // destroyed.
+        bool drop_holder(const ObjectId& id, ObjectHandle& payload);
+
+        std::array<Shard, kShards> shards_;
         OnPutCallback on_put_callback_;
+        PutObserver put_observer_;
+        OnFreeCallback on_free_callback_;
+
+        std::atomic<bool> reference_counting_{false};
+        std::shared_ptr<Lifetime> lifetime_;
+
+        // Spilling state; spill_ is null unless enabled. Declared last so the
+        // I/O thread (which calls back into the shards) stops first.
+        std::atomic<size_t> memory_bytes_{0};
+        std::atomic<uint64_t> tick_{1};
+        std::atomic<bool> eviction_queued_{false};
+        std::unique_ptr<SpillManager> spill_;
     };
 
 
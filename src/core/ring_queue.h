@@ -0,0 +1,81 @@
+// ring_queue.h — growable FIFO over one circular buffer
+//
+// std::queue's std::deque allocates and frees a block every few hundred
+// bytes of traffic, i.e. every couple of Tasks. RingQueue only allocates
+// when it outgrows its buffer, so a queue that has reached its working size
+// never touches the heap again. Not thread-safe; callers hold their own lock.
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace orion {
+
+    template <typename T>
+    class RingQueue {
+    public:
+        RingQueue() = default;
+        RingQueue(const RingQueue&) = delete;
+        RingQueue& operator=(const RingQueue&) = delete;
+
+        ~RingQueue() {
+            while (!empty()) pop();
+            ::operator delete(slots_, std::align_val_t{alignof(T)});
+        }
+
+        bool empty() const noexcept { return head_ == tail_; }
+        size_t size() const noexcept { return tail_ - head_; }
+
+        void push(T&& value) {
+            if (size() == capacity_) grow();
+            ::new (static_cast<void*>(slot(tail_))) T(std::move(value));
+            ++tail_;
+        }
+
+        void push(const T& value) {
+            if (size() == capacity_) grow();
+            ::new (static_cast<void*>(slot(tail_))) T(value);
+            ++tail_;
+        }
+
+        T& front() noexcept { return *slot(head_); }
+
+        // Remove and return the oldest element
+        T pop() {
+            T* s = slot(head_);
+            T value(std::move(*s));
+            s->~T();
+            ++head_;
+            return value;
+        }
+
+    private:
+        // capacity_ is a power of two, so the mask wraps the counters
+        T* slot(size_t i) noexcept { return slots_ + (i & (capacity_ - 1)); }
+
+        void grow() {
+            size_t cap = capacity_ ? capacity_ * 2 : 16;
+            T* fresh = static_cast<T*>(::operator new(cap * sizeof(T), std::align_val_t{alignof(T)}));
+            size_t n = size();
+            for (size_t i = 0; i < n; ++i) {
+                T* s = slot(head_ + i);
+                ::new (static_cast<void*>(fresh + i)) T(std::move(*s));
+                s->~T();
+            }
+            ::operator delete(slots_, std::align_val_t{alignof(T)});
+            slots_ = fresh;
+            capacity_ = cap;
+            head_ = 0;
+            tail_ = n;
+        }
+
+        T* slots_ = nullptr;
+        size_t capacity_ = 0;
+        size_t head_ = 0;
+        size_t tail_ = 0;
+    };
+
+} // namespace orion
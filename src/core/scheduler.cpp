@@ -7,6 +7,15 @@ namespace orion {
 
     Scheduler::Scheduler(std::vector<Worker*> workers, ObjectStore& store)
         : workers_(std::move(workers)), store_(store) {
+        wire_store_callback();
+    }
+
+    Scheduler::Scheduler(WorkStealingPool& pool, ObjectStore& store)
+        : pool_(&pool), store_(store) {
+        wire_store_callback();
+    }
+
+    void Scheduler::wire_store_callback() {
         // Wire automatic notification: when ObjectStore.put() is called,
         // automatically notify scheduler of new objects
         store_.set_on_put_callback([this](const ObjectId& id) {
@@ -19,28 +28,70 @@ namespace orion {
 
     void Scheduler::submit(Task task) {
         std::lock_guard<std::mutex> lock(mutex_);
+        submit_locked(std::move(task));
+    }
 
-        if (deps_ready(task)) {
-            ready_.push(std::move(task));
+    void Scheduler::submit_batch(std::vector<Task>& tasks) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (auto& task : tasks) {
+            submit_locked(std::move(task));
+        }
+        tasks.clear();
+    }
+
+    void Scheduler::submit_locked(Task task) {
+        // Grab a slot up front so missing deps can point at it
+        size_t slot;
+        if (!free_slots_.empty()) {
+            slot = free_slots_.back();
+            free_slots_.pop_back();
         } else {
-            pending_.push_back(std::move(task));
+            slot = pending_.size();
+            pending_.emplace_back();
+        }
+
+        // Count unmet deps and index the task under each one.
+        // A put racing with this check cannot be lost: its callback needs
+        // mutex_, so it runs after we have registered in waiters_.
+        size_t unmet = 0;
+        for (const auto& ref : task.deps) {
+            if (store_.contains(ref.id)) continue;
+
+            auto& slots = waiters_[ref.id];
+            if (!slots.empty() && slots.back() == slot) continue;   // duplicate dep
+            slots.push_back(slot);
+            ++unmet;
         }
+
+        if (unmet == 0) {
+            free_slots_.push_back(slot);
+            ready_.push(std::move(task));
+            return;
+        }
+
+        pending_[slot].task = std::move(task);
+        pending_[slot].unmet = unmet;
+        ++pending_count_;
     }
 
-    bool Scheduler::on_object_created(const ObjectId&) {
+    bool Scheduler::on_object_created(const ObjectId& id) {
         std::lock_guard<std::mutex> lock(mutex_);
 
+        auto it = waiters_.find(id);
+        if (it == waiters_.end()) return false;
+
         bool moved = false;
-        auto it = pending_.begin();
-        while (it != pending_.end()) {
-            if (deps_ready(*it)) {
-                ready_.push(std::move(*it));
-                it = pending_.erase(it);
+        for (size_t slot : it->second) {
+            PendingTask& p = pending_[slot];
+            if (--p.unmet == 0) {
+                ready_.push(std::move(p.task));
+                p.task = Task{};
+                free_slots_.push_back(slot);
+                --pending_count_;
                 moved = true;
-            } else {
-                ++it;
             }
         }
+        waiters_.erase(it);
         return moved;
     }
 
@@ -48,21 +99,35 @@ namespace orion {
         std::lock_guard<std::mutex> lock(mutex_);
 
         while (!ready_.empty()) {
-            Task task = std::move(ready_.front());
-            ready_.pop();
+            Task task = ready_.pop();
+            if (pool_) {
+                pool_->submit(std::move(task));
+                continue;
+            }
             Worker* w = workers_[next_worker_];
             next_worker_ = (next_worker_ + 1) % workers_.size();
             w->submit(std::move(task));
         }
     }
 
-    bool Scheduler::deps_ready(const Task& task) {
-        for (const auto& ref : task.deps) {
-            if (!store_.get(ref.id).has_value()) {
-                return false;
-            }
+    void Scheduler::post(std::function<void()> job) {
+        if (pool_) {
+            pool_->post(std::move(job));
+            return;
+        }
+
+        Worker* w;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            w = workers_[next_worker_];
+            next_worker_ = (next_worker_ + 1) % workers_.size();
         }
-        return true;
+        w->post(std::move(job));
+    }
+
+    size_t Scheduler::pending_count() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return pending_count_;
     }
 
 } // namespace orion
@@ -2,37 +2,71 @@
 #include <vector>
 #include <queue>
 #include <mutex>
+#include <unordered_map>
 #include "task.h"
+#include "ring_queue.h"
 #include "worker.h"
+#include "work_stealing_pool.h"
 #include "object_store.h"
 
 namespace orion {
 
     // Minimal dataflow scheduler.
     // - Tracks pending tasks
-    // - Dispatches runnable tasks to a worker
+    // - Dispatches runnable tasks to a worker (round-robin) or to a
+    //   WorkStealingPool, depending on how it was constructed
+    //
+    // Dependency tracking is indexed: every pending task keeps a count of
+    // unmet deps, and waiters_ maps each missing ObjectId to the tasks blocked
+    // on it. A put therefore only touches that object's direct consumers.
     class Scheduler {
     public:
         Scheduler(std::vector<Worker*> workers, ObjectStore& store);
+        Scheduler(WorkStealingPool& pool, ObjectStore& store);
 
         // Submit a task to the system
         void submit(Task task);
 
+        // Submit several tasks under one lock acquisition
+        void submit_batch(std::vector<Task>& tasks);
+
         // Called when a new object is created
         bool on_object_created(const ObjectId& id);
 
         // Try to schedule runnable tasks
         void schedule();
 
+        // Hand a job straight to the execution layer (no dependency tracking);
+        // used to start and resume coroutine tasks.
+        void post(std::function<void()> job);
+
+        // Number of tasks still waiting on deps
+        size_t pending_count();
+
     private:
-        bool deps_ready(const Task& task);
+        void wire_store_callback();
+        void submit_locked(Task task);
+
+        struct PendingTask {
+            Task task;
+            size_t unmet = 0;   // deps not yet in the store
+        };
+
         std::vector<Worker*> workers_;
         size_t next_worker_ = 0;
+        WorkStealingPool* pool_ = nullptr;   // set => workers_ unused
         ObjectStore& store_;
 
-        std::vector<Task> pending_;
-        std::queue<Task> ready_;
+        // Slot-indexed pending tasks; freed slots are recycled via free_slots_
+        std::vector<PendingTask> pending_;
+        std::vector<size_t> free_slots_;
+        size_t pending_count_ = 0;
+
+        // missing object id -> pending slots waiting on it
+        std::unordered_map<ObjectId, std::vector<size_t>> waiters_;
+
+        RingQueue<Task> ready_;
         std::mutex mutex_;
     };
 
-} // namespace orion
\ No newline at end of file
+} // namespace orion
@@ -0,0 +1,160 @@
+// slab_pool.h — fixed-size block recycling for hot-path records
+//
+// BlockPool<Size, Align> hands out blocks carved from 64-block slabs and
+// keeps freed blocks for reuse, so records that are created and destroyed
+// once per task (pool jobs, stored-object control blocks, owner tokens)
+// stop hitting the general-purpose allocator once the working set is warm.
+//
+// Each thread keeps a small private free list and trades blocks with the
+// shared list in batches: a block freed on a worker thread and allocated
+// again on the submitting thread costs one lock per batch, not per block.
+// Slabs are never returned to the system.
+//
+// SlabAllocator<T> routes single-object allocations through the pool, for
+// std::allocate_shared and containers of node-sized records.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace orion {
+
+    template <size_t Size, size_t Align>
+    class BlockPool {
+    public:
+        static void* allocate() {
+            Cache& c = cache();
+            if (c.dead) return shared().take_one();
+            if (!c.registered) register_thread(c);
+            if (c.count == 0) c.count = shared().refill(c.blocks, kBatch);
+            return c.blocks[--c.count];
+        }
+
+        static void deallocate(void* p) noexcept {
+            Cache& c = cache();
+            if (c.dead) {
+                shared().give(&p, 1);
+                return;
+            }
+            if (!c.registered) register_thread(c);
+            if (c.count == kCacheMax) {
+                c.count -= kBatch;
+                shared().give(c.blocks + c.count, kBatch);
+            }
+            c.blocks[c.count++] = p;
+        }
+
+    private:
+        static constexpr size_t kBlockSize = (Size + Align - 1) / Align * Align;
+        static constexpr size_t kSlabBlocks = 64;
+        static constexpr size_t kBatch = 32;
+        static constexpr size_t kCacheMax = 2 * kBatch;
+
+        struct Shared {
+            std::mutex mutex;
+            std::vector<void*> free;
+
+            size_t refill(void** out, size_t n) {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (free.size() < n) carve();
+                std::copy(free.end() - n, free.end(), out);
+                free.resize(free.size() - n);
+                return n;
+            }
+
+            void* take_one() {
+                void* p;
+                refill(&p, 1);
+                return p;
+            }
+
+            void give(void* const* blocks, size_t n) noexcept {
+                std::lock_guard<std::mutex> lock(mutex);
+                // Never reallocates: every block was carved here and
+                // carve() reserves room for all of them
+                free.insert(free.end(), blocks, blocks + n);
+            }
+
+            void carve() {
+                auto* slab = static_cast<unsigned char*>(
+                    ::operator new(kBlockSize * kSlabBlocks, std::align_val_t{Align}));
+                slabs.push_back(slab);
+                carved += kSlabBlocks;
+                free.reserve(carved);
+                for (size_t i = 0; i < kSlabBlocks; ++i) {
+                    free.push_back(slab + i * kBlockSize);
+                }
+            }
+
+            std::vector<void*> slabs;   // keeps every slab reachable
+            size_t carved = 0;
+        };
+
+        // Trivially destructible, so it stays usable while the thread's other
+        // thread_locals are torn down; Drainer empties it at thread exit.
+        struct Cache {
+            void* blocks[kCacheMax];
+            size_t count = 0;
+            bool registered = false;
+            bool dead = false;   // drained at thread exit; go straight to Shared
+        };
+
+        struct Drainer {
+            ~Drainer() {
+                Cache& c = cache();
+                shared().give(c.blocks, c.count);
+                c.count = 0;
+                c.dead = true;
+            }
+        };
+
+        static void register_thread(Cache& c) {
+            thread_local Drainer drainer;
+            (void)drainer;
+            c.registered = true;
+        }
+
+        // Leaked, so late frees during static destruction still have a home
+        static Shared& shared() {
+            static Shared* s = new Shared();
+            return *s;
+        }
+
+        static Cache& cache() {
+            thread_local Cache c;
+            return c;
+        }
+    };
+
+    template <typename T>
+    struct SlabAllocator {
+        using value_type = T;
+
+        SlabAllocator() noexcept = default;
+        template <typename U>
+        SlabAllocator(const SlabAllocator<U>&) noexcept {}
+
+        T* allocate(size_t n) {
+            if (n == 1) {
+                return static_cast<T*>(BlockPool<sizeof(T), alignof(T)>::allocate());
+            }
+            return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t{alignof(T)}));
+        }
+
+        void deallocate(T* p, size_t n) noexcept {
+            if (n == 1) {
+                BlockPool<sizeof(T), alignof(T)>::deallocate(p);
+                return;
+            }
+            ::operator delete(p, std::align_val_t{alignof(T)});
+        }
+
+        template <typename U>
+        bool operator==(const SlabAllocator<U>&) const noexcept { return true; }
+    };
+
+} // namespace orion
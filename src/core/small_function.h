@@ -0,0 +1,148 @@
+// small_function.h — move-only callable with inline storage
+//
+// A std::function replacement for the task hot path. Callables up to
+// Capacity bytes (captureless lambdas, small captures, a std::function) live
+// inside the object, so building and moving one never allocates; larger ones
+// fall back to a single heap block. Being move-only, it also accepts
+// callables that capture move-only state.
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace orion {
+
+    template <typename Signature, size_t Capacity = 48>
+    class SmallFunction;
+
+    namespace detail {
+
+        template <typename F>
+        struct is_std_function : std::false_type {};
+        template <typename Sig>
+        struct is_std_function<std::function<Sig>> : std::true_type {};
+
+        // Callables that can be "empty": an empty one yields an empty SmallFunction
+        template <typename F>
+        bool is_null_callable(const F& f) {
+            if constexpr (is_std_function<F>::value ||
+                          std::is_pointer_v<F> || std::is_member_pointer_v<F>) {
+                return !f;
+            } else {
+                return false;
+            }
+        }
+
+    } // namespace detail
+
+    template <typename R, typename... Args, size_t Capacity>
+    class SmallFunction<R(Args...), Capacity> {
+        static_assert(Capacity >= sizeof(void*), "room for the heap fallback pointer");
+
+    public:
+        SmallFunction() noexcept = default;
+        SmallFunction(std::nullptr_t) noexcept {}
+
+        template <typename F>
+            requires (!std::is_same_v<std::decay_t<F>, SmallFunction> &&
+                      std::is_invocable_r_v<R, std::decay_t<F>&, Args...>)
+        SmallFunction(F&& f) {
+            using Fn = std::decay_t<F>;
+            if (detail::is_null_callable(f)) return;
+
+            if constexpr (fits_inline<Fn>()) {
+                ::new (static_cast<void*>(buffer_)) Fn(std::forward<F>(f));
+                ops_ = &inline_ops<Fn>;
+            } else {
+                *reinterpret_cast<Fn**>(buffer_) = new Fn(std::forward<F>(f));
+                ops_ = &heap_ops<Fn>;
+            }
+        }
+
+        SmallFunction(SmallFunction&& other) noexcept { take(other); }
+
+        SmallFunction& operator=(SmallFunction&& other) noexcept {
+            if (this != &other) {
+                reset();
+                take(other);
+            }
+            return *this;
+        }
+
+        SmallFunction& operator=(std::nullptr_t) noexcept {
+            reset();
+            return *this;
+        }
+
+        SmallFunction(const SmallFunction&) = delete;
+        SmallFunction& operator=(const SmallFunction&) = delete;
+
+        ~SmallFunction() { reset(); }
+
+        explicit operator bool() const noexcept { return ops_ != nullptr; }
+
+        // Like std::function, callable through a const reference
+        R operator()(Args... args) const {
+            if (!ops_) throw std::bad_function_call();
+            return ops_->invoke(buffer_, std::forward<Args>(args)...);
+        }
+
+    private:
+        struct Ops {
+            R (*invoke)(void* storage, Args&&... args);
+            void (*move)(void* dst, void* src) noexcept;   // move-construct, destroy src
+            void (*destroy)(void* storage) noexcept;
+        };
+
+        template <typename Fn>
+        static constexpr bool fits_inline() {
+            return sizeof(Fn) <= Capacity &&
+                   alignof(Fn) <= alignof(std::max_align_t) &&
+                   std::is_nothrow_move_constructible_v<Fn>;
+        }
+
+        template <typename Fn>
+        static constexpr Ops inline_ops{
+            [](void* s, Args&&... args) -> R {
+                return std::invoke(*static_cast<Fn*>(s), std::forward<Args>(args)...);
+            },
+            [](void* dst, void* src) noexcept {
+                ::new (dst) Fn(std::move(*static_cast<Fn*>(src)));
+                static_cast<Fn*>(src)->~Fn();
+            },
+            [](void* s) noexcept { static_cast<Fn*>(s)->~Fn(); },
+        };
+
+        template <typename Fn>
+        static constexpr Ops heap_ops{
+            [](void* s, Args&&... args) -> R {
+                return std::invoke(**static_cast<Fn**>(s), std::forward<Args>(args)...);
+            },
+            [](void* dst, void* src) noexcept {
+                *static_cast<Fn**>(dst) = *static_cast<Fn**>(src);
+            },
+            [](void* s) noexcept { delete *static_cast<Fn**>(s); },
+        };
+
+        void take(SmallFunction& other) noexcept {
+            if (!other.ops_) return;
+            other.ops_->move(buffer_, other.buffer_);
+            ops_ = other.ops_;
+            other.ops_ = nullptr;
+        }
+
+        void reset() noexcept {
+            if (!ops_) return;
+            ops_->destroy(buffer_);
+            ops_ = nullptr;
+        }
+
+        alignas(std::max_align_t) mutable unsigned char buffer_[Capacity];
+        const Ops* ops_ = nullptr;
+    };
+
+} // namespace orion
@@ -0,0 +1,208 @@
+// spill_manager.cpp — segment files and the spill I/O thread
+
+#include "spill_manager.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace orion {
+
+    namespace {
+
+        std::runtime_error io_error(const std::string& what, const std::string& path) {
+            return std::runtime_error(what + " " + path + ": " + std::strerror(errno));
+        }
+
+        void update_max(std::atomic<uint64_t>& max, uint64_t value) {
+            uint64_t seen = max.load(std::memory_order_relaxed);
+            while (value > seen &&
+                   !max.compare_exchange_weak(seen, value, std::memory_order_relaxed)) {}
+        }
+
+    } // namespace
+
+    SpillManager::SpillManager(SpillConfig config)
+        : config_(std::move(config)) {
+        namespace fs = std::filesystem;
+
+        if (config_.directory.empty()) {
+            // One directory per store, so several stores in a process never collide
+            static std::atomic<int> instances{0};
+            directory_ = (fs::temp_directory_path() /
+                          ("orion-spill-" + std::to_string(::getpid()) + "-" +
+                           std::to_string(instances.fetch_add(1)))).string();
+            owns_directory_ = true;
+        } else {
+            directory_ = config_.directory;
+        }
+        fs::create_directories(directory_);
+
+        thread_ = std::thread(&SpillManager::run_loop, this);
+    }
+
+    SpillManager::~SpillManager() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+        }
+        cv_.notify_one();
+        thread_.join();
+
+        while (!segments_.empty()) {
+            close_segment(segments_.begin()->first);
+        }
+        if (owns_directory_) {
+            std::error_code ec;
+            std::filesystem::remove_all(directory_, ec);
+        }
+    }
+
+    void SpillManager::post(std::function<void()> job) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            jobs_.push(std::move(job));
+        }
+        cv_.notify_one();
+    }
+
+    void SpillManager::run_loop() {
+        while (true) {
+            std::function<void()> job;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                cv_.wait(lock, [&] { return stopping_ || !jobs_.empty(); });
+                if (jobs_.empty()) return;   // stopping and drained
+                job = std::move(jobs_.front());
+                jobs_.pop();
+            }
+
+            try {
+                job();
+            } catch (const std::exception& e) {
+                std::cerr << "[SpillManager] " << e.what() << "\n";
+            }
+        }
+    }
+
+    SpillLocation SpillManager::write(std::string_view bytes) {
+        auto it = segments_.find(current_);
+        if (it == segments_.end() || it->second.capacity - it->second.used < bytes.size()) {
+            open_segment(bytes.size());
+            it = segments_.find(current_);
+        }
+        Segment& seg = it->second;
+
+        SpillLocation loc{current_, seg.used, bytes.size()};
+        std::memcpy(seg.base + seg.used, bytes.data(), bytes.size());
+
+        // Start write-back now, so the pages are clean (cheap to drop) by the
+        // time the kernel needs memory
+        const size_t page = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+        const size_t start = loc.offset & ~(page - 1);
+        ::msync(seg.base + start, loc.offset + loc.length - start, MS_ASYNC);
+
+        seg.used += bytes.size();
+        ++seg.live;
+        disk_bytes_.fetch_add(bytes.size(), std::memory_order_relaxed);
+        return loc;
+    }
+
+    std::string_view SpillManager::view(const SpillLocation& loc) const {
+        const Segment& seg = segments_.at(loc.segment);
+        return {seg.base + loc.offset, loc.length};
+    }
+
+    void SpillManager::discard(const SpillLocation& loc) {
+        auto it = segments_.find(loc.segment);
+        if (it == segments_.end()) return;
+
+        disk_bytes_.fetch_sub(loc.length, std::memory_order_relaxed);
+        if (--it->second.live == 0 && loc.segment != current_) {
+            close_segment(loc.segment);
+        }
+    }
+
+    void SpillManager::open_segment(size_t min_bytes) {
+        // The outgoing segment stays until its last object is discarded
+        auto old = segments_.find(current_);
+        if (old != segments_.end() && old->second.live == 0) {
+            close_segment(current_);
+        }
+
+        const size_t page = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+        Segment seg;
+        seg.capacity = (std::max(config_.segment_bytes, min_bytes) + page - 1) & ~(page - 1);
+        seg.path = directory_ + "/segment-" + std::to_string(next_segment_) + ".seg";
+
+        seg.fd = ::open(seg.path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0600);
+        if (seg.fd < 0) throw io_error("open", seg.path);
+        if (::ftruncate(seg.fd, static_cast<off_t>(seg.capacity)) != 0) {
+            ::close(seg.fd);
+            throw io_error("ftruncate", seg.path);
+        }
+        void* base = ::mmap(nullptr, seg.capacity, PROT_READ | PROT_WRITE, MAP_SHARED, seg.fd, 0);
+        if (base == MAP_FAILED) {
+            ::close(seg.fd);
+            throw io_error("mmap", seg.path);
+        }
+        seg.base = static_cast<char*>(base);
+
+        current_ = next_segment_++;
+        segments_.emplace(current_, std::move(seg));
+    }
+
+    void SpillManager::close_segment(uint32_t id) {
+        auto it = segments_.find(id);
+        if (it == segments_.end()) return;
+
+        Segment& seg = it->second;
+        ::munmap(seg.base, seg.capacity);
+        ::close(seg.fd);
+        ::unlink(seg.path.c_str());
+        segments_.erase(it);
+        if (id == current_) current_ = 0;
+    }
+
+    void SpillManager::record_spill(size_t bytes, std::chrono::nanoseconds took) {
+        spilled_objects_.fetch_add(1, std::memory_order_relaxed);
+        spilled_bytes_.fetch_add(bytes, std::memory_order_relaxed);
+        spill_ns_.fetch_add(took.count(), std::memory_order_relaxed);
+        update_max(spill_max_ns_, took.count());
+    }
+
+    void SpillManager::record_restore(size_t bytes, std::chrono::nanoseconds took) {
+        restored_objects_.fetch_add(1, std::memory_order_relaxed);
+        restored_bytes_.fetch_add(bytes, std::memory_order_relaxed);
+        restore_ns_.fetch_add(took.count(), std::memory_order_relaxed);
+        update_max(restore_max_ns_, took.count());
+    }
+
+    SpillStats SpillManager::stats() const {
+        SpillStats s;
+        s.memory_budget    = config_.memory_budget;
+        s.disk_bytes       = disk_bytes_.load(std::memory_order_relaxed);
+        s.spilled_objects  = spilled_objects_.load(std::memory_order_relaxed);
+        s.spilled_bytes    = spilled_bytes_.load(std::memory_order_relaxed);
+        s.restored_objects = restored_objects_.load(std::memory_order_relaxed);
+        s.restored_bytes   = restored_bytes_.load(std::memory_order_relaxed);
+
+        if (s.spilled_objects) {
+            s.spill_mean_us = spill_ns_.load(std::memory_order_relaxed) / 1e3 / s.spilled_objects;
+        }
+        s.spill_max_us = spill_max_ns_.load(std::memory_order_relaxed) / 1e3;
+        if (s.restored_objects) {
+            s.restore_mean_us = restore_ns_.load(std::memory_order_relaxed) / 1e3 / s.restored_objects;
+        }
+        s.restore_max_us = restore_max_ns_.load(std::memory_order_relaxed) / 1e3;
+        return s;
+    }
+
+} // namespace orion
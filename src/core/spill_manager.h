@@ -0,0 +1,122 @@
+// spill_manager.h — disk tier for the ObjectStore
+//
+// Owns a spill directory of memory-mapped segment files and one I/O thread.
+// The ObjectStore posts spill / restore jobs here so encoding, copying and
+// page-ins never run on worker threads.
+//
+// Segment files are append-only: a spilled object is copied into the current
+// segment's mapping, and a segment is unmapped and deleted once every object
+// in it has been restored or freed.
+//
+// write / view / discard touch the segment table unlocked, so they may only
+// be called from jobs running on the I/O thread.
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+
+namespace orion {
+
+    struct SpillConfig {
+        size_t memory_budget = 0;           // bytes kept in memory; 0 = unlimited
+        std::string directory;              // empty = <tmp>/orion-spill-<pid>
+        size_t segment_bytes = 64 << 20;    // size of each mapped segment file
+        double low_watermark = 0.8;         // spill down to this fraction of the budget
+    };
+
+    struct SpillStats {
+        size_t memory_budget = 0;
+        size_t memory_bytes = 0;            // resident, codec-sized payload bytes
+        size_t disk_bytes = 0;              // live bytes in segment files
+
+        uint64_t spilled_objects = 0;
+        uint64_t spilled_bytes = 0;
+        uint64_t restored_objects = 0;
+        uint64_t restored_bytes = 0;
+
+        // Spill: encode + copy into the segment. Restore: from the request
+        // until the object is back in memory.
+        double spill_mean_us = 0, spill_max_us = 0;
+        double restore_mean_us = 0, restore_max_us = 0;
+    };
+
+    struct SpillLocation {
+        uint32_t segment = 0;
+        size_t offset = 0;
+        size_t length = 0;
+    };
+
+    class SpillManager {
+    public:
+        explicit SpillManager(SpillConfig config);
+        ~SpillManager();   // drains queued jobs, then deletes every segment
+
+        SpillManager(const SpillManager&) = delete;
+        SpillManager& operator=(const SpillManager&) = delete;
+
+        const SpillConfig& config() const { return config_; }
+
+        // Run `job` on the I/O thread
+        void post(std::function<void()> job);
+
+        // ── I/O thread only ──────────────────────────────────────────────
+        // Copy `bytes` into a segment. Throws std::runtime_error on I/O failure.
+        SpillLocation write(std::string_view bytes);
+        // Mapped view of a spilled object; valid until discard()
+        std::string_view view(const SpillLocation& loc) const;
+        // The object at `loc` is no longer needed on disk
+        void discard(const SpillLocation& loc);
+
+        // Latency accounting (any thread)
+        void record_spill(size_t bytes, std::chrono::nanoseconds took);
+        void record_restore(size_t bytes, std::chrono::nanoseconds took);
+
+        // Counters; memory_* fields are filled in by the store
+        SpillStats stats() const;
+
+    private:
+        struct Segment {
+            int fd = -1;
+            char* base = nullptr;
+            size_t capacity = 0;
+            size_t used = 0;
+            size_t live = 0;      // objects not yet discarded
+            std::string path;
+        };
+
+        void run_loop();
+        void open_segment(size_t min_bytes);
+        void close_segment(uint32_t id);
+
+        SpillConfig config_;
+        std::string directory_;
+        bool owns_directory_ = false;
+
+        std::unordered_map<uint32_t, Segment> segments_;
+        uint32_t current_ = 0;
+        uint32_t next_segment_ = 1;   // 0 = none open
+
+        std::queue<std::function<void()>> jobs_;
+        bool stopping_ = false;
+        std::mutex mutex_;
+        std::condition_variable cv_;
+        std::thread thread_;
+
+        std::atomic<size_t> disk_bytes_{0};
+        std::atomic<uint64_t> spilled_objects_{0}, spilled_bytes_{0};
+        std::atomic<uint64_t> restored_objects_{0}, restored_bytes_{0};
+        std::atomic<uint64_t> spill_ns_{0}, spill_max_ns_{0};
+        std::atomic<uint64_t> restore_ns_{0}, restore_max_ns_{0};
+    };
+
+} // namespace orion
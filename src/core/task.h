@@ -4,37 +4,64 @@
 #include <vector>
 #include <functional>
 #include <any>
+#include <concepts>
 
 #include "object_ref.h"
+#include "object_handle.h"
+#include "inline_vector.h"
+#include "small_function.h"
 
 namespace orion {
 
+    // Dependency list; the first two refs live inside the Task
+    using TaskDeps = InlineVector<ObjectRef, 2>;
+
+    // Task bodies. Move-only with inline storage, so a task built from a
+    // captureless or small lambda does not allocate.
+    using TaskFn = SmallFunction<std::any(std::vector<std::any>)>;
+    using SharedTaskFn = SmallFunction<std::any(const std::vector<ObjectHandle>&)>;
+
+    // Move-only: hand tasks on with std::move.
     struct Task {
-        std::string id;
+        ObjectId id;
         std::string function_name;       // wire-safe name; looked up in FunctionRegistry on remote nodes
         std::vector<std::string> args;   // serialized literal args (4-byte LE ints for now); forwarded to nodes
-        std::vector<ObjectRef> deps;
+        TaskDeps deps;
 
         Task() = default;   // 👈 allows `Task task;`
 
         // ALWAYS takes dependency values
-        std::function<std::any(std::vector<std::any>)> work;
+        TaskFn work;
+
+        // Zero-copy variant: receives shared handles to the stored deps.
+        // When set, the worker calls this instead of `work` and no payload is copied.
+        SharedTaskFn shared_work;
 
         // Task with deps (closure version — local use)
-        Task(std::string id,
-             std::vector<ObjectRef> deps,
-             std::function<std::any(std::vector<std::any>)> fn)
+        Task(ObjectId id,
+             TaskDeps deps,
+             TaskFn fn)
             : id(std::move(id)),
               deps(std::move(deps)),
               work(std::move(fn)) {}
 
+        // Task with deps read through shared handles (closure version — local use)
+        Task(ObjectId id,
+             TaskDeps deps,
+             SharedTaskFn fn)
+            : id(std::move(id)),
+              deps(std::move(deps)),
+              shared_work(std::move(fn)) {}
+
         // Task without deps (closure version — local use)
-        Task(std::string id,
-             std::vector<ObjectRef> deps,
-             std::function<std::any()> fn)
+        template <typename F>
+            requires std::is_invocable_r_v<std::any, F&>
+        Task(ObjectId id,
+             TaskDeps deps,
+             F fn)
             : id(std::move(id)),
               deps(std::move(deps)),
-              work([fn = std::move(fn)](std::vector<std::any>) {
+              work([fn = std::move(fn)](std::vector<std::any>) mutable -> std::any {
                     return fn();
                 }) {}
     };
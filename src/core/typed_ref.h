@@ -0,0 +1,131 @@
+// typed_ref.h — compile-time typed refs and task invokers
+//
+//   orion::TypedRef<int> a = rt.submit([] { return 20; });
+//   orion::TypedRef<int> b = rt.submit([](const int& x) { return x + 22; }, a);
+//   int v = rt.get(b);   // 42
+//
+// make_typed_task deduces the argument types from the refs and generates an
+// invoker that reads every input in place from its ObjectHandle: no
+// std::vector<std::any> of copies and no any_cast on the caller's side. The
+// result is constructed directly in the stored payload.
+//
+// std::any can only hold copyable values, so a move-only result is stored as
+// a std::shared_ptr<const T>; typed_cast hides the difference. Task stays the
+// type-erased fallback and both kinds of task mix freely in one graph.
+
+#pragma once
+
+#include <any>
+#include <concepts>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "object_handle.h"
+#include "object_ref.h"
+#include "task.h"
+
+namespace orion {
+
+    // An ObjectRef whose payload is statically known to be a T. Converts to
+    // a plain ObjectRef for wait / get_handle / Task deps.
+    template <typename T>
+    struct TypedRef {
+        using value_type = T;
+
+        ObjectRef ref;
+
+        const ObjectId& id() const { return ref.id; }
+        operator const ObjectRef&() const { return ref; }
+    };
+
+    namespace detail {
+
+        // How a T is laid out inside the store's std::any
+        template <typename T>
+        using stored_t = std::conditional_t<std::is_copy_constructible_v<T>,
+                                            T, std::shared_ptr<const T>>;
+
+        template <typename T>
+        std::any make_stored(T&& value) {
+            using U = std::remove_cvref_t<T>;
+            if constexpr (std::is_copy_constructible_v<U>) {
+                return std::any(std::in_place_type<U>, std::forward<T>(value));
+            } else {
+                return std::any(std::make_shared<const U>(std::forward<T>(value)));
+            }
+        }
+
+        template <typename R>
+        struct is_typed_ref : std::false_type {};
+        template <typename T>
+        struct is_typed_ref<TypedRef<T>> : std::true_type {};
+
+    } // namespace detail
+
+    template <typename R>
+    concept TypedRefLike = detail::is_typed_ref<std::remove_cvref_t<R>>::value;
+
+    // Typed, non-copying access to a payload stored by a typed task (or any
+    // task that returned a plain T). Throws std::bad_any_cast on a mismatch.
+    template <typename T>
+    const T& typed_cast(const ObjectHandle& handle) {
+        if constexpr (std::is_copy_constructible_v<T>) {
+            return object_cast<T>(handle);
+        } else {
+            const auto& boxed = object_cast<std::shared_ptr<const T>>(handle);
+            if (!boxed) throw std::bad_any_cast();
+            return *boxed;
+        }
+    }
+
+    // Share ownership of a typed payload without copying it
+    template <typename T>
+    std::shared_ptr<const T> typed_share(ObjectHandle handle) {
+        const T& value = typed_cast<T>(handle);
+        return std::shared_ptr<const T>(std::move(handle), &value);
+    }
+
+    // Result type of calling F with the payloads behind Refs
+    template <typename F, typename... Refs>
+    using typed_result_t = std::remove_cvref_t<
+        std::invoke_result_t<F&, const typename std::remove_cvref_t<Refs>::value_type&...>>;
+
+    template <typename F, typename... Refs>
+    concept TypedInvocable =
+        (TypedRefLike<Refs> && ...) &&
+        std::invocable<F&, const typename std::remove_cvref_t<Refs>::value_type&...> &&
+        !std::is_void_v<typed_result_t<F, Refs...>>;
+
+    namespace detail {
+
+        template <typename F, typename... Ts, size_t... I>
+        std::any invoke_typed(F& fn, const std::vector<ObjectHandle>& in,
+                              std::index_sequence<I...>) {
+            return make_stored(fn(typed_cast<Ts>(in[I])...));
+        }
+
+    } // namespace detail
+
+    // Build a Task whose output `id` is fn(refs...). The deps are the refs,
+    // in order; the worker hands the invoker shared handles to them.
+    template <typename F, typename... Refs>
+        requires TypedInvocable<F, Refs...>
+    Task make_typed_task(ObjectId id, F&& fn, Refs&&... refs) {
+        TaskDeps deps;
+        deps.reserve(sizeof...(Refs));
+        (deps.push_back(std::forward<Refs>(refs).ref), ...);
+
+        SharedTaskFn invoker =
+            [fn = std::forward<F>(fn)](const std::vector<ObjectHandle>& in) mutable {
+                return detail::invoke_typed<std::decay_t<F>,
+                                            typename std::remove_cvref_t<Refs>::value_type...>(
+                    fn, in, std::index_sequence_for<Refs...>{});
+            };
+        return Task(std::move(id), std::move(deps), std::move(invoker));
+    }
+
+} // namespace orion
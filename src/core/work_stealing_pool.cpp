@@ -0,0 +1,172 @@
+// work_stealing_pool.cpp — see work_stealing_pool.h
+
+#include "work_stealing_pool.h"
+#include "worker.h"
+
+#include <iostream>
+
+namespace orion {
+
+    namespace {
+        // Which pool (if any) the current thread belongs to, and its slot
+        thread_local const void* tls_pool = nullptr;
+        thread_local size_t tls_index = 0;
+
+        // xorshift64* — victim selection only needs to be cheap and spread out
+        uint64_t next_random(uint64_t& state) {
+            state ^= state >> 12;
+            state ^= state << 25;
+            state ^= state >> 27;
+            return state * 2685821657736338717ULL;
+        }
+
+        constexpr int kSpinRounds = 64;
+    }
+
+    WorkStealingPool::WorkStealingPool(size_t num_threads, ObjectStore& store)
+        : store_(store) {
+        if (num_threads == 0) num_threads = 1;
+        for (size_t i = 0; i < num_threads; ++i) {
+            auto slot = std::make_unique<Slot>();
+            slot->rng_state = 0x9E3779B97F4A7C15ULL * (i + 1);
+            slots_.push_back(std::move(slot));
+        }
+    }
+
+    WorkStealingPool::~WorkStealingPool() {
+        stop();
+
+        // Anything left was never started (stop() without start())
+        while (!inject_.empty()) delete inject_.pop();
+        for (auto& slot : slots_) {
+            while (auto job = slot->deque.pop()) delete *job;
+        }
+    }
+
+    void WorkStealingPool::submit(Task task) {
+        enqueue(new Job{std::move(task), {}});
+    }
+
+    void WorkStealingPool::post(std::function<void()> fn) {
+        enqueue(new Job{Task{}, std::move(fn)});
+    }
+
+    void WorkStealingPool::enqueue(Job* job) {
+        // Count first so a thread that sees queued_ > 0 keeps looking
+        // instead of going to sleep while the push is in flight.
+        queued_.fetch_add(1, std::memory_order_seq_cst);
+
+        if (tls_pool == this) {
+            slots_[tls_index]->deque.push(job);
+        } else {
+            std::lock_guard<std::mutex> lock(inject_mutex_);
+            inject_.push(job);
+        }
+        wake_one();
+    }
+
+    void WorkStealingPool::wake_one() {
+        if (sleepers_.load(std::memory_order_seq_cst) > 0) {
+            std::lock_guard<std::mutex> lock(sleep_mutex_);
+            sleep_cv_.notify_one();
+        }
+    }
+
+    void WorkStealingPool::start() {
+        if (running_.exchange(true)) return;
+        for (size_t i = 0; i < slots_.size(); ++i) {
+            slots_[i]->thread = std::thread(&WorkStealingPool::run_loop, this, i);
+        }
+        std::cout << "Starting work-stealing pool with "
+                  << slots_.size() << " threads..." << std::endl;
+    }
+
+    void WorkStealingPool::stop() {
+        if (!running_.exchange(false)) return;
+        {
+            std::lock_guard<std::mutex> lock(sleep_mutex_);
+            sleep_cv_.notify_all();
+        }
+        for (auto& slot : slots_) {
+            if (slot->thread.joinable()) slot->thread.join();
+        }
+        std::cout << "Stopping work-stealing pool." << std::endl;
+    }
+
+    WorkStealingPool::Job* WorkStealingPool::find_work(size_t index) {
+        // 1. Own deque, newest first
+        if (auto job = slots_[index]->deque.pop()) return *job;
+
+        // 2. Externally submitted work
+        {
+            std::lock_guard<std::mutex> lock(inject_mutex_);
+            if (!inject_.empty()) return inject_.pop();
+        }
+
+        // 3. Somebody else's deque, oldest first
+        return steal_from_others(index);
+    }
+
+    WorkStealingPool::Job* WorkStealingPool::steal_from_others(size_t index) {
+        const size_t n = slots_.size();
+        if (n < 2) return nullptr;
+
+        size_t start = next_random(slots_[index]->rng_state) % n;
+        for (size_t k = 0; k < n; ++k) {
+            size_t victim = (start + k) % n;
+            if (victim == index) continue;
+            if (auto job = slots_[victim]->deque.steal()) return *job;
+        }
+        return nullptr;
+    }
+
+    void WorkStealingPool::run_loop(size_t index) {
+        tls_pool = this;
+        tls_index = index;
+
+        int idle_rounds = 0;
+        while (true) {
+            Job* job = find_work(index);
+
+            if (job) {
+                queued_.fetch_sub(1, std::memory_order_relaxed);
+                idle_rounds = 0;
+                if (job->fn) {
+                    job->fn();
+                } else {
+                    active_.fetch_add(1, std::memory_order_relaxed);
+                    if (!Worker::park_until_ready(job->task, store_,
+                            [this](Task task) { submit(std::move(task)); })) {
+                        Worker::run_task(job->task, store_);
+                    }
+                    active_.fetch_sub(1, std::memory_order_relaxed);
+                }
+                delete job;
+                continue;
+            }
+
+            if (!running_.load(std::memory_order_acquire) &&
+                queued_.load(std::memory_order_acquire) <= 0) {
+                return;
+            }
+
+            // Something is queued but not visible yet, or we just ran dry:
+            // spin briefly before parking.
+            if (++idle_rounds < kSpinRounds ||
+                queued_.load(std::memory_order_acquire) > 0) {
+                std::this_thread::yield();
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(sleep_mutex_);
+            sleepers_.fetch_add(1, std::memory_order_seq_cst);
+            sleep_cv_.wait(lock, [&] {
+                return queued_.load(std::memory_order_seq_cst) > 0 ||
+                       !running_.load(std::memory_order_acquire);
+            });
+            sleepers_.fetch_sub(1, std::memory_order_relaxed);
+            idle_rounds = 0;
+        }
+    }
+
+} // namespace orion
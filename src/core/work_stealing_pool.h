@@ -0,0 +1,101 @@
+// work_stealing_pool.h — work-stealing execution engine for the local Runtime
+//
+// Alternative to a set of round-robin Workers. Every pool thread owns a
+// Chase-Lev deque:
+// - tasks released on a pool thread (e.g. dependents unblocked by a put in
+//   the on-put callback) are pushed onto that thread's deque and popped LIFO,
+//   so a consumer usually runs right after its producer while data is hot
+// - tasks submitted from outside the pool go through a shared injection queue
+// - an idle thread steals FIFO from a randomly chosen victim
+//
+// One long task therefore only delays the thread running it; everything
+// queued behind it is picked up by whoever is idle.
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "chase_lev_deque.h"
+#include "object_store.h"
+#include "ring_queue.h"
+#include "slab_pool.h"
+#include "task.h"
+
+namespace orion {
+
+    class WorkStealingPool {
+    public:
+        WorkStealingPool(size_t num_threads, ObjectStore& store);
+        ~WorkStealingPool();
+
+        WorkStealingPool(const WorkStealingPool&) = delete;
+        WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+        // Enqueue a task. Thread-safe; uses the caller's own deque when the
+        // caller is one of this pool's threads.
+        void submit(Task task);
+
+        // Run an arbitrary job on a pool thread (e.g. resuming a coroutine)
+        void post(std::function<void()> fn);
+
+        // Lifecycle. stop() drains queued tasks before joining.
+        void start();
+        void stop();
+
+        size_t size() const { return slots_.size(); }
+
+        // Jobs submitted but not started / tasks running now. Approximate
+        // while jobs are moving between the two.
+        size_t queued() const {
+            return size_t(std::max<int64_t>(queued_.load(std::memory_order_relaxed), 0));
+        }
+        size_t running() const { return active_.load(std::memory_order_relaxed); }
+
+    private:
+        struct Job {
+            Task task;
+            std::function<void()> fn;   // set => plain job, task unused
+
+            // One Job per task: recycle them instead of new/delete
+            static void* operator new(size_t) { return BlockPool<sizeof(Job), alignof(Job)>::allocate(); }
+            static void operator delete(void* p) { BlockPool<sizeof(Job), alignof(Job)>::deallocate(p); }
+        };
+
+        struct alignas(64) Slot {
+            ChaseLevDeque<Job*> deque;
+            std::thread thread;
+            uint64_t rng_state = 0;
+        };
+
+        void run_loop(size_t index);
+        Job* find_work(size_t index);
+        Job* steal_from_others(size_t index);
+        void enqueue(Job* job);
+        void wake_one();
+
+        std::vector<std::unique_ptr<Slot>> slots_;
+
+        // Submissions from threads outside the pool
+        std::mutex inject_mutex_;
+        RingQueue<Job*> inject_;
+
+        // Jobs submitted but not yet taken by a thread; drives sleeping
+        alignas(64) std::atomic<int64_t> queued_{0};
+        alignas(64) std::atomic<int64_t> sleepers_{0};
+        std::atomic<size_t> active_{0};   // tasks (not plain jobs) executing
+        std::mutex sleep_mutex_;
+        std::condition_variable sleep_cv_;
+
+        std::atomic<bool> running_{false};
+        ObjectStore& store_;
+    };
+
+} // namespace orion
@@ -31,6 +31,9 @@
 #include <iostream>
 #include <optional>
 #include <thread>
+#include <memory>
+#include <exception>
+#include <string>
 
 namespace orion {
     Worker::Worker(ObjectStore& store)
@@ -44,16 +47,30 @@ namespace orion {
 
         ObjectRef Worker::submit(Task task) {
             ObjectRef ref{task.id};
+            bool was_empty;
             {
               // using lock guard for automatic mutex management instead of manual lock/unlock to avoid deadlocks
               std::lock_guard<std::mutex> lock(tasks_mutex);
               // using move to avoid copying the task, don't change
 
-              task_queue.push({std::move(task), ref});
+              was_empty = task_queue.empty();
+              task_queue.push(std::move(task));
+              queued_.fetch_add(1, std::memory_order_relaxed);
             }
-            cv.notify_one(); // Notify one waiting thread that a new task is available
+            // The thread only sleeps on an empty queue, so only the first
+            // task into an empty queue needs to wake it
+            if (was_empty) cv.notify_one();
             return ref;
         }
+
+    void Worker::post(std::function<void()> job) {
+        {
+            std::lock_guard<std::mutex> lock(tasks_mutex);
+            job_queue.push(std::move(job));
+        }
+        cv.notify_one();
+    }
+
     void Worker::start() {
         {
         std::lock_guard<std::mutex> lock(tasks_mutex);
@@ -78,58 +95,155 @@ namespace orion {
 
     void Worker::run_loop() {
         while (true) {
-            std::optional<std::pair<Task, ObjectRef>> item;
+            std::function<void()> job;
 
             {
                 std::unique_lock<std::mutex> lock(tasks_mutex);
                 cv.wait(lock, [&] {
-                    return !task_queue.empty() || !running_;
+                    return !task_queue.empty() || !job_queue.empty() || !running_;
                 });
 
-                if (!running_ && task_queue.empty()) {
+                if (!running_ && task_queue.empty() && job_queue.empty()) {
                     return;
                 }
 
-                item = std::move(task_queue.front());
-                task_queue.pop();
+                // Jobs are mostly coroutine resumptions; run them first
+                if (!job_queue.empty()) {
+                    job = std::move(job_queue.front());
+                    job_queue.pop();
+                } else {
+                    // Take a batch per lock round trip; tiny tasks are
+                    // otherwise dominated by the handoff
+                    for (size_t i = 0; i < kBatch && !task_queue.empty(); ++i) {
+                        batch_.push(task_queue.pop());
+                    }
+                }
             }
 
-            run_one(std::move(*item));   // ✅ unwrap optional
+            if (job) {
+                job();
+                continue;
+            }
+            while (!batch_.empty()) {
+                Task task = batch_.pop();
+                queued_.fetch_sub(1, std::memory_order_relaxed);
+                active_.fetch_add(1, std::memory_order_relaxed);
+                run_one(task);
+                active_.fetch_sub(1, std::memory_order_relaxed);
+            }
         }
     }
 
 
-    void Worker::run_one(std::pair<Task, ObjectRef> item) {
+    std::atomic<bool> Worker::verbose_{true};
 
-        std::vector<std::any> args;
-        args.reserve(item.first.deps.size());
-
-        for (const auto& ref : item.first.deps) {
-            args.push_back(store_.get_blocking(ref.id));
+    // what() of a task's exception, for the log
+    static std::string describe(std::exception_ptr error) {
+        try {
+            std::rethrow_exception(error);
+        } catch (const std::exception& e) {
+            return e.what();
+        } catch (...) {
+            return "unknown exception";
         }
-        std::any result = item.first.work(std::move(args));
-
+    }
 
-        std::cout << "[Worker] Task result type: " << result.type().name();
+    void Worker::set_verbose(bool verbose) {
+        verbose_.store(verbose, std::memory_order_relaxed);
+    }
 
-        if (result.type() == typeid(int)) {
-            std::cout << " value=" << std::any_cast<int>(result);
+    void Worker::run_one(Task& task) {
+        if (park_until_ready(task, store_,
+                             [this](Task t) { submit(std::move(t)); })) {
+            return;
         }
-        else if (result.type() == typeid(double)) {
-            std::cout << " value=" << std::any_cast<double>(result);
-        }
-        else if (result.type() == typeid(std::string)) {
-            std::cout << " value=" << std::any_cast<std::string>(result);
-        }
-        else if (!result.has_value()) {
-            std::cout << " <empty>";
+        run_task(task, store_);
+    }
+
+    bool Worker::park_until_ready(Task& task, ObjectStore& store,
+                                  std::function<void(Task)> resubmit) {
+        for (size_t i = 0; i < task.deps.size(); ++i) {
+            if (store.resident(task.deps[i].id)) continue;
+
+            // std::function needs a copyable callable, so share the task.
+            // Deps are stored inline, so take the id before the move.
+            ObjectId missing = task.deps[i].id;
+            auto parked = std::make_shared<Task>(std::move(task));
+            bool registered = store.when_ready(missing, [parked, resubmit] {
+                resubmit(std::move(*parked));
+            });
+            if (registered) return true;
+
+            // Landed in the meantime; take the task back and keep checking
+            task = std::move(*parked);
         }
-        else {
-            std::cout << " <unprintable>";
+        return false;
+    }
+
+    void Worker::run_task(Task& task, ObjectStore& store) {
+
+        // Handle vectors are reused per thread: taken out for the call (so a
+        // nested run_task gets its own) and put back, capacity intact
+        thread_local std::vector<ObjectHandle> handle_scratch;
+
+        std::any result;
+        try {
+            if (task.shared_work) {
+                // Hand out shared handles; payloads stay where they are
+                std::vector<ObjectHandle> args = std::move(handle_scratch);
+                args.reserve(task.deps.size());
+                for (const auto& ref : task.deps) {
+                    args.push_back(store.get_handle_blocking(ref.id));
+                }
+                result = task.shared_work(args);
+                args.clear();
+                handle_scratch = std::move(args);
+            } else {
+                std::vector<std::any> args;
+                args.reserve(task.deps.size());
+
+                for (const auto& ref : task.deps) {
+                    args.push_back(store.get_blocking(ref.id));
+                }
+                result = task.work(std::move(args));
+            }
+        } catch (...) {
+            // The task threw, or a dep is failed (its read rethrows): fail the
+            // output, so its readers and dependents get the error and this
+            // thread lives on
+            if (verbose_.load(std::memory_order_relaxed)) {
+                std::cout << "[Worker] Task failed: " << describe(std::current_exception()) << "\n";
+            }
+            task.deps.clear();
+            store.put_error(task.id, std::current_exception());
+            return;
         }
 
-        std::cout << "\n";
+        if (verbose_.load(std::memory_order_relaxed)) {
+            std::cout << "[Worker] Task result type: " << result.type().name();
+
+            if (result.type() == typeid(int)) {
+                std::cout << " value=" << std::any_cast<int>(result);
+            }
+            else if (result.type() == typeid(double)) {
+                std::cout << " value=" << std::any_cast<double>(result);
+            }
+            else if (result.type() == typeid(std::string)) {
+                std::cout << " value=" << std::any_cast<std::string>(result);
+            }
+            else if (!result.has_value()) {
+                std::cout << " <empty>";
+            }
+            else {
+                std::cout << " <unprintable>";
+            }
+
+            std::cout << "\n";
+        }
 
-        store_.put(item.second.id, std::move(result));
+        // Done with the inputs: drop their owner tokens before publishing, so
+        // whoever the put wakes already sees them released
+        task.deps.clear();
+        store.put(task.id, std::move(result));
     }
 }
@@ -29,6 +29,7 @@
 // - A Worker should NOT know about other workers.
 // - Assume tasks are already assigned correctly.
 #include "task.h"
+#include "ring_queue.h"
 #include <queue>
 #include <mutex>
 #include <condition_variable>
@@ -37,6 +38,7 @@
 #include <optional>
 #include <any>
 #include <thread>
+#include <atomic>
 
 namespace orion {
 
@@ -49,23 +51,54 @@ namespace orion {
         ~Worker();
         // - Method to submit a task to this worker.
         ObjectRef submit(Task task);
+        // Run an arbitrary job on this worker's thread (e.g. resuming a coroutine).
+        void post(std::function<void()> job);
         // Lifecycle
         void start();
         void stop();
 
+        // Resolve deps, run task.work and put the result under task.id. If
+        // the task throws, or a dep is failed, task.id is failed instead
+        // (ObjectStore::put_error). Shared by Worker and WorkStealingPool so
+        // both execute tasks identically.
+        static void run_task(Task& task, ObjectStore& store);
+
+        // If any dep of `task` is missing, move the task into a store
+        // continuation that hands it to `resubmit` once the dep lands, and
+        // return true. The calling thread is then free for other work
+        // instead of blocking in get_blocking.
+        static bool park_until_ready(Task& task, ObjectStore& store,
+                                     std::function<void(Task)> resubmit);
+
+        // Per-task result logging (on by default; benchmarks turn it off)
+        static void set_verbose(bool verbose);
+
+        // Tasks submitted but not started / running now. Approximate while
+        // tasks are moving between the two.
+        size_t queued() const { return queued_.load(std::memory_order_relaxed); }
+        size_t running() const { return active_.load(std::memory_order_relaxed); }
+
 
     private:
         void run_loop();   // background thread loop
-        void run_one(std::pair<Task, ObjectRef> item);
-        // - Task queue
-        std::queue<std::pair<Task, ObjectRef>> task_queue;
+        void run_one(Task& task);
+        // - Task queue (ring buffer: no allocation once it has grown)
+        RingQueue<Task> task_queue;
+        // Tasks taken off task_queue in one go; worker thread only
+        RingQueue<Task> batch_;
+        static constexpr size_t kBatch = 32;
+        std::queue<std::function<void()>> job_queue;
         // - Synchronization primitives (mutex, condition variable)
         std::mutex tasks_mutex;
         std::condition_variable cv;
 
         bool running_ = false;
+        std::atomic<size_t> queued_{0};
+        std::atomic<size_t> active_{0};
         std::thread worker_thread_;
         ObjectStore& store_;
+
+        static std::atomic<bool> verbose_;
     };
 
 }
@@ -4,19 +4,39 @@
 
 #include "cluster_scheduler.h"
 
-#include "cluster_scheduler.h"
+#include <algorithm>
+#include <iostream>
+#include <limits>
 
 namespace orion::distributed {
 
-ClusterScheduler::ClusterScheduler(NodeRegistry& registry, NodeClient& client)
-    : registry_(registry), client_(client) {}
+ClusterScheduler::ClusterScheduler(NodeRegistry& registry, NodeClient& client,
+                                   DispatchOptions options)
+    : registry_(registry), client_(client), options_(options) {
+    if (options_.max_batch == 0) options_.max_batch = 1;
+    if (options_.max_linger.count() > 0) {
+        flusher_ = std::thread(&ClusterScheduler::flush_loop_, this);
+    }
+}
+
+ClusterScheduler::~ClusterScheduler() {
+    {
+        std::lock_guard<std::mutex> lock(out_mu_);
+        stopping_ = true;
+    }
+    out_cv_.notify_one();
+    if (flusher_.joinable()) flusher_.join();
+
+    // Acknowledgements call back into this scheduler; let them land first
+    flush();
+    client_.flush();
+}
 
 orion::ObjectRef ClusterScheduler::submit(orion::Task task) {
     orion::ObjectRef out{task.id};
-
     {
         std::lock_guard<std::mutex> lock(mu_);
-        pending_.push(std::move(task));
+        enqueue_locked_(std::move(task));
     }
 
     // eager scheduling
@@ -24,80 +44,1036 @@ orion::ObjectRef ClusterScheduler::submit(orion::Task task) {
     return out;
 }
 
+std::optional<std::string> ClusterScheduler::submit_graph(std::vector<orion::Task> tasks) {
+    const size_t n = tasks.size();
+    if (n == 0) return std::nullopt;
+
+    std::unordered_map<orion::ObjectId, size_t> index;
+    index.reserve(n);
+    for (size_t i = 0; i < n; ++i) {
+        if (!index.emplace(tasks[i].id, i).second) {
+            return "task " + tasks[i].id.name() + " appears twice";
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mu_);
+
+        // In-graph edges as adjacency arrays: producer -> its consumers
+        std::vector<size_t> waiting(n, 0);     // unordered in-graph deps
+        std::vector<size_t> first(n + 1, 0);   // consumers of i: edges[first[i], first[i+1])
+        for (size_t i = 0; i < n; ++i) {
+            const orion::Task& task = tasks[i];
+            if (producing_.count(task.id) || object_locations_.count(task.id)) {
+                return "task " + task.id.name() + " was already submitted";
+            }
+            for (const auto& dep : task.deps) {
+                auto it = index.find(dep.id);
+                if (it != index.end()) {
+                    ++waiting[i];
+                    ++first[it->second + 1];
+                } else if (!object_locations_.count(dep.id) && !producing_.count(dep.id) &&
+                           !lineage_.count(dep.id)) {
+                    return "task " + task.id.name() + " depends on unknown object " +
+                           dep.id.name();
+                }
+            }
+        }
+        for (size_t i = 0; i < n; ++i) first[i + 1] += first[i];
+        std::vector<size_t> edges(first[n]);
+        std::vector<size_t> fill(first.begin(), first.end() - 1);
+        for (size_t i = 0; i < n; ++i) {
+            for (const auto& dep : tasks[i].deps) {
+                auto it = index.find(dep.id);
+                if (it != index.end()) edges[fill[it->second]++] = i;
+            }
+        }
+
+        // Kahn: producers before consumers, so one pass can place (or
+        // forward) every task whose inputs are in the graph
+        std::vector<size_t> order;
+        order.reserve(n);
+        for (size_t i = 0; i < n; ++i) {
+            if (waiting[i] == 0) order.push_back(i);
+        }
+        for (size_t k = 0; k < order.size(); ++k) {
+            const size_t i = order[k];
+            for (size_t e = first[i]; e < first[i + 1]; ++e) {
+                if (--waiting[edges[e]] == 0) order.push_back(edges[e]);
+            }
+        }
+        if (order.size() < n) {
+            for (size_t i = 0; i < n; ++i) {
+                if (waiting[i] > 0) return "cycle through task " + tasks[i].id.name();
+            }
+        }
+
+        for (size_t i : order) enqueue_locked_(std::move(tasks[i]));
+    }
+
+    schedule();
+    return std::nullopt;
+}
+
+void ClusterScheduler::enqueue_locked_(orion::Task task) {
+    for (const auto& dep : task.deps) {
+        ++pending_consumers_[dep.id];
+        // Lost before this consumer came along
+        if (!object_locations_.count(dep.id) && !producing_.count(dep.id) &&
+            lineage_.count(dep.id)) {
+            reconstruct_locked_(dep.id);
+        }
+    }
+    producing_.insert(task.id);
+
+    // Enough to run the task again; the head's closures never travel
+    if (!task.function_name.empty() && !lineage_.count(task.id)) {
+        Lineage entry;
+        entry.spec.id = task.id;
+        entry.spec.function_name = task.function_name;
+        entry.spec.args = task.args;
+        entry.spec.deps = task.deps;
+        for (const auto& dep : task.deps) {
+            auto parent = lineage_.find(dep.id);
+            if (parent != lineage_.end()) ++parent->second.children;
+        }
+        lineage_.emplace(task.id, std::move(entry));
+    }
+    wait_locked_(std::move(task), true);
+}
+
+std::optional<size_t> ClusterScheduler::wait_locked_(orion::Task task, bool forward) {
+    size_t unmet = 0;
+    for (const auto& dep : task.deps) {
+        if (!object_locations_.count(dep.id)) ++unmet;
+    }
+    if (unmet == 0 || (forward && runnable_locked_(task))) {
+        ready_.push_back(std::move(task));
+        return std::nullopt;
+    }
+
+    size_t slot;
+    if (!free_slots_.empty()) {
+        slot = free_slots_.back();
+        free_slots_.pop_back();
+    } else {
+        slot = pending_.size();
+        pending_.emplace_back();
+    }
+    PendingTask& pending = pending_[slot];
+    for (const auto& dep : task.deps) {
+        if (!object_locations_.count(dep.id)) waiters_[dep.id].emplace_back(slot, pending.gen);
+    }
+    pending.task = std::move(task);
+    pending.unmet = unmet;
+    ++pending_count_;
+    return slot;
+}
+
+void ClusterScheduler::wake_locked_(orion::ObjectId object_id) {
+    auto it = waiters_.find(object_id);
+    if (it == waiters_.end()) return;
+    const std::vector<std::pair<size_t, uint32_t>> waiting = std::move(it->second);
+    waiters_.erase(it);
+
+    for (const auto& [slot, gen] : waiting) {
+        PendingTask& pending = pending_[slot];
+        if (pending.gen != gen) continue;   // readied since
+        if (--pending.unmet == 0 ||
+            (options_.forward_dependents && runnable_locked_(pending.task))) {
+            ready_slot_locked_(slot);
+        }
+    }
+}
+
+void ClusterScheduler::forward_waiters_locked_(orion::ObjectId producer) {
+    if (!options_.forward_dependents) return;
+    auto it = waiters_.find(producer);
+    if (it == waiters_.end()) return;
+    for (const auto& [slot, gen] : it->second) {
+        PendingTask& pending = pending_[slot];
+        if (pending.gen == gen && runnable_locked_(pending.task)) ready_slot_locked_(slot);
+    }
+}
+
+void ClusterScheduler::retry_held_back_locked_(const std::string& node_id) {
+    auto it = held_back_.find(node_id);
+    if (it == held_back_.end()) return;
+    const std::vector<std::pair<size_t, uint32_t>> held = std::move(it->second);
+    held_back_.erase(it);
+    for (const auto& [slot, gen] : held) {
+        PendingTask& pending = pending_[slot];
+        if (pending.gen == gen && runnable_locked_(pending.task)) ready_slot_locked_(slot);
+    }
+}
+
+void ClusterScheduler::ready_slot_locked_(size_t slot) {
+    PendingTask& pending = pending_[slot];
+    ready_.push_back(std::move(pending.task));
+    pending.task = orion::Task{};
+    ++pending.gen;
+    free_slots_.push_back(slot);
+    --pending_count_;
+}
+
+size_t ClusterScheduler::pending_count() {
+    std::lock_guard<std::mutex> lock(mu_);
+    return pending_count_;
+}
+
 void ClusterScheduler::schedule() {
-    // We'll do a simple pass:
-    // pop tasks, dispatch runnable ones, requeue non-runnable ones.
-    std::queue<orion::Task> next_pending;
+    // One pass at a time, so tasks are staged in the order they became
+    // ready; callers that arrive meanwhile ask it to go around again
+    {
+        std::lock_guard<std::mutex> lock(mu_);
+        if (scheduling_) {
+            rescan_ = true;
+            return;
+        }
+        scheduling_ = true;
+    }
 
     while (true) {
-        std::optional<orion::Task> task_opt;
+        schedule_pass_();
+
+        std::lock_guard<std::mutex> lock(mu_);
+        if (!rescan_) {
+            scheduling_ = false;
+            break;
+        }
+        rescan_ = false;
+    }
+
+    if (options_.max_linger.count() == 0) flush();
+}
+
+void ClusterScheduler::schedule_pass_() {
+    std::deque<orion::Task> batch;
+    while (true) {
         {
             std::lock_guard<std::mutex> lock(mu_);
-            if (pending_.empty()) break;
+            if (ready_.empty()) return;
+            batch.swap(ready_);
+        }
+
+        while (!batch.empty()) {
+            orion::Task task = std::move(batch.front());
+            batch.pop_front();
 
-            task_opt.emplace(std::move(pending_.front()));   // ✅ move-construct
-            pending_.pop();
+            // A dep may have been lost, or its producer moved, since the
+            // task was readied
+            std::optional<Runnable> runnable;
+            {
+                std::lock_guard<std::mutex> lock(mu_);
+                runnable = runnable_locked_(task);
+                if (!runnable) {
+                    wait_locked_(std::move(task), false);
+                    continue;
+                }
+            }
+
+            // pick a node
+            const auto members = registry_.snapshot();
+            const NodeState* node = place_(task, runnable->pinned, *members);
+            if (!node) {
+                std::lock_guard<std::mutex> lock(mu_);
+                if (runnable->pinned) {
+                    // Its node is gone or busy: wait for the reports, or for
+                    // that node to report and take it after all
+                    if (auto slot = wait_locked_(std::move(task), false)) {
+                        held_back_[*runnable->pinned].emplace_back(*slot, pending_[*slot].gen);
+                    }
+                    continue;
+                }
+                // No node at all: keep the rest, in order, for the next pass
+                batch.push_front(std::move(task));
+                while (!batch.empty()) {
+                    ready_.push_front(std::move(batch.back()));
+                    batch.pop_back();
+                }
+                return;
+            }
+
+            // Dispatch. The output's location is recorded when the node
+            // reports it (on_objects_created), not here.
+            stage_(node->node_id, std::move(task));
         }
+    }
+}
 
-        orion::Task task = std::move(*task_opt);
+const NodeState* ClusterScheduler::place_(const orion::Task& task,
+                                          const std::optional<std::string>& pinned,
+                                          const NodeSnapshot& members) {
+    const NodeState* node = nullptr;
+    if (pinned) {
+        node = place_pinned_(*pinned, members);
+    } else {
+        switch (options_.placement) {
+            case Placement::RoundRobin: node = registry_.pick_node(members);     break;
+            case Placement::PowerOfTwo: node = place_two_choices_(members);      break;
+            case Placement::Locality:   node = place_local_(task, members);      break;
+        }
+    }
+    if (node) {
+        std::lock_guard<std::mutex> lock(mu_);
+        // A forwarded task waits for its inputs on the node; it loads the
+        // node once they are there, which the node's own reports show
+        InFlight& run = running_[task.id];
+        run = InFlight{node->node_id, !pinned, ++next_seq_, {}};
+        for (const auto& dep : task.deps) run.deps.push_back(dep.id);
+        if (!pinned) ++in_flight_[node->node_id];
+        // Its dependents can follow it there
+        forward_waiters_locked_(task.id);
+    }
+    return node;
+}
+
+const NodeState* ClusterScheduler::place_local_(const orion::Task& task,
+                                                const NodeSnapshot& members) {
+    const auto& nodes = members.nodes;
+    if (nodes.empty()) return nullptr;
+
+    std::lock_guard<std::mutex> lock(mu_);
 
-        if (!deps_ready_(task)) {
-            next_pending.push(std::move(task));
+    // Nodes over their memory budget sit out (load -1) while any other node
+    // has room
+    const bool any_room = std::any_of(nodes.begin(), nodes.end(),
+                                      [](const auto& n) { return !memory_full_(*n); });
+    std::vector<double>& load = load_scratch_;
+    load.resize(nodes.size());
+    double least = std::numeric_limits<double>::infinity();
+    for (size_t i = 0; i < nodes.size(); ++i) {
+        if (any_room && memory_full_(*nodes[i])) {
+            load[i] = -1;
             continue;
         }
+        load[i] = load_locked_(*nodes[i]);
+        least = std::min(least, load[i]);
+    }
 
-        // pick a node
-        auto node_opt = registry_.pick_node();
-        if (!node_opt) {
-            // no nodes available → keep task pending
-            next_pending.push(std::move(task));
-            continue;
+    // Most input bytes wins, then lower load. Each local dep also counts one
+    // byte, so deps of unknown size still pull. Scanning from a rotating
+    // start spreads ties (e.g. tasks without deps) over the nodes.
+    const size_t start = next_start_++;
+    size_t best = nodes.size();
+    uint64_t best_bytes = 0;
+    for (size_t k = 0; k < nodes.size(); ++k) {
+        const size_t i = (start + k) % nodes.size();
+        if (load[i] < 0 || load[i] > least + options_.locality_slack) continue;
+
+        uint64_t bytes = 0;
+        for (const auto& dep : task.deps) {
+            auto it = object_locations_.find(dep.id);
+            if (it != object_locations_.end() && it->second.node_id == nodes[i]->node_id) {
+                bytes += it->second.bytes + 1;
+            }
+        }
+        if (best == nodes.size() || bytes > best_bytes ||
+            (bytes == best_bytes && load[i] < load[best])) {
+            best = i;
+            best_bytes = bytes;
         }
+    }
+    return nodes[best].get();
+}
+
+const NodeState* ClusterScheduler::place_two_choices_(const NodeSnapshot& members) {
+    const auto& nodes = members.nodes;
+    if (nodes.empty()) return nullptr;
+    if (nodes.size() == 1) return nodes.front().get();
+
+    std::lock_guard<std::mutex> lock(mu_);
+    const size_t a = rng_() % nodes.size();
+    size_t b = rng_() % (nodes.size() - 1);
+    if (b >= a) ++b;
+
+    const NodeState& na = *nodes[a];
+    const NodeState& nb = *nodes[b];
+    const bool full_a = memory_full_(na);
+    const bool full_b = memory_full_(nb);
+    if (full_a != full_b) return full_a ? &nb : &na;
+    return load_locked_(nb) < load_locked_(na) ? &nb : &na;
+}
+
+const NodeState* ClusterScheduler::place_pinned_(const std::string& node_id,
+                                                 const NodeSnapshot& members) {
+    const NodeState* node = members.find(node_id);
+    if (!node) return nullptr;
+
+    // Waiting costs one round trip; piling onto a busy or full node costs more
+    const auto& nodes = members.nodes;
+    if (memory_full_(*node) && std::any_of(nodes.begin(), nodes.end(),
+                                           [](const auto& n) { return !memory_full_(*n); })) {
+        return nullptr;
+    }
+    std::lock_guard<std::mutex> lock(mu_);
+    double least = std::numeric_limits<double>::infinity();
+    for (const auto& n : nodes) least = std::min(least, load_locked_(*n));
+    if (load_locked_(*node) > least + options_.locality_slack) return nullptr;
+    return node;
+}
+
+double ClusterScheduler::load_locked_(const NodeState& node) const {
+    auto it = in_flight_.find(node.node_id);
+    const size_t dispatched = (it == in_flight_.end()) ? 0 : it->second;
+    const NodeLoad reported = node.load();
+    return double(std::max(dispatched, reported.queued + reported.running)) /
+           double(std::max(node.available_workers, 1));
+}
+
+bool ClusterScheduler::memory_full_(const NodeState& node) {
+    const NodeLoad load = node.load();
+    return load.memory_budget > 0 && load.memory_bytes >= load.memory_budget;
+}
+
+void ClusterScheduler::stage_(const std::string& node_id, orion::Task task) {
+    std::vector<orion::Task> full;
+    bool first = false;
+    {
+        std::lock_guard<std::mutex> lock(out_mu_);
+        Outbox& box = outboxes_[node_id];
+        if (box.tasks.empty()) {
+            box.deadline = std::chrono::steady_clock::now() + options_.max_linger;
+            first = true;
+        }
+        box.tasks.push_back(std::move(task));
+        if (box.tasks.size() >= options_.max_batch) full.swap(box.tasks);
+    }
+    if (!full.empty()) {
+        send_batch_(node_id, std::move(full));
+    } else if (first && flusher_.joinable()) {
+        out_cv_.notify_one();
+    }
+}
+
+void ClusterScheduler::send_batch_(const std::string& node_id,
+                                   std::vector<orion::Task> tasks) {
+    std::vector<orion::ObjectId> task_ids;
+    for (const auto& task : tasks) task_ids.push_back(task.id);
+
+    // A batch the node never got no longer loads it
+    client_.submit_tasks(node_id, std::move(tasks),
+                         [this, node_id, task_ids = std::move(task_ids)](
+                             bool accepted, std::vector<orion::ObjectId> rejected) {
+                             if (!accepted) {
+                                 requeue_failed_(task_ids);
+                             } else if (!rejected.empty()) {
+                                 drop_rejected_(node_id, rejected);
+                             }
+                         });
+}
+
+void ClusterScheduler::drop_rejected_(const std::string& node_id,
+                                      const std::vector<orion::ObjectId>& task_ids) {
+    std::vector<orion::ObjectId> to_free;
+    {
+        std::lock_guard<std::mutex> lock(mu_);
+        for (const auto& id : task_ids) {
+            auto run = running_.find(id);
+            // Finished, requeued or stolen since: not this copy any more
+            if (run == running_.end() || run->second.node_id != node_id) continue;
+            std::cerr << "[ClusterScheduler] Task " << id << " lost: rejected by "
+                      << node_id << "\n";
+            finished_locked_(id, to_free);
+            producing_.erase(id);
+
+            // Its lineage would only rebuild it into another rejection
+            auto lin = lineage_.find(id);
+            if (lin == lineage_.end()) continue;
+            const orion::TaskDeps deps = lin->second.spec.deps;
+            lineage_.erase(lin);
+            for (const auto& dep : deps) {
+                auto parent = lineage_.find(dep.id);
+                if (parent != lineage_.end() && parent->second.children > 0) {
+                    --parent->second.children;
+                    drop_lineage_locked_(dep.id);
+                }
+            }
+        }
+    }
+    free_on_nodes_(to_free);
+}
+
+void ClusterScheduler::requeue_failed_(const std::vector<orion::ObjectId>& task_ids) {
+    std::vector<orion::ObjectId> to_free;
+    {
+        std::lock_guard<std::mutex> lock(mu_);
+        for (const auto& id : task_ids) {
+            auto run = running_.find(id);
+            if (run == running_.end()) continue;   // finished, or its node already died
+            // Requeued first: it holds its deps again before they are let go
+            retry_ |= requeue_locked_(id);
+            finished_locked_(id, to_free);
+        }
+    }
+    free_on_nodes_(to_free);
+}
+
+bool ClusterScheduler::requeue_locked_(orion::ObjectId task_id) {
+    auto it = lineage_.find(task_id);
+    if (it == lineage_.end()) {
+        std::cerr << "[ClusterScheduler] Task " << task_id
+                  << " lost: no function_name to send again\n";
+        producing_.erase(task_id);
+        return false;
+    }
+    const orion::Task& spec = it->second.spec;
+    orion::Task task;
+    task.id = spec.id;
+    task.function_name = spec.function_name;
+    task.args = spec.args;
+    task.deps = spec.deps;
+    for (const auto& dep : task.deps) {
+        ++pending_consumers_[dep.id];
+    }
+    producing_.insert(task_id);
+    wait_locked_(std::move(task), true);
+    return true;
+}
 
-        const auto& node = *node_opt;
+size_t ClusterScheduler::reconstruct_locked_(orion::ObjectId object_id) {
+    // Walk the missing part of the lineage first: nothing is requeued unless
+    // all of it can be, or the tasks that could would wait forever
+    std::vector<orion::ObjectId> plan;
+    std::unordered_set<orion::ObjectId> seen;
+    std::vector<orion::ObjectId> walk{object_id};
+    while (!walk.empty()) {
+        const orion::ObjectId id = walk.back();
+        walk.pop_back();
+        if (!seen.insert(id).second || object_locations_.count(id) || producing_.count(id)) {
+            continue;
+        }
+        auto it = lineage_.find(id);
+        if (it == lineage_.end()) {
+            std::cerr << "[ClusterScheduler] Cannot rebuild " << object_id
+                      << ": no lineage for " << id << "\n";
+            return 0;
+        }
+        plan.push_back(id);
+        for (const auto& dep : it->second.spec.deps) walk.push_back(dep.id);
+    }
 
-        // Dispatch
-        // In v0.2, we assume output object lives on the node we dispatch to.
-        // Later, the node will confirm via RPC callback/event.
-        // Save id before move — task.id is empty after std::move.
-        const std::string task_id = task.id;
-        client_.submit_task(node.node_id, std::move(task));
+    for (const auto& id : plan) {
+        // Freed again once its consumers are done, as the first copy was
+        if (lineage_.at(id).released) released_.insert(id);
+        requeue_locked_(id);
+    }
+    if (!plan.empty()) {
+        std::cout << "[ClusterScheduler] Rebuilding " << object_id << ": "
+                  << plan.size() << " tasks requeued from lineage\n" << std::flush;
+    }
+    return plan.size();
+}
 
-        // Record expected output location optimistically
-        on_object_created(task_id, node.node_id);
+void ClusterScheduler::drop_lineage_locked_(orion::ObjectId object_id) {
+    std::vector<orion::ObjectId> check{object_id};
+    while (!check.empty()) {
+        const orion::ObjectId id = check.back();
+        check.pop_back();
+        auto it = lineage_.find(id);
+        if (it == lineage_.end() || !it->second.released || it->second.children > 0 ||
+            pending_consumers_.count(id) || producing_.count(id)) {
+            continue;
+        }
+        for (const auto& dep : it->second.spec.deps) {
+            auto parent = lineage_.find(dep.id);
+            if (parent != lineage_.end() && parent->second.children > 0) {
+                --parent->second.children;
+                check.push_back(dep.id);
+            }
+        }
+        lineage_.erase(it);
     }
+}
+
+void ClusterScheduler::finished_locked_(orion::ObjectId task_id,
+                                        std::vector<orion::ObjectId>& to_free) {
+    auto run = running_.find(task_id);
+    if (run == running_.end()) return;
+    uncount_locked_(run->second);
+    const std::vector<orion::ObjectId> deps = std::move(run->second.deps);
+    running_.erase(run);
+    release_consumers_locked_(deps, to_free);
+}
 
-    // restore pending queue
+void ClusterScheduler::uncount_locked_(const InFlight& in_flight) {
+    if (!in_flight.counted) return;
+    auto load = in_flight_.find(in_flight.node_id);
+    if (load != in_flight_.end() && load->second > 0) --load->second;
+}
+
+void ClusterScheduler::release_consumers_(const std::vector<orion::ObjectId>& dep_ids) {
+    std::vector<orion::ObjectId> to_free;
     {
         std::lock_guard<std::mutex> lock(mu_);
-        while (!next_pending.empty()) {
-            pending_.push(std::move(next_pending.front()));
-            next_pending.pop();
+        release_consumers_locked_(dep_ids, to_free);
+    }
+    free_on_nodes_(to_free);
+}
+
+void ClusterScheduler::release_consumers_locked_(const std::vector<orion::ObjectId>& dep_ids,
+                                                 std::vector<orion::ObjectId>& to_free) {
+    for (const auto& id : dep_ids) {
+        auto it = pending_consumers_.find(id);
+        if (it != pending_consumers_.end() && --it->second == 0) {
+            pending_consumers_.erase(it);
+            drop_lineage_locked_(id);
+        }
+        if (freeable_locked_(id)) {
+            released_.erase(id);
+            to_free.push_back(id);
+        }
+    }
+}
+
+void ClusterScheduler::flush() {
+    std::vector<std::pair<std::string, std::vector<orion::Task>>> due;
+    {
+        std::lock_guard<std::mutex> lock(out_mu_);
+        for (auto& [node_id, box] : outboxes_) {
+            if (!box.tasks.empty()) due.emplace_back(node_id, std::move(box.tasks));
+            box.tasks.clear();
+        }
+    }
+    for (auto& [node_id, tasks] : due) {
+        send_batch_(node_id, std::move(tasks));
+    }
+}
+
+void ClusterScheduler::flush_loop_() {
+    using Clock = std::chrono::steady_clock;
+    std::vector<std::pair<std::string, std::vector<orion::Task>>> due;
+
+    std::unique_lock<std::mutex> lock(out_mu_);
+    while (!stopping_) {
+        auto now = Clock::now();
+        auto next = Clock::time_point::max();
+        for (auto& [node_id, box] : outboxes_) {
+            if (box.tasks.empty()) continue;
+            if (box.deadline <= now) {
+                due.emplace_back(node_id, std::move(box.tasks));
+                box.tasks.clear();
+            } else {
+                next = std::min(next, box.deadline);
+            }
+        }
+
+        if (!due.empty()) {
+            lock.unlock();
+            for (auto& [node_id, tasks] : due) {
+                send_batch_(node_id, std::move(tasks));
+            }
+            due.clear();
+            lock.lock();
+            continue;
+        }
+
+        if (next == Clock::time_point::max()) {
+            out_cv_.wait(lock);
+        } else {
+            out_cv_.wait_until(lock, next);
         }
     }
 }
 
-void ClusterScheduler::on_object_created(const std::string& object_id,
+void ClusterScheduler::on_object_created(orion::ObjectId object_id,
                                         const std::string& node_id) {
+    on_objects_created({object_id}, node_id);
+}
+
+void ClusterScheduler::on_objects_created(const std::vector<orion::ObjectId>& object_ids,
+                                          const std::string& node_id,
+                                          const std::vector<uint64_t>& sizes) {
+    // A late report from a node declared dead: its objects are gone for us
+    if (!registry_.snapshot()->find(node_id)) {
+        std::cerr << "[ClusterScheduler] Ignoring " << object_ids.size()
+                  << " objects reported by dead or unknown node " << node_id << "\n";
+        return;
+    }
+
+    std::vector<orion::ObjectId> to_free;
+    std::vector<orion::ObjectId> stale;
+    bool waiting;
+    {
+        std::lock_guard<std::mutex> lock(mu_);
+        for (size_t i = 0; i < object_ids.size(); ++i) {
+            const orion::ObjectId id = object_ids[i];
+            // Made by the node before it was declared dead and registered
+            // again, while its task was requeued elsewhere: that run is the
+            // one tracked, and this copy is freed
+            auto run = running_.find(id);
+            if (run != running_.end() && run->second.node_id != node_id) {
+                stale.push_back(id);
+                continue;
+            }
+            object_locations_[id] = ObjectInfo{node_id, i < sizes.size() ? sizes[i] : 0,
+                                               released_.count(id) > 0};
+
+            // A task output: its task is no longer in flight
+            finished_locked_(id, to_free);
+            producing_.erase(id);
+            drop_lineage_locked_(id);
+            wake_locked_(id);
+
+            if (freeable_locked_(id)) {
+                released_.erase(id);
+                to_free.push_back(id);
+            }
+        }
+        retry_held_back_locked_(node_id);
+        waiting = !ready_.empty();
+    }
+    free_on_nodes_(to_free);
+    if (!stale.empty()) {
+        std::cerr << "[ClusterScheduler] Freeing " << stale.size() << " stale objects on "
+                  << node_id << ": their tasks run elsewhere now\n";
+        client_.free_objects(node_id, stale);
+    }
+
+    // Tasks held back for these objects can go now
+    if (waiting) schedule();
+}
+
+void ClusterScheduler::release(orion::ObjectId object_id) {
+    bool free_now;
+    {
+        std::lock_guard<std::mutex> lock(mu_);
+        released_.insert(object_id);
+        auto loc = object_locations_.find(object_id);
+        if (loc != object_locations_.end()) loc->second.released = true;
+        free_now = freeable_locked_(object_id);
+        if (free_now) released_.erase(object_id);
+
+        auto it = lineage_.find(object_id);
+        if (it != lineage_.end()) {
+            it->second.released = true;
+            drop_lineage_locked_(object_id);
+        }
+    }
+    if (free_now) free_on_nodes_({object_id});
+}
+
+void ClusterScheduler::on_object_freed(orion::ObjectId object_id,
+                                       const std::string& node_id) {
     std::lock_guard<std::mutex> lock(mu_);
-    object_locations_[object_id] = node_id;
+    auto it = object_locations_.find(object_id);
+    if (it != object_locations_.end() && it->second.node_id == node_id) {
+        object_locations_.erase(it);
+    }
 }
 
-std::optional<std::string> ClusterScheduler::object_location(const std::string& object_id) {
+void ClusterScheduler::on_node_dead(const std::string& node_id) {
+    // Staged tasks never left the head; they are unfinished like the rest
+    {
+        std::lock_guard<std::mutex> lock(out_mu_);
+        outboxes_.erase(node_id);
+    }
+
+    size_t requeued = 0;
+    size_t lost = 0;
+    size_t rebuilt = 0;
+    std::vector<orion::ObjectId> gone;
+    std::vector<orion::ObjectId> to_free;
+    {
+        std::lock_guard<std::mutex> lock(mu_);
+        std::vector<orion::ObjectId> unfinished;
+        for (const auto& [id, run] : running_) {
+            if (run.node_id == node_id) unfinished.push_back(id);
+        }
+        for (const auto& id : unfinished) {
+            if (requeue_locked_(id)) {
+                ++requeued;
+            } else {
+                ++lost;
+            }
+            finished_locked_(id, to_free);
+        }
+        in_flight_.erase(node_id);
+        held_back_.erase(node_id);
+
+        for (auto it = object_locations_.begin(); it != object_locations_.end();) {
+            if (it->second.node_id == node_id) {
+                gone.push_back(it->first);
+                it = object_locations_.erase(it);
+            } else {
+                ++it;
+            }
+        }
+
+        // Rebuild what a task still waits for now; a fetch for anything
+        // else asks for it through reconstruct()
+        for (const auto& id : gone) {
+            if (pending_consumers_.count(id)) rebuilt += reconstruct_locked_(id);
+        }
+    }
+
+    std::cout << "[ClusterScheduler] " << node_id << " is dead: " << requeued
+              << " tasks requeued, " << lost << " lost, " << gone.size()
+              << " objects gone, " << rebuilt << " being rebuilt\n" << std::flush;
+
+    free_on_nodes_(to_free);
+    schedule();
+}
+
+bool ClusterScheduler::reconstruct(orion::ObjectId object_id) {
+    size_t rebuilt;
+    bool coming;
+    {
+        std::lock_guard<std::mutex> lock(mu_);
+        rebuilt = reconstruct_locked_(object_id);
+        coming = object_locations_.count(object_id) || producing_.count(object_id);
+    }
+    if (rebuilt > 0) schedule();
+    return coming;
+}
+
+void ClusterScheduler::retry_failed() {
+    {
+        std::lock_guard<std::mutex> lock(mu_);
+        if (!retry_) return;
+        retry_ = false;
+    }
+    schedule();
+}
+
+void ClusterScheduler::rebalance() {
+    if (!options_.work_stealing) return;
+    const auto members = registry_.snapshot();
+    const auto& nodes = members->nodes;
+    if (nodes.size() < 2) return;
+
+    struct Steal {
+        std::string victim;
+        std::string thief;
+        std::vector<orion::ObjectId> task_ids;
+    };
+    std::vector<Steal> steals;
+    {
+        std::lock_guard<std::mutex> lock(mu_);
+
+        // Tasks each node with an idle worker can take: enough for one
+        // running and one queued per worker, so it is not idle again before
+        // the next call. By the same two counts as load_locked_.
+        std::vector<size_t> idle(nodes.size());
+        for (size_t i = 0; i < nodes.size(); ++i) {
+            auto it = in_flight_.find(nodes[i]->node_id);
+            const size_t dispatched = (it == in_flight_.end()) ? 0 : it->second;
+            const NodeLoad reported = nodes[i]->load();
+            const size_t busy = std::max(dispatched, reported.queued + reported.running);
+            const size_t workers = size_t(std::max(nodes[i]->available_workers, 1));
+            idle[i] = busy < workers ? 2 * workers - busy : 0;
+        }
+
+        // Busiest first
+        std::vector<size_t> order(nodes.size());
+        for (size_t i = 0; i < nodes.size(); ++i) order[i] = i;
+        std::sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+            return load_locked_(*nodes[a]) > load_locked_(*nodes[b]);
+        });
+
+        // A node with one task queued per worker besides the running ones is
+        // only keeping its workers fed; beyond that, tasks wait a whole task
+        // time or more
+        for (size_t v : order) {
+            const NodeState& victim = *nodes[v];
+            const size_t queued = victim.load().queued;
+            if (idle[v] > 0 || queued == 0 || load_locked_(victim) <= 2.0 ||
+                stealing_from_.count(victim.node_id)) {
+                continue;
+            }
+            const size_t t = size_t(std::max_element(idle.begin(), idle.end()) - idle.begin());
+            if (idle[t] == 0) break;
+            const NodeState& thief = *nodes[t];
+
+            // The victim's queue holds the newest tasks it was sent. Only
+            // those the head can send again (lineage, every input stored and
+            // not about to be freed) that no other task there consumes.
+            std::vector<std::pair<uint64_t, orion::ObjectId>> newest;
+            std::unordered_set<orion::ObjectId> consumed;
+            bool opaque = false;   // a task there whose deps we cannot see
+            for (const auto& [id, run] : running_) {
+                if (run.node_id != victim.node_id) continue;
+                auto lin = lineage_.find(id);
+                if (lin == lineage_.end()) {
+                    opaque = true;
+                    break;
+                }
+                for (const auto& dep : lin->second.spec.deps) consumed.insert(dep.id);
+                if (run.counted) newest.emplace_back(run.seq, id);
+            }
+            if (opaque) continue;
+            const size_t window = std::min<size_t>(newest.size(), queued);
+            std::partial_sort(newest.begin(), newest.begin() + ptrdiff_t(window), newest.end(),
+                              [](const auto& a, const auto& b) { return a.first > b.first; });
+
+            std::vector<std::pair<uint64_t, orion::ObjectId>> candidates;   // missing bytes, id
+            for (size_t k = 0; k < window; ++k) {
+                const orion::ObjectId id = newest[k].second;
+                if (consumed.count(id)) continue;
+                uint64_t missing = 0;
+                bool movable = true;
+                for (const auto& dep : lineage_.at(id).spec.deps) {
+                    auto loc = object_locations_.find(dep.id);
+                    if (loc == object_locations_.end() ||
+                        (loc->second.released && !pending_consumers_.count(dep.id))) {
+                        movable = false;
+                        break;
+                    }
+                    if (loc->second.node_id != thief.node_id) missing += loc->second.bytes + 1;
+                }
+                if (movable) candidates.emplace_back(missing, id);
+            }
+            if (candidates.empty()) continue;
+
+            // Half the victim's queue at most, so the two do not trade back
+            const size_t take = std::min({candidates.size(), idle[t],
+                                          (size_t(queued) + 1) / 2});
+            std::partial_sort(candidates.begin(), candidates.begin() + ptrdiff_t(take),
+                              candidates.end());
+
+            Steal steal{victim.node_id, thief.node_id, {}};
+            for (size_t k = 0; k < take; ++k) {
+                const orion::ObjectId id = candidates[k].second;
+                steal.task_ids.push_back(id);
+                stealing_.insert(id);
+                // Keep the inputs alive while the task is between nodes
+                for (const auto& dep : lineage_.at(id).spec.deps) ++pending_consumers_[dep.id];
+            }
+            stealing_from_.insert(victim.node_id);
+            idle[t] -= take;
+            steals.push_back(std::move(steal));
+        }
+    }
+
+    for (auto& steal : steals) {
+        client_.steal_tasks(steal.victim, steal.task_ids,
+                            [this, victim = steal.victim, thief = steal.thief,
+                             asked = steal.task_ids](std::vector<orion::ObjectId> stolen) {
+                                on_stolen_(victim, thief, asked, stolen);
+                            });
+    }
+}
+
+void ClusterScheduler::on_stolen_(const std::string& victim, const std::string& thief,
+                                  const std::vector<orion::ObjectId>& asked,
+                                  const std::vector<orion::ObjectId>& stolen) {
+    const std::unordered_set<orion::ObjectId> given(stolen.begin(), stolen.end());
+    const bool thief_alive = registry_.snapshot()->find(thief) != nullptr;
+
+    std::vector<orion::ObjectId> unpinned;
+    std::vector<orion::Task> moved;
+    bool forwarded;
+    {
+        std::lock_guard<std::mutex> lock(mu_);
+        stealing_from_.erase(victim);
+        for (const auto& id : asked) {
+            stealing_.erase(id);
+            auto lin = lineage_.find(id);
+            auto run = running_.find(id);
+            // Not given back, or its node died meanwhile and it was requeued
+            if (!given.count(id) || lin == lineage_.end() || run == running_.end() ||
+                run->second.node_id != victim) {
+                if (lin != lineage_.end()) {
+                    for (const auto& dep : lin->second.spec.deps) unpinned.push_back(dep.id);
+                }
+                continue;
+            }
+            // The victim's copy lets go of its deps; the pin keeps them
+            uncount_locked_(run->second);
+            unpinned.insert(unpinned.end(), run->second.deps.begin(), run->second.deps.end());
+            running_.erase(run);
+
+            if (!thief_alive) {
+                for (const auto& dep : lin->second.spec.deps) unpinned.push_back(dep.id);
+                retry_ |= requeue_locked_(id);
+                continue;
+            }
+            // The pin becomes the thief's copy's hold on its deps
+            const orion::Task& spec = lin->second.spec;
+            orion::Task task;
+            task.id = spec.id;
+            task.function_name = spec.function_name;
+            task.args = spec.args;
+            task.deps = spec.deps;
+            InFlight& moved_run = running_[id];
+            moved_run = InFlight{thief, true, ++next_seq_, {}};
+            for (const auto& dep : spec.deps) moved_run.deps.push_back(dep.id);
+            ++in_flight_[thief];
+            moved.push_back(std::move(task));
+        }
+        // Dependents held back by the steal follow their producer again
+        const size_t ready = ready_.size();
+        for (const auto& id : asked) forward_waiters_locked_(id);
+        forwarded = ready_.size() > ready;
+    }
+
+    release_consumers_(unpinned);
+    for (auto& task : moved) stage_(thief, std::move(task));
+    if (forwarded) {
+        schedule();
+    } else if (options_.max_linger.count() == 0) {
+        flush();
+    }
+}
+
+bool ClusterScheduler::freeable_locked_(orion::ObjectId object_id) const {
+    return released_.count(object_id) &&
+           !pending_consumers_.count(object_id) &&
+           object_locations_.count(object_id);
+}
+
+void ClusterScheduler::free_on_nodes_(const std::vector<orion::ObjectId>& object_ids) {
+    if (object_ids.empty()) return;
+
+    // Group by holder so each node gets one FreeObjects call
+    std::unordered_map<std::string, std::vector<orion::ObjectId>> by_node;
+    {
+        std::lock_guard<std::mutex> lock(mu_);
+        for (const auto& id : object_ids) {
+            auto it = object_locations_.find(id);
+            if (it != object_locations_.end()) {
+                by_node[it->second.node_id].push_back(id);
+            }
+        }
+    }
+    for (auto& [node_id, ids] : by_node) {
+        client_.free_objects(node_id, ids);
+    }
+}
+
+std::optional<std::string> ClusterScheduler::object_location(orion::ObjectId object_id) {
     std::lock_guard<std::mutex> lock(mu_);
     auto it = object_locations_.find(object_id);
     if (it == object_locations_.end()) return std::nullopt;
-    return it->second;
+    return it->second.node_id;
 }
 
-bool ClusterScheduler::deps_ready_(const orion::Task& task) const {
-    std::lock_guard<std::mutex> lock(mu_);
+std::optional<ClusterScheduler::Runnable>
+ClusterScheduler::runnable_locked_(const orion::Task& task) const {
+    Runnable runnable;
+    const std::string* producer = nullptr;   // of the unreported deps
+    const std::string* holder = nullptr;     // of the reported ones, if all on one node
+    bool scattered = false;
     for (const auto& dep : task.deps) {
-        if (object_locations_.find(dep.id) == object_locations_.end()) {
-            return false;
+        auto loc = object_locations_.find(dep.id);
+        if (loc != object_locations_.end()) {
+            if (holder && *holder != loc->second.node_id) scattered = true;
+            holder = &loc->second.node_id;
+            continue;
         }
+        if (!options_.forward_dependents) return std::nullopt;
+        auto run = running_.find(dep.id);
+        if (run == running_.end() || stealing_.count(dep.id)) return std::nullopt;
+        if (producer && *producer != run->second.node_id) return std::nullopt;
+        producer = &run->second.node_id;
     }
-    return true;
+    if (producer) {
+        // Only a task that node can run on its own data; one that needs
+        // inputs from elsewhere waits and is placed by bytes
+        if (scattered || (holder && *holder != *producer)) return std::nullopt;
+        runnable.pinned = *producer;
+    }
+    return runnable;
 }
 
 } // namespace orion::distributed
\ No newline at end of file
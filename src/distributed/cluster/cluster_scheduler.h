@@ -7,9 +7,15 @@
 #pragma once
 
 #include <unordered_map>
-#include <queue>
+#include <unordered_set>
+#include <vector>
+#include <deque>
 #include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <chrono>
 #include <optional>
+#include <random>
 #include <string>
 
 #include "../cluster/node_registry.h"
@@ -20,42 +26,361 @@
 
 namespace orion::distributed {
 
+    // How a runnable task's node is chosen
+    enum class Placement {
+        RoundRobin,   // NodeRegistry::pick_node(); ignores data and load
+        PowerOfTwo,   // the less loaded of two random nodes; ignores data
+        Locality,     // the node already holding most input bytes, unless overloaded
+    };
+
+    // How tasks are placed and how dispatched tasks are coalesced into
+    // per-node batches
+    struct DispatchOptions {
+        // A node's batch is sent as soon as it holds this many tasks
+        size_t max_batch = 64;
+        // ...or once its oldest task has waited this long. Zero sends
+        // whatever one schedule() pass produced at the end of that pass.
+        std::chrono::microseconds max_linger{200};
+
+        Placement placement = Placement::Locality;
+        // Locality: a node is only considered while its tasks per worker
+        // exceed the least loaded node's by at most this much
+        double locality_slack = 2.0;
+
+        // A task whose unreported deps are all being produced on one node,
+        // and whose other deps are stored there, goes there at once instead
+        // of waiting for the reports, so the node runs the chain locally
+        // without a head round trip per edge.
+        // Not while that node is locality_slack over the least loaded one;
+        // the task then waits and is placed as usual.
+        bool forward_dependents = true;
+
+        // rebalance() moves tasks that have not started on a node with a
+        // backlog to a node with idle workers
+        bool work_stealing = true;
+    };
+
     // Cluster-level scheduler:
     // - chooses nodes
-    // - dispatches tasks
-    // - tracks object locations
+    // - dispatches tasks, coalesced per node into ExecuteTasks batches
+    // - tracks object locations, as reported by the nodes once an object
+    //   has actually been stored; a task is dispatched when every dep has
+    //   been reported, or when the rest are still being produced on the
+    //   node it is sent to (forward_dependents)
+    // - indexes waiting tasks by the deps they miss, so a report or a
+    //   placement only touches the tasks waiting for that object; the cost
+    //   of a submit does not grow with the number of waiting tasks
+    // - frees objects on their node once the driver has released them and
+    //   no pending or unfinished task still consumes them
+    // - re-dispatches tasks whose node died or whose batch failed
+    // - keeps lineage: the spec (function_name, args, deps; never the
+    //   closure) of every task with a function_name, for as long as its
+    //   output or anything built from it may still be needed. An object
+    //   lost with its node is rebuilt by re-running its task, and whatever
+    //   missing inputs that task needs, instead of failing the job.
+    //   Closure-only tasks cannot travel again and are lost, as are tasks a
+    //   node rejects (function not registered there).
+    // - with work_stealing, takes queued tasks back from busy nodes and gives
+    //   them to idle ones (rebalance())
     class ClusterScheduler {
     public:
-        ClusterScheduler(NodeRegistry& registry, NodeClient& client);
+        ClusterScheduler(NodeRegistry& registry, NodeClient& client,
+                         DispatchOptions options = {});
+        // Sends staged batches and waits for the client to finish them
+        ~ClusterScheduler();
+
+        ClusterScheduler(const ClusterScheduler&) = delete;
+        ClusterScheduler& operator=(const ClusterScheduler&) = delete;
 
         // Submit a task to the cluster (may or may not dispatch immediately).
+        // Deps that were lost are rebuilt from lineage.
         // Returns ObjectRef for the output object (id == task.id).
         orion::ObjectRef submit(orion::Task task);
 
-        // Try to dispatch any runnable tasks.
+        // Submit a whole DAG, in any order, with one lock and one
+        // schedule() pass instead of one per task. Every id must be new
+        // (neither stored nor being produced), every dep must be in the
+        // graph or known here (stored, being produced, or rebuildable from
+        // lineage), and there must be no cycle. Otherwise nothing is
+        // submitted and the reason is returned.
+        std::optional<std::string> submit_graph(std::vector<orion::Task> tasks);
+
+        // Dispatch the tasks that have become runnable. Safe to call from
+        // several threads; a call made during another pass makes that pass
+        // go around again.
         void schedule();
 
-        // Record that an object is available on some node.
-        // (In v0.2, we can "predict" outputs at dispatch time; later nodes will report.)
-        void on_object_created(const std::string& object_id, const std::string& node_id);
+        // Tasks waiting for deps
+        size_t pending_count();
+
+        // Send every staged batch now, without waiting for the linger time
+        void flush();
+
+        // A node reports that it has stored these objects (and their sizes,
+        // in the same order, if known). Records their location and
+        // dispatches the tasks that were waiting for them. An output whose
+        // task is in flight on another node (requeued after this one was
+        // declared dead) is a stale copy: it is freed on the reporter.
+        void on_object_created(orion::ObjectId object_id, const std::string& node_id);
+        void on_objects_created(const std::vector<orion::ObjectId>& object_ids,
+                                const std::string& node_id,
+                                const std::vector<uint64_t>& sizes = {});
 
         // Where does this object live?
-        std::optional<std::string> object_location(const std::string& object_id);
+        std::optional<std::string> object_location(orion::ObjectId object_id);
+
+        // The driver dropped its handle. The object is freed on its node as
+        // soon as no pending task consumes it.
+        void release(orion::ObjectId object_id);
+
+        // A node confirmed it freed the object; forget its location.
+        void on_object_freed(orion::ObjectId object_id, const std::string& node_id);
+
+        // The node is gone (FailureDetector). Tasks staged for it or still
+        // unfinished there go back to pending and are placed elsewhere.
+        // Objects it held are forgotten; those a pending task still consumes
+        // are rebuilt from lineage at once, the rest only on demand.
+        void on_node_dead(const std::string& node_id);
+
+        // Make sure `object_id` will exist: if it is neither stored nor being
+        // produced, requeue its task and, recursively, the tasks of any of
+        // its inputs that are missing too. Nothing is requeued unless the
+        // whole missing subgraph has lineage. True if the object is stored
+        // or on its way.
+        bool reconstruct(orion::ObjectId object_id);
+
+        // Dispatch tasks requeued after a failed batch. They are not retried
+        // at once, which would spin on a node that is dying but not yet
+        // declared dead; the head calls this on every FailureDetector tick.
+        void retry_failed();
+
+        // work_stealing: for each node with more than two tasks per worker,
+        // ask it to give back some of the newest it was sent, for a node with
+        // idle workers. Among those, tasks with the fewest input bytes
+        // missing on the idle node go first. At most one request per busy
+        // node is outstanding. The head calls this on every FailureDetector
+        // tick, after the heartbeats that carry node load.
+        void rebalance();
 
     private:
-        bool deps_ready_(const orion::Task& task) const;
+        // submit() without the schedule() pass. Caller holds mu_.
+        void enqueue_locked_(orion::Task task);
+
+        // Place ready_ tasks until none is left, including those readied
+        // meanwhile, or no node takes one
+        void schedule_pass_();
+
+        // Every dep reported: any node. Otherwise, with forward_dependents,
+        // the one node producing all unreported deps (their tasks are
+        // dispatched there, and not being stolen) and holding the rest.
+        // nullopt: the task waits. Caller holds mu_.
+        struct Runnable {
+            std::optional<std::string> pinned;   // node it must go to, if any
+        };
+        std::optional<Runnable> runnable_locked_(const orion::Task& task) const;
+
+        // Index the task under each dep not located yet, or make it ready if
+        // there is none. With `forward`, one that can be forwarded now is
+        // made ready too; without, it waits for the next report or placement
+        // of a dep. Returns its slot, or nullopt if it was made ready.
+        // Caller holds mu_.
+        std::optional<size_t> wait_locked_(orion::Task task, bool forward);
+
+        // `object_id` was located: its waiters with no dep left unlocated,
+        // or that can now be forwarded, become ready. Caller holds mu_.
+        void wake_locked_(orion::ObjectId object_id);
+
+        // `producer` was placed, or is no longer being stolen: its waiters
+        // that can now be forwarded become ready. Caller holds mu_.
+        void forward_waiters_locked_(orion::ObjectId producer);
+
+        // Move a waiting task to ready_ and free its slot. Caller holds mu_.
+        void ready_slot_locked_(size_t slot);
+
+        // `node_id` reported objects, so its load dropped: the tasks that
+        // were not forwarded there because it was busy may go now.
+        // Caller holds mu_.
+        void retry_held_back_locked_(const std::string& node_id);
+
+        // Node of `members` for a runnable task: `pinned` if set, else per
+        // options_.placement. The task is counted as in flight there until
+        // its output is reported. nullptr: no node takes it.
+        const NodeState* place_(const orion::Task& task,
+                                const std::optional<std::string>& pinned,
+                                const NodeSnapshot& members);
+
+        // Locality: the eligible node holding most of the task's input bytes
+        const NodeState* place_local_(const orion::Task& task, const NodeSnapshot& members);
+
+        // PowerOfTwo: the better of two distinct random nodes
+        const NodeState* place_two_choices_(const NodeSnapshot& members);
+
+        // forward_dependents: `node_id`, unless it is dead or overloaded
+        const NodeState* place_pinned_(const std::string& node_id, const NodeSnapshot& members);
+
+        // Tasks per worker on `node`: the larger of what the head has
+        // dispatched there and not yet seen finish, and what the node last
+        // reported queued or running. The first is current; the second also
+        // counts work the head has lost track of and is one heartbeat old.
+        // Caller holds mu_.
+        double load_locked_(const NodeState& node) const;
+
+        // Over its memory budget: only used when every node is
+        static bool memory_full_(const NodeState& node);
+
+        // Released, unconsumed and located: ready to free. Caller holds mu_.
+        bool freeable_locked_(orion::ObjectId object_id) const;
+
+        // Send FreeObjects for each object to the node that holds it
+        void free_on_nodes_(const std::vector<orion::ObjectId>& object_ids);
+
+        // Queue a task for its node's next batch; sends the batch if full
+        void stage_(const std::string& node_id, orion::Task task);
+
+        // Hand one batch to the client
+        void send_batch_(const std::string& node_id, std::vector<orion::Task> tasks);
+
+        // The batch never reached its node: requeue its unfinished tasks
+        void requeue_failed_(const std::vector<orion::ObjectId>& task_ids);
+
+        // `node_id` took the batch but will not run these: they are lost, as
+        // closure-only tasks of a dead node are. They no longer load the
+        // node or hold their deps, and their outputs are neither being
+        // produced nor rebuildable.
+        void drop_rejected_(const std::string& node_id,
+                            const std::vector<orion::ObjectId>& task_ids);
+
+        // Put a task back into pending_ from its lineage, holding its deps
+        // again. False if it has none. Caller holds mu_.
+        bool requeue_locked_(orion::ObjectId task_id);
+
+        // Requeue the missing part of `object_id`'s lineage; returns how many
+        // tasks that took. Caller holds mu_.
+        size_t reconstruct_locked_(orion::ObjectId object_id);
+
+        // Forget `object_id`'s lineage once nothing can need it again:
+        // released, unconsumed, produced, and no kept lineage names it as an
+        // input. Its inputs may then go too. Caller holds mu_.
+        void drop_lineage_locked_(orion::ObjectId object_id);
+
+        // The task's output was reported, or it was taken off its node: it no
+        // longer loads the node, and no longer consumes its deps. Those that
+        // become freeable are added to `to_free`. Caller holds mu_.
+        void finished_locked_(orion::ObjectId task_id,
+                              std::vector<orion::ObjectId>& to_free);
+
+        // A dispatched task whose output has not been reported yet
+        struct InFlight {
+            std::string node_id;
+            bool counted = true;   // in in_flight_; forwarded tasks are not
+            uint64_t seq = 0;      // dispatch order; the newest are stolen first
+            // Consumed until the output is reported: the node may still have
+            // to fetch them after it has acknowledged the batch
+            std::vector<orion::ObjectId> deps;
+        };
+        void uncount_locked_(const InFlight& in_flight);
+
+        // Drop one consumer from each dep, freeing any that become unused
+        void release_consumers_(const std::vector<orion::ObjectId>& dep_ids);
+        void release_consumers_locked_(const std::vector<orion::ObjectId>& dep_ids,
+                                       std::vector<orion::ObjectId>& to_free);
+
+        // `victim` gave back `stolen` out of `asked`: send those to `thief`
+        // and unpin the deps of the rest
+        void on_stolen_(const std::string& victim, const std::string& thief,
+                        const std::vector<orion::ObjectId>& asked,
+                        const std::vector<orion::ObjectId>& stolen);
+
+        // Sends batches whose linger time has run out
+        void flush_loop_();
 
     private:
         NodeRegistry& registry_;
         NodeClient& client_;
 
-        // object_id -> node_id
-        std::unordered_map<std::string, std::string> object_locations_;
+        struct ObjectInfo {
+            std::string node_id;
+            uint64_t bytes = 0;      // 0 if the node did not say
+            bool released = false;   // by the driver; may be freed at any time
+        };
+
+        // object_id -> where it lives and how big it is
+        std::unordered_map<orion::ObjectId, ObjectInfo> object_locations_;
+
+        // Dispatched tasks whose output has not been reported yet, and how
+        // many of them (not forwarded) each node has
+        std::unordered_map<orion::ObjectId, InFlight> running_;
+        std::unordered_map<std::string, size_t> in_flight_;
+        uint64_t next_seq_ = 0;
+        bool retry_ = false;   // requeued by a failed batch, not scheduled yet
+        size_t next_start_ = 0;   // rotates the Locality tie-break
+        std::vector<double> load_scratch_;   // place_local_'s, reused
+        std::minstd_rand rng_{0x5eed};   // PowerOfTwo samples
+
+        // Tasks waiting for deps, by slot; freed slots are reused. Freeing a
+        // slot bumps its generation, which voids the waiters_ entries still
+        // naming it.
+        struct PendingTask {
+            orion::Task task;
+            size_t unmet = 0;   // deps not located when it was indexed
+            uint32_t gen = 0;
+        };
+        std::vector<PendingTask> pending_;
+        std::vector<size_t> free_slots_;
+        size_t pending_count_ = 0;
+
+        // unlocated object id -> (slot, generation) of the tasks waiting on it
+        std::unordered_map<orion::ObjectId, std::vector<std::pair<size_t, uint32_t>>> waiters_;
+
+        // node_id -> waiting tasks not forwarded there because it was busy
+        std::unordered_map<std::string, std::vector<std::pair<size_t, uint32_t>>> held_back_;
+
+        // Tasks to place: every dep located, or forwardable when readied.
+        // schedule_pass_() checks again before placing them.
+        std::deque<orion::Task> ready_;
 
-        // tasks waiting for deps
-        std::queue<orion::Task> pending_;
+        // Submitted or requeued tasks whose output has not been reported yet
+        std::unordered_set<orion::ObjectId> producing_;
+
+        // How to produce an object again
+        struct Lineage {
+            orion::Task spec;          // id, function_name, args, deps
+            size_t children = 0;       // kept lineage entries that take it as a dep
+            bool released = false;     // the driver dropped its handle
+        };
+        std::unordered_map<orion::ObjectId, Lineage> lineage_;
+
+        // object_id -> number of pending or unfinished tasks that take it as
+        // a dep
+        std::unordered_map<orion::ObjectId, size_t> pending_consumers_;
+
+        // released by the driver, not yet freed on a node
+        std::unordered_set<orion::ObjectId> released_;
+
+        // Nodes asked to give tasks back, and the tasks asked for. Their
+        // dependents are not forwarded meanwhile.
+        std::unordered_set<std::string> stealing_from_;
+        std::unordered_set<orion::ObjectId> stealing_;
+
+        // A schedule() pass is running / another was requested meanwhile
+        bool scheduling_ = false;
+        bool rescan_ = false;
 
         mutable std::mutex mu_;
+
+        // Per-node batches waiting to be sent. Guarded by out_mu_, which is
+        // never held together with mu_.
+        struct Outbox {
+            std::vector<orion::Task> tasks;
+            std::chrono::steady_clock::time_point deadline;   // of the oldest task
+        };
+
+        DispatchOptions options_;
+        std::unordered_map<std::string, Outbox> outboxes_;
+        bool stopping_ = false;
+        std::mutex out_mu_;
+        std::condition_variable out_cv_;
+        std::thread flusher_;
     };
 
 } // namespace orion::distributed
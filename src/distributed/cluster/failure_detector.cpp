@@ -0,0 +1,45 @@
+// failure_detector.cpp — see failure_detector.h
+
+#include "failure_detector.h"
+
+#include <iostream>
+
+namespace orion::distributed {
+
+    FailureDetector::FailureDetector(NodeRegistry& registry, DeadHook on_dead,
+                                     FailureDetectorOptions options, TickHook on_tick)
+        : registry_(registry),
+          on_dead_(std::move(on_dead)),
+          on_tick_(std::move(on_tick)),
+          options_(options) {
+        thread_ = std::thread(&FailureDetector::run_loop, this);
+    }
+
+    FailureDetector::~FailureDetector() {
+        {
+            std::lock_guard<std::mutex> lock(mu_);
+            stopping_ = true;
+        }
+        cv_.notify_one();
+        thread_.join();
+    }
+
+    void FailureDetector::check() {
+        for (const auto& node_id : registry_.evict_silent(options_.timeout)) {
+            std::cout << "[FailureDetector] " << node_id << " silent for over "
+                      << options_.timeout.count() << " ms; declared dead\n" << std::flush;
+            if (on_dead_) on_dead_(node_id);
+        }
+        if (on_tick_) on_tick_();
+    }
+
+    void FailureDetector::run_loop() {
+        std::unique_lock<std::mutex> lock(mu_);
+        while (!cv_.wait_for(lock, options_.interval, [&] { return stopping_; })) {
+            lock.unlock();
+            check();
+            lock.lock();
+        }
+    }
+
+} // namespace orion::distributed
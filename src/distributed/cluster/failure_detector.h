@@ -0,0 +1,58 @@
+// failure_detector.h — declares nodes dead once their heartbeats stop
+//
+// Every `interval`, nodes that have not sent a heartbeat for `timeout` are
+// marked dead in the NodeRegistry, so no new work is placed on them, and
+// handed to `on_dead` (the head passes them to ClusterScheduler::on_node_dead).
+// A dead node that comes back is told it is unknown and registers again.
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "node_registry.h"
+
+namespace orion::distributed {
+
+    struct FailureDetectorOptions {
+        // Silence after which a node is dead. Nodes beat every
+        // NodeRuntime::kHeartbeatInterval (100 ms) by default.
+        std::chrono::milliseconds timeout{1000};
+        std::chrono::milliseconds interval{100};
+    };
+
+    class FailureDetector {
+    public:
+        using DeadHook = std::function<void(const std::string& node_id)>;
+        using TickHook = std::function<void()>;
+
+        // `on_tick` runs after every check, dead nodes or not
+        FailureDetector(NodeRegistry& registry, DeadHook on_dead,
+                        FailureDetectorOptions options = {}, TickHook on_tick = {});
+        ~FailureDetector();
+
+        FailureDetector(const FailureDetector&) = delete;
+        FailureDetector& operator=(const FailureDetector&) = delete;
+
+        // One round; the detector's thread calls this every interval
+        void check();
+
+    private:
+        void run_loop();
+
+        NodeRegistry& registry_;
+        DeadHook on_dead_;
+        TickHook on_tick_;
+        FailureDetectorOptions options_;
+
+        bool stopping_ = false;
+        std::mutex mu_;
+        std::condition_variable cv_;
+        std::thread thread_;
+    };
+
+} // namespace orion::distributed
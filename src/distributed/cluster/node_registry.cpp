@@ -4,58 +4,159 @@
 
 #include "node_registry.h"
 
-#include "node_registry.h"
-
 namespace orion::distributed {
 
+    namespace {
+
+        using Clock = std::chrono::steady_clock;
+
+        // Unique across registries, so a thread's cached snapshot can never
+        // be mistaken for another registry's
+        std::atomic<uint64_t> g_next_version{1};
+
+    } // namespace
+
+    NodeState::NodeState(const NodeInfo& info)
+        : node_id(info.node_id),
+          address(info.address),
+          available_workers(info.available_workers),
+          alive_(info.alive) {
+        set_load(info.load);
+        touch();
+    }
+
+    NodeLoad NodeState::load() const {
+        NodeLoad load;
+        load.cpus = cpus_.load(std::memory_order_relaxed);
+        load.queued = queued_.load(std::memory_order_relaxed);
+        load.running = running_.load(std::memory_order_relaxed);
+        load.memory_bytes = memory_bytes_.load(std::memory_order_relaxed);
+        load.memory_budget = memory_budget_.load(std::memory_order_relaxed);
+        return load;
+    }
+
+    Clock::time_point NodeState::last_heartbeat() const {
+        return Clock::time_point(Clock::duration(last_heartbeat_.load(std::memory_order_relaxed)));
+    }
+
+    NodeInfo NodeState::info() const {
+        NodeInfo info{node_id, address, available_workers, alive()};
+        info.load = load();
+        info.last_heartbeat = last_heartbeat();
+        return info;
+    }
+
+    void NodeState::set_load(const NodeLoad& load) {
+        cpus_.store(load.cpus, std::memory_order_relaxed);
+        queued_.store(load.queued, std::memory_order_relaxed);
+        running_.store(load.running, std::memory_order_relaxed);
+        memory_bytes_.store(load.memory_bytes, std::memory_order_relaxed);
+        memory_budget_.store(load.memory_budget, std::memory_order_relaxed);
+    }
+
+    void NodeState::touch() {
+        last_heartbeat_.store(Clock::now().time_since_epoch().count(), std::memory_order_relaxed);
+    }
+
+    NodeSnapshot::NodeSnapshot(uint64_t version,
+                               std::vector<std::shared_ptr<const NodeState>> nodes)
+        : version(version), nodes(std::move(nodes)) {
+        by_id_.reserve(this->nodes.size());
+        for (const auto& node : this->nodes) by_id_.emplace(node->node_id, node.get());
+    }
+
+    const NodeState* NodeSnapshot::find(std::string_view node_id) const {
+        auto it = by_id_.find(node_id);
+        return it == by_id_.end() ? nullptr : it->second;
+    }
+
+    NodeRegistry::NodeRegistry() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        publish_locked_();
+    }
+
     void NodeRegistry::register_node(const NodeInfo& node) {
         std::lock_guard<std::mutex> lock(mutex_);
-        nodes_[node.node_id] = node;
+        // A new state even for a known node: its address or workers may differ
+        nodes_[node.node_id] = std::make_shared<NodeState>(node);
+        publish_locked_();
     }
 
     void NodeRegistry::remove_node(const std::string& node_id) {
         std::lock_guard<std::mutex> lock(mutex_);
-        nodes_.erase(node_id);
+        if (nodes_.erase(node_id)) publish_locked_();
     }
 
-    void NodeRegistry::heartbeat(const std::string& node_id) {
+    bool NodeRegistry::heartbeat(const std::string& node_id, const NodeLoad& load) {
         std::lock_guard<std::mutex> lock(mutex_);
-        if (nodes_.count(node_id)) {
-            nodes_[node_id].alive = true;
-        }
+        auto it = nodes_.find(node_id);
+        if (it == nodes_.end() || !it->second->alive()) return false;
+        it->second->set_load(load);
+        it->second->touch();
+        return true;
     }
 
-    std::vector<NodeInfo> NodeRegistry::nodes() {
+    std::vector<std::string> NodeRegistry::evict_silent(Clock::duration timeout) {
+        const auto deadline = Clock::now() - timeout;
         std::lock_guard<std::mutex> lock(mutex_);
-        std::vector<NodeInfo> result;
-        result.reserve(nodes_.size());
-
-        for (const auto& [id, node] : nodes_) {
-            if (node.alive) {
-                result.push_back(node);
+        std::vector<std::string> dead;
+        for (auto& [id, node] : nodes_) {
+            if (node->alive() && node->last_heartbeat() < deadline) {
+                node->alive_.store(false, std::memory_order_relaxed);
+                dead.push_back(id);
             }
         }
-        return result;
+        if (!dead.empty()) publish_locked_();
+        return dead;
     }
 
-    std::optional<NodeInfo> NodeRegistry::pick_node() {
-        std::lock_guard<std::mutex> lock(mutex_);
-
-        if (nodes_.empty()) return std::nullopt;
-
-        std::vector<NodeInfo> alive_nodes;
+    void NodeRegistry::publish_locked_() {
+        std::vector<std::shared_ptr<const NodeState>> alive;
+        alive.reserve(nodes_.size());
         for (const auto& [id, node] : nodes_) {
-            if (node.alive) {
-                alive_nodes.push_back(node);
-            }
+            if (node->alive()) alive.push_back(node);
+        }
+        current_ = std::make_shared<const NodeSnapshot>(
+            g_next_version.fetch_add(1, std::memory_order_relaxed), std::move(alive));
+        version_.store(current_->version, std::memory_order_release);
+    }
+
+    std::shared_ptr<const NodeSnapshot> NodeRegistry::snapshot() const {
+        // RCU-style: each thread keeps the last snapshot it read and only
+        // takes the lock when a newer one has been published. Old snapshots
+        // are freed once no thread holds them.
+        struct Cached {
+            uint64_t version = 0;
+            std::shared_ptr<const NodeSnapshot> members;
+        };
+        thread_local Cached cached;
+        if (cached.version != version_.load(std::memory_order_acquire)) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            cached.members = current_;
+            cached.version = current_->version;
         }
+        return cached.members;
+    }
 
-        if (alive_nodes.empty()) return std::nullopt;
+    std::vector<NodeInfo> NodeRegistry::nodes() const {
+        auto members = snapshot();
+        std::vector<NodeInfo> result;
+        result.reserve(members->nodes.size());
+        for (const auto& node : members->nodes) result.push_back(node->info());
+        return result;
+    }
 
-        NodeInfo chosen = alive_nodes[rr_index_ % alive_nodes.size()];
-        rr_index_++;
+    std::optional<NodeInfo> NodeRegistry::node(const std::string& node_id) const {
+        auto members = snapshot();
+        const NodeState* node = members->find(node_id);
+        if (!node) return std::nullopt;
+        return node->info();
+    }
 
-        return chosen;
+    const NodeState* NodeRegistry::pick_node(const NodeSnapshot& members) {
+        if (members.nodes.empty()) return nullptr;
+        const size_t i = rr_index_.fetch_add(1, std::memory_order_relaxed);
+        return members.nodes[i % members.nodes.size()].get();
     }
 
-} // namespace orion::distributed
\ No newline at end of file
+} // namespace orion::distributed
@@ -9,7 +9,12 @@
 
 #pragma once
 
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <vector>
 #include <mutex>
@@ -17,35 +22,119 @@
 
 namespace orion::distributed {
 
+    // What a node reports about itself when registering and in every
+    // heartbeat
+    struct NodeLoad {
+        int cpus = 0;                  // hardware threads
+        size_t queued = 0;             // accepted, not started (incl. waiting for inputs)
+        size_t running = 0;
+        uint64_t memory_bytes = 0;     // object store payload bytes in memory
+        uint64_t memory_budget = 0;    // 0 = unlimited
+    };
+
     struct NodeInfo {
         std::string node_id;
         std::string address;      // "host:port"
-        int available_workers;    // simple resource metric
+        int available_workers;    // worker threads
         bool alive = true;
+        NodeLoad load = {};       // as of the last heartbeat
+        std::chrono::steady_clock::time_point last_heartbeat = {};
+    };
+
+    // A registered node as the registry keeps it. Its identity is fixed;
+    // heartbeats update its load and liveness in place, so snapshots need
+    // not be rebuilt for them.
+    class NodeState {
+    public:
+        explicit NodeState(const NodeInfo& info);
+
+        const std::string node_id;
+        const std::string address;
+        const int available_workers;
+
+        // As of the last heartbeat. The fields are read one by one, so they
+        // may come from two consecutive heartbeats.
+        NodeLoad load() const;
+        bool alive() const { return alive_.load(std::memory_order_relaxed); }
+        std::chrono::steady_clock::time_point last_heartbeat() const;
+
+        // A copy, for callers that keep it
+        NodeInfo info() const;
+
+    private:
+        friend class NodeRegistry;
+        void set_load(const NodeLoad& load);
+        void touch();   // heartbeat now
+
+        std::atomic<int> cpus_{0};
+        std::atomic<size_t> queued_{0};
+        std::atomic<size_t> running_{0};
+        std::atomic<uint64_t> memory_bytes_{0};
+        std::atomic<uint64_t> memory_budget_{0};
+        std::atomic<std::chrono::steady_clock::rep> last_heartbeat_{0};
+        std::atomic<bool> alive_{true};
+    };
+
+    // The alive nodes at one version of the membership. Never changes once
+    // published; registering, removing or losing a node publishes another.
+    class NodeSnapshot {
+    public:
+        NodeSnapshot(uint64_t version, std::vector<std::shared_ptr<const NodeState>> nodes);
+
+        const uint64_t version;
+        const std::vector<std::shared_ptr<const NodeState>> nodes;   // in no particular order
+
+        // nullptr if the node was not alive at this version
+        const NodeState* find(std::string_view node_id) const;
+
+    private:
+        std::unordered_map<std::string_view, const NodeState*> by_id_;
     };
 
     class NodeRegistry {
     public:
+        NodeRegistry();
+
         // Add or update node
         void register_node(const NodeInfo& node);
 
         // Remove node (or mark dead)
         void remove_node(const std::string& node_id);
 
-        // Mark node heartbeat
-        void heartbeat(const std::string& node_id);
+        // Mark node heartbeat, recording its load. False if the node is not
+        // registered or was declared dead (it should register again).
+        bool heartbeat(const std::string& node_id, const NodeLoad& load = {});
+
+        // Mark live nodes whose last heartbeat (or registration) is older
+        // than `timeout` dead. Returns the nodes that just died.
+        std::vector<std::string> evict_silent(std::chrono::steady_clock::duration timeout);
+
+        // The current membership, for the dispatch path: no lock and no
+        // allocation unless it changed since this thread last asked.
+        // Holding it keeps its nodes readable after they leave.
+        std::shared_ptr<const NodeSnapshot> snapshot() const;
 
-        // List all nodes
-        std::vector<NodeInfo> nodes();
+        // List all alive nodes (copies)
+        std::vector<NodeInfo> nodes() const;
 
-        // Pick a node for scheduling (round-robin)
-        std::optional<NodeInfo> pick_node();
+        // One node, if it is registered and alive (a copy)
+        std::optional<NodeInfo> node(const std::string& node_id) const;
+
+        // Pick a node of `members` for scheduling (round-robin)
+        const NodeState* pick_node(const NodeSnapshot& members);
 
     private:
-        std::unordered_map<std::string, NodeInfo> nodes_;
-        std::mutex mutex_;
+        // Build and publish a snapshot of the alive nodes. Caller holds mutex_.
+        void publish_locked_();
+
+        // Dead nodes stay until they register again, so their heartbeats
+        // can be told apart from unknown ones
+        std::unordered_map<std::string, std::shared_ptr<NodeState>> nodes_;
+        std::shared_ptr<const NodeSnapshot> current_;   // guarded by mutex_
+        std::atomic<uint64_t> version_{0};              // current_->version
+        mutable std::mutex mutex_;
 
-        size_t rr_index_ = 0;   // round robin pointer
+        std::atomic<size_t> rr_index_{0};   // round robin pointer
     };
 
 } // namespace orion::distributed
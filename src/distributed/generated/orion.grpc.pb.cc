@@ -1,317 +0,0 @@
-// Generated by the gRPC C++ plugin.
-// If you make any local change, they will be lost.
-// source: orion.proto
-
-#include "orion.pb.h"
-#include "orion.grpc.pb.h"
-
-#include <functional>
-#include <grpcpp/support/async_stream.h>
-#include <grpcpp/support/async_unary_call.h>
-#include <grpcpp/impl/channel_interface.h>
-#include <grpcpp/impl/client_unary_call.h>
-#include <grpcpp/support/client_callback.h>
-#include <grpcpp/support/message_allocator.h>
-#include <grpcpp/support/method_handler.h>
-#include <grpcpp/impl/rpc_service_method.h>
-#include <grpcpp/support/server_callback.h>
-#include <grpcpp/impl/server_callback_handlers.h>
-#include <grpcpp/server_context.h>
-#include <grpcpp/impl/service_type.h>
-#include <grpcpp/support/sync_stream.h>
-#include <grpcpp/ports_def.inc>
-namespace orion {
-
-static const char* ClusterHead_method_names[] = {
-  "/orion.ClusterHead/RegisterNode",
-  "/orion.ClusterHead/SubmitTask",
-  "/orion.ClusterHead/ReportObjectCreated",
-  "/orion.ClusterHead/GetObjectLocation",
-};
-
-std::unique_ptr< ClusterHead::Stub> ClusterHead::NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options) {
-  (void)options;
-  std::unique_ptr< ClusterHead::Stub> stub(new ClusterHead::Stub(channel, options));
-  return stub;
-}
-
-ClusterHead::Stub::Stub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options)
-  : channel_(channel), rpcmethod_RegisterNode_(ClusterHead_method_names[0], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_SubmitTask_(ClusterHead_method_names[1], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_ReportObjectCreated_(ClusterHead_method_names[2], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_GetObjectLocation_(ClusterHead_method_names[3], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  {}
-
-::grpc::Status ClusterHead::Stub::RegisterNode(::grpc::ClientContext* context, const ::orion::RegisterNodeRequest& request, ::orion::RegisterNodeReply* response) {
-  return ::grpc::internal::BlockingUnaryCall< ::orion::RegisterNodeRequest, ::orion::RegisterNodeReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_RegisterNode_, context, request, response);
-}
-
-void ClusterHead::Stub::async::RegisterNode(::grpc::ClientContext* context, const ::orion::RegisterNodeRequest* request, ::orion::RegisterNodeReply* response, std::function<void(::grpc::Status)> f) {
-  ::grpc::internal::CallbackUnaryCall< ::orion::RegisterNodeRequest, ::orion::RegisterNodeReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_RegisterNode_, context, request, response, std::move(f));
-}
-
-void ClusterHead::Stub::async::RegisterNode(::grpc::ClientContext* context, const ::orion::RegisterNodeRequest* request, ::orion::RegisterNodeReply* response, ::grpc::ClientUnaryReactor* reactor) {
-  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_RegisterNode_, context, request, response, reactor);
-}
-
-::grpc::ClientAsyncResponseReader< ::orion::RegisterNodeReply>* ClusterHead::Stub::PrepareAsyncRegisterNodeRaw(::grpc::ClientContext* context, const ::orion::RegisterNodeRequest& request, ::grpc::CompletionQueue* cq) {
-  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::orion::RegisterNodeReply, ::orion::RegisterNodeRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_RegisterNode_, context, request);
-}
-
-::grpc::ClientAsyncResponseReader< ::orion::RegisterNodeReply>* ClusterHead::Stub::AsyncRegisterNodeRaw(::grpc::ClientContext* context, const ::orion::RegisterNodeRequest& request, ::grpc::CompletionQueue* cq) {
-  auto* result =
-    this->PrepareAsyncRegisterNodeRaw(context, request, cq);
-  result->StartCall();
-  return result;
-}
-
-::grpc::Status ClusterHead::Stub::SubmitTask(::grpc::ClientContext* context, const ::orion::TaskRequest& request, ::orion::TaskReply* response) {
-  return ::grpc::internal::BlockingUnaryCall< ::orion::TaskRequest, ::orion::TaskReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_SubmitTask_, context, request, response);
-}
-
-void ClusterHead::Stub::async::SubmitTask(::grpc::ClientContext* context, const ::orion::TaskRequest* request, ::orion::TaskReply* response, std::function<void(::grpc::Status)> f) {
-  ::grpc::internal::CallbackUnaryCall< ::orion::TaskRequest, ::orion::TaskReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_SubmitTask_, context, request, response, std::move(f));
-}
-
-void ClusterHead::Stub::async::SubmitTask(::grpc::ClientContext* context, const ::orion::TaskRequest* request, ::orion::TaskReply* response, ::grpc::ClientUnaryReactor* reactor) {
-  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_SubmitTask_, context, request, response, reactor);
-}
-
-::grpc::ClientAsyncResponseReader< ::orion::TaskReply>* ClusterHead::Stub::PrepareAsyncSubmitTaskRaw(::grpc::ClientContext* context, const ::orion::TaskRequest& request, ::grpc::CompletionQueue* cq) {
-  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::orion::TaskReply, ::orion::TaskRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_SubmitTask_, context, request);
-}
-
-::grpc::ClientAsyncResponseReader< ::orion::TaskReply>* ClusterHead::Stub::AsyncSubmitTaskRaw(::grpc::ClientContext* context, const ::orion::TaskRequest& request, ::grpc::CompletionQueue* cq) {
-  auto* result =
-    this->PrepareAsyncSubmitTaskRaw(context, request, cq);
-  result->StartCall();
-  return result;
-}
-
-::grpc::Status ClusterHead::Stub::ReportObjectCreated(::grpc::ClientContext* context, const ::orion::ObjectReport& request, ::orion::Empty* response) {
-  return ::grpc::internal::BlockingUnaryCall< ::orion::ObjectReport, ::orion::Empty, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_ReportObjectCreated_, context, request, response);
-}
-
-void ClusterHead::Stub::async::ReportObjectCreated(::grpc::ClientContext* context, const ::orion::ObjectReport* request, ::orion::Empty* response, std::function<void(::grpc::Status)> f) {
-  ::grpc::internal::CallbackUnaryCall< ::orion::ObjectReport, ::orion::Empty, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_ReportObjectCreated_, context, request, response, std::move(f));
-}
-
-void ClusterHead::Stub::async::ReportObjectCreated(::grpc::ClientContext* context, const ::orion::ObjectReport* request, ::orion::Empty* response, ::grpc::ClientUnaryReactor* reactor) {
-  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_ReportObjectCreated_, context, request, response, reactor);
-}
-
-::grpc::ClientAsyncResponseReader< ::orion::Empty>* ClusterHead::Stub::PrepareAsyncReportObjectCreatedRaw(::grpc::ClientContext* context, const ::orion::ObjectReport& request, ::grpc::CompletionQueue* cq) {
-  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::orion::Empty, ::orion::ObjectReport, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_ReportObjectCreated_, context, request);
-}
-
-::grpc::ClientAsyncResponseReader< ::orion::Empty>* ClusterHead::Stub::AsyncReportObjectCreatedRaw(::grpc::ClientContext* context, const ::orion::ObjectReport& request, ::grpc::CompletionQueue* cq) {
-  auto* result =
-    this->PrepareAsyncReportObjectCreatedRaw(context, request, cq);
-  result->StartCall();
-  return result;
-}
-
-::grpc::Status ClusterHead::Stub::GetObjectLocation(::grpc::ClientContext* context, const ::orion::ObjectLocationRequest& request, ::orion::ObjectLocationReply* response) {
-  return ::grpc::internal::BlockingUnaryCall< ::orion::ObjectLocationRequest, ::orion::ObjectLocationReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_GetObjectLocation_, context, request, response);
-}
-
-void ClusterHead::Stub::async::GetObjectLocation(::grpc::ClientContext* context, const ::orion::ObjectLocationRequest* request, ::orion::ObjectLocationReply* response, std::function<void(::grpc::Status)> f) {
-  ::grpc::internal::CallbackUnaryCall< ::orion::ObjectLocationRequest, ::orion::ObjectLocationReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GetObjectLocation_, context, request, response, std::move(f));
-}
-
-void ClusterHead::Stub::async::GetObjectLocation(::grpc::ClientContext* context, const ::orion::ObjectLocationRequest* request, ::orion::ObjectLocationReply* response, ::grpc::ClientUnaryReactor* reactor) {
-  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GetObjectLocation_, context, request, response, reactor);
-}
-
-::grpc::ClientAsyncResponseReader< ::orion::ObjectLocationReply>* ClusterHead::Stub::PrepareAsyncGetObjectLocationRaw(::grpc::ClientContext* context, const ::orion::ObjectLocationRequest& request, ::grpc::CompletionQueue* cq) {
-  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::orion::ObjectLocationReply, ::orion::ObjectLocationRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_GetObjectLocation_, context, request);
-}
-
-::grpc::ClientAsyncResponseReader< ::orion::ObjectLocationReply>* ClusterHead::Stub::AsyncGetObjectLocationRaw(::grpc::ClientContext* context, const ::orion::ObjectLocationRequest& request, ::grpc::CompletionQueue* cq) {
-  auto* result =
-    this->PrepareAsyncGetObjectLocationRaw(context, request, cq);
-  result->StartCall();
-  return result;
-}
-
-ClusterHead::Service::Service() {
-  AddMethod(new ::grpc::internal::RpcServiceMethod(
-      ClusterHead_method_names[0],
-      ::grpc::internal::RpcMethod::NORMAL_RPC,
-      new ::grpc::internal::RpcMethodHandler< ClusterHead::Service, ::orion::RegisterNodeRequest, ::orion::RegisterNodeReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
-          [](ClusterHead::Service* service,
-             ::grpc::ServerContext* ctx,
-             const ::orion::RegisterNodeRequest* req,
-             ::orion::RegisterNodeReply* resp) {
-               return service->RegisterNode(ctx, req, resp);
-             }, this)));
-  AddMethod(new ::grpc::internal::RpcServiceMethod(
-      ClusterHead_method_names[1],
-      ::grpc::internal::RpcMethod::NORMAL_RPC,
-      new ::grpc::internal::RpcMethodHandler< ClusterHead::Service, ::orion::TaskRequest, ::orion::TaskReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
-          [](ClusterHead::Service* service,
-             ::grpc::ServerContext* ctx,
-             const ::orion::TaskRequest* req,
-             ::orion::TaskReply* resp) {
-               return service->SubmitTask(ctx, req, resp);
-             }, this)));
-  AddMethod(new ::grpc::internal::RpcServiceMethod(
-      ClusterHead_method_names[2],
-      ::grpc::internal::RpcMethod::NORMAL_RPC,
-      new ::grpc::internal::RpcMethodHandler< ClusterHead::Service, ::orion::ObjectReport, ::orion::Empty, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
-          [](ClusterHead::Service* service,
-             ::grpc::ServerContext* ctx,
-             const ::orion::ObjectReport* req,
-             ::orion::Empty* resp) {
-               return service->ReportObjectCreated(ctx, req, resp);
-             }, this)));
-  AddMethod(new ::grpc::internal::RpcServiceMethod(
-      ClusterHead_method_names[3],
-      ::grpc::internal::RpcMethod::NORMAL_RPC,
-      new ::grpc::internal::RpcMethodHandler< ClusterHead::Service, ::orion::ObjectLocationRequest, ::orion::ObjectLocationReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
-          [](ClusterHead::Service* service,
-             ::grpc::ServerContext* ctx,
-             const ::orion::ObjectLocationRequest* req,
-             ::orion::ObjectLocationReply* resp) {
-               return service->GetObjectLocation(ctx, req, resp);
-             }, this)));
-}
-
-ClusterHead::Service::~Service() {
-}
-
-::grpc::Status ClusterHead::Service::RegisterNode(::grpc::ServerContext* context, const ::orion::RegisterNodeRequest* request, ::orion::RegisterNodeReply* response) {
-  (void) context;
-  (void) request;
-  (void) response;
-  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-}
-
-::grpc::Status ClusterHead::Service::SubmitTask(::grpc::ServerContext* context, const ::orion::TaskRequest* request, ::orion::TaskReply* response) {
-  (void) context;
-  (void) request;
-  (void) response;
-  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-}
-
-::grpc::Status ClusterHead::Service::ReportObjectCreated(::grpc::ServerContext* context, const ::orion::ObjectReport* request, ::orion::Empty* response) {
-  (void) context;
-  (void) request;
-  (void) response;
-  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-}
-
-::grpc::Status ClusterHead::Service::GetObjectLocation(::grpc::ServerContext* context, const ::orion::ObjectLocationRequest* request, ::orion::ObjectLocationReply* response) {
-  (void) context;
-  (void) request;
-  (void) response;
-  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-}
-
-
-static const char* NodeService_method_names[] = {
-  "/orion.NodeService/ExecuteTask",
-  "/orion.NodeService/GetObject",
-};
-
-std::unique_ptr< NodeService::Stub> NodeService::NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options) {
-  (void)options;
-  std::unique_ptr< NodeService::Stub> stub(new NodeService::Stub(channel, options));
-  return stub;
-}
-
-NodeService::Stub::Stub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options)
-  : channel_(channel), rpcmethod_ExecuteTask_(NodeService_method_names[0], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_GetObject_(NodeService_method_names[1], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  {}
-
-::grpc::Status NodeService::Stub::ExecuteTask(::grpc::ClientContext* context, const ::orion::TaskRequest& request, ::orion::TaskReply* response) {
-  return ::grpc::internal::BlockingUnaryCall< ::orion::TaskRequest, ::orion::TaskReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_ExecuteTask_, context, request, response);
-}
-
-void NodeService::Stub::async::ExecuteTask(::grpc::ClientContext* context, const ::orion::TaskRequest* request, ::orion::TaskReply* response, std::function<void(::grpc::Status)> f) {
-  ::grpc::internal::CallbackUnaryCall< ::orion::TaskRequest, ::orion::TaskReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_ExecuteTask_, context, request, response, std::move(f));
-}
-
-void NodeService::Stub::async::ExecuteTask(::grpc::ClientContext* context, const ::orion::TaskRequest* request, ::orion::TaskReply* response, ::grpc::ClientUnaryReactor* reactor) {
-  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_ExecuteTask_, context, request, response, reactor);
-}
-
-::grpc::ClientAsyncResponseReader< ::orion::TaskReply>* NodeService::Stub::PrepareAsyncExecuteTaskRaw(::grpc::ClientContext* context, const ::orion::TaskRequest& request, ::grpc::CompletionQueue* cq) {
-  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::orion::TaskReply, ::orion::TaskRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_ExecuteTask_, context, request);
-}
-
-::grpc::ClientAsyncResponseReader< ::orion::TaskReply>* NodeService::Stub::AsyncExecuteTaskRaw(::grpc::ClientContext* context, const ::orion::TaskRequest& request, ::grpc::CompletionQueue* cq) {
-  auto* result =
-    this->PrepareAsyncExecuteTaskRaw(context, request, cq);
-  result->StartCall();
-  return result;
-}
-
-::grpc::Status NodeService::Stub::GetObject(::grpc::ClientContext* context, const ::orion::ObjectLocationRequest& request, ::orion::ObjectData* response) {
-  return ::grpc::internal::BlockingUnaryCall< ::orion::ObjectLocationRequest, ::orion::ObjectData, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_GetObject_, context, request, response);
-}
-
-void NodeService::Stub::async::GetObject(::grpc::ClientContext* context, const ::orion::ObjectLocationRequest* request, ::orion::ObjectData* response, std::function<void(::grpc::Status)> f) {
-  ::grpc::internal::CallbackUnaryCall< ::orion::ObjectLocationRequest, ::orion::ObjectData, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GetObject_, context, request, response, std::move(f));
-}
-
-void NodeService::Stub::async::GetObject(::grpc::ClientContext* context, const ::orion::ObjectLocationRequest* request, ::orion::ObjectData* response, ::grpc::ClientUnaryReactor* reactor) {
-  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GetObject_, context, request, response, reactor);
-}
-
-::grpc::ClientAsyncResponseReader< ::orion::ObjectData>* NodeService::Stub::PrepareAsyncGetObjectRaw(::grpc::ClientContext* context, const ::orion::ObjectLocationRequest& request, ::grpc::CompletionQueue* cq) {
-  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::orion::ObjectData, ::orion::ObjectLocationRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_GetObject_, context, request);
-}
-
-::grpc::ClientAsyncResponseReader< ::orion::ObjectData>* NodeService::Stub::AsyncGetObjectRaw(::grpc::ClientContext* context, const ::orion::ObjectLocationRequest& request, ::grpc::CompletionQueue* cq) {
-  auto* result =
-    this->PrepareAsyncGetObjectRaw(context, request, cq);
-  result->StartCall();
-  return result;
-}
-
-NodeService::Service::Service() {
-  AddMethod(new ::grpc::internal::RpcServiceMethod(
-      NodeService_method_names[0],
-      ::grpc::internal::RpcMethod::NORMAL_RPC,
-      new ::grpc::internal::RpcMethodHandler< NodeService::Service, ::orion::TaskRequest, ::orion::TaskReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
-          [](NodeService::Service* service,
-             ::grpc::ServerContext* ctx,
-             const ::orion::TaskRequest* req,
-             ::orion::TaskReply* resp) {
-               return service->ExecuteTask(ctx, req, resp);
-             }, this)));
-  AddMethod(new ::grpc::internal::RpcServiceMethod(
-      NodeService_method_names[1],
-      ::grpc::internal::RpcMethod::NORMAL_RPC,
-      new ::grpc::internal::RpcMethodHandler< NodeService::Service, ::orion::ObjectLocationRequest, ::orion::ObjectData, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
-          [](NodeService::Service* service,
-             ::grpc::ServerContext* ctx,
-             const ::orion::ObjectLocationRequest* req,
-             ::orion::ObjectData* resp) {
-               return service->GetObject(ctx, req, resp);
-             }, this)));
-}
-
-NodeService::Service::~Service() {
-}
-
-::grpc::Status NodeService::Service::ExecuteTask(::grpc::ServerContext* context, const ::orion::TaskRequest* request, ::orion::TaskReply* response) {
-  (void) context;
-  (void) request;
-  (void) response;
-  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-}
-
-::grpc::Status NodeService::Service::GetObject(::grpc::ServerContext* context, const ::orion::ObjectLocationRequest* request, ::orion::ObjectData* response) {
-  (void) context;
-  (void) request;
-  (void) response;
-  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-}
-
-
-}  // namespace orion
-#include <grpcpp/ports_undef.inc>
-
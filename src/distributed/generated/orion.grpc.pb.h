@@ -1,1077 +0,0 @@
-// Generated by the gRPC C++ plugin.
-// If you make any local change, they will be lost.
-// source: orion.proto
-#ifndef GRPC_orion_2eproto__INCLUDED
-#define GRPC_orion_2eproto__INCLUDED
-
-#include "orion.pb.h"
-
-#include <functional>
-#include <grpcpp/generic/async_generic_service.h>
-#include <grpcpp/support/async_stream.h>
-#include <grpcpp/support/async_unary_call.h>
-#include <grpcpp/support/client_callback.h>
-#include <grpcpp/client_context.h>
-#include <grpcpp/completion_queue.h>
-#include <grpcpp/support/message_allocator.h>
-#include <grpcpp/support/method_handler.h>
-#include <grpcpp/impl/proto_utils.h>
-#include <grpcpp/impl/rpc_method.h>
-#include <grpcpp/support/server_callback.h>
-#include <grpcpp/impl/server_callback_handlers.h>
-#include <grpcpp/server_context.h>
-#include <grpcpp/impl/service_type.h>
-#include <grpcpp/support/status.h>
-#include <grpcpp/support/stub_options.h>
-#include <grpcpp/support/sync_stream.h>
-#include <grpcpp/ports_def.inc>
-
-namespace orion {
-
-class ClusterHead final {
- public:
-  static constexpr char const* service_full_name() {
-    return "orion.ClusterHead";
-  }
-  class StubInterface {
-   public:
-    virtual ~StubInterface() {}
-    virtual ::grpc::Status RegisterNode(::grpc::ClientContext* context, const ::orion::RegisterNodeRequest& request, ::orion::RegisterNodeReply* response) = 0;
-    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::orion::RegisterNodeReply>> AsyncRegisterNode(::grpc::ClientContext* context, const ::orion::RegisterNodeRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::orion::RegisterNodeReply>>(AsyncRegisterNodeRaw(context, request, cq));
-    }
-    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::orion::RegisterNodeReply>> PrepareAsyncRegisterNode(::grpc::ClientContext* context, const ::orion::RegisterNodeRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::orion::RegisterNodeReply>>(PrepareAsyncRegisterNodeRaw(context, request, cq));
-    }
-    virtual ::grpc::Status SubmitTask(::grpc::ClientContext* context, const ::orion::TaskRequest& request, ::orion::TaskReply* response) = 0;
-    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::orion::TaskReply>> AsyncSubmitTask(::grpc::ClientContext* context, const ::orion::TaskRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::orion::TaskReply>>(AsyncSubmitTaskRaw(context, request, cq));
-    }
-    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::orion::TaskReply>> PrepareAsyncSubmitTask(::grpc::ClientContext* context, const ::orion::TaskRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::orion::TaskReply>>(PrepareAsyncSubmitTaskRaw(context, request, cq));
-    }
-    virtual ::grpc::Status ReportObjectCreated(::grpc::ClientContext* context, const ::orion::ObjectReport& request, ::orion::Empty* response) = 0;
-    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::orion::Empty>> AsyncReportObjectCreated(::grpc::ClientContext* context, const ::orion::ObjectReport& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::orion::Empty>>(AsyncReportObjectCreatedRaw(context, request, cq));
-    }
-    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::orion::Empty>> PrepareAsyncReportObjectCreated(::grpc::ClientContext* context, const ::orion::ObjectReport& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::orion::Empty>>(PrepareAsyncReportObjectCreatedRaw(context, request, cq));
-    }
-    virtual ::grpc::Status GetObjectLocation(::grpc::ClientContext* context, const ::orion::ObjectLocationRequest& request, ::orion::ObjectLocationReply* response) = 0;
-    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::orion::ObjectLocationReply>> AsyncGetObjectLocation(::grpc::ClientContext* context, const ::orion::ObjectLocationRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::orion::ObjectLocationReply>>(AsyncGetObjectLocationRaw(context, request, cq));
-    }
-    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::orion::ObjectLocationReply>> PrepareAsyncGetObjectLocation(::grpc::ClientContext* context, const ::orion::ObjectLocationRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::orion::ObjectLocationReply>>(PrepareAsyncGetObjectLocationRaw(context, request, cq));
-    }
-    class async_interface {
-     public:
-      virtual ~async_interface() {}
-      virtual void RegisterNode(::grpc::ClientContext* context, const ::orion::RegisterNodeRequest* request, ::orion::RegisterNodeReply* response, std::function<void(::grpc::Status)>) = 0;
-      virtual void RegisterNode(::grpc::ClientContext* context, const ::orion::RegisterNodeRequest* request, ::orion::RegisterNodeReply* response, ::grpc::ClientUnaryReactor* reactor) = 0;
-      virtual void SubmitTask(::grpc::ClientContext* context, const ::orion::TaskRequest* request, ::orion::TaskReply* response, std::function<void(::grpc::Status)>) = 0;
-      virtual void SubmitTask(::grpc::ClientContext* context, const ::orion::TaskRequest* request, ::orion::TaskReply* response, ::grpc::ClientUnaryReactor* reactor) = 0;
-      virtual void ReportObjectCreated(::grpc::ClientContext* context, const ::orion::ObjectReport* request, ::orion::Empty* response, std::function<void(::grpc::Status)>) = 0;
-      virtual void ReportObjectCreated(::grpc::ClientContext* context, const ::orion::ObjectReport* request, ::orion::Empty* response, ::grpc::ClientUnaryReactor* reactor) = 0;
-      virtual void GetObjectLocation(::grpc::ClientContext* context, const ::orion::ObjectLocationRequest* request, ::orion::ObjectLocationReply* response, std::function<void(::grpc::Status)>) = 0;
-      virtual void GetObjectLocation(::grpc::ClientContext* context, const ::orion::ObjectLocationRequest* request, ::orion::ObjectLocationReply* response, ::grpc::ClientUnaryReactor* reactor) = 0;
-    };
-    typedef class async_interface experimental_async_interface;
-    virtual class async_interface* async() { return nullptr; }
-    class async_interface* experimental_async() { return async(); }
-   private:
-    virtual ::grpc::ClientAsyncResponseReaderInterface< ::orion::RegisterNodeReply>* AsyncRegisterNodeRaw(::grpc::ClientContext* context, const ::orion::RegisterNodeRequest& request, ::grpc::CompletionQueue* cq) = 0;
-    virtual ::grpc::ClientAsyncResponseReaderInterface< ::orion::RegisterNodeReply>* PrepareAsyncRegisterNodeRaw(::grpc::ClientContext* context, const ::orion::RegisterNodeRequest& request, ::grpc::CompletionQueue* cq) = 0;
-    virtual ::grpc::ClientAsyncResponseReaderInterface< ::orion::TaskReply>* AsyncSubmitTaskRaw(::grpc::ClientContext* context, const ::orion::TaskRequest& request, ::grpc::CompletionQueue* cq) = 0;
-    virtual ::grpc::ClientAsyncResponseReaderInterface< ::orion::TaskReply>* PrepareAsyncSubmitTaskRaw(::grpc::ClientContext* context, const ::orion::TaskRequest& request, ::grpc::CompletionQueue* cq) = 0;
-    virtual ::grpc::ClientAsyncResponseReaderInterface< ::orion::Empty>* AsyncReportObjectCreatedRaw(::grpc::ClientContext* context, const ::orion::ObjectReport& request, ::grpc::CompletionQueue* cq) = 0;
-    virtual ::grpc::ClientAsyncResponseReaderInterface< ::orion::Empty>* PrepareAsyncReportObjectCreatedRaw(::grpc::ClientContext* context, const ::orion::ObjectReport& request, ::grpc::CompletionQueue* cq) = 0;
-    virtual ::grpc::ClientAsyncResponseReaderInterface< ::orion::ObjectLocationReply>* AsyncGetObjectLocationRaw(::grpc::ClientContext* context, const ::orion::ObjectLocationRequest& request, ::grpc::CompletionQueue* cq) = 0;
-    virtual ::grpc::ClientAsyncResponseReaderInterface< ::orion::ObjectLocationReply>* PrepareAsyncGetObjectLocationRaw(::grpc::ClientContext* context, const ::orion::ObjectLocationRequest& request, ::grpc::CompletionQueue* cq) = 0;
-  };
-  class Stub final : public StubInterface {
-   public:
-    Stub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options = ::grpc::StubOptions());
-    ::grpc::Status RegisterNode(::grpc::ClientContext* context, const ::orion::RegisterNodeRequest& request, ::orion::RegisterNodeReply* response) override;
-    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::orion::RegisterNodeReply>> AsyncRegisterNode(::grpc::ClientContext* context, const ::orion::RegisterNodeRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::orion::RegisterNodeReply>>(AsyncRegisterNodeRaw(context, request, cq));
-    }
-    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::orion::RegisterNodeReply>> PrepareAsyncRegisterNode(::grpc::ClientContext* context, const ::orion::RegisterNodeRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::orion::RegisterNodeReply>>(PrepareAsyncRegisterNodeRaw(context, request, cq));
-    }
-    ::grpc::Status SubmitTask(::grpc::ClientContext* context, const ::orion::TaskRequest& request, ::orion::TaskReply* response) override;
-    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::orion::TaskReply>> AsyncSubmitTask(::grpc::ClientContext* context, const ::orion::TaskRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::orion::TaskReply>>(AsyncSubmitTaskRaw(context, request, cq));
-    }
-    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::orion::TaskReply>> PrepareAsyncSubmitTask(::grpc::ClientContext* context, const ::orion::TaskRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::orion::TaskReply>>(PrepareAsyncSubmitTaskRaw(context, request, cq));
-    }
-    ::grpc::Status ReportObjectCreated(::grpc::ClientContext* context, const ::orion::ObjectReport& request, ::orion::Empty* response) override;
-    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::orion::Empty>> AsyncReportObjectCreated(::grpc::ClientContext* context, const ::orion::ObjectReport& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::orion::Empty>>(AsyncReportObjectCreatedRaw(context, request, cq));
-    }
-    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::orion::Empty>> PrepareAsyncReportObjectCreated(::grpc::ClientContext* context, const ::orion::ObjectReport& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::orion::Empty>>(PrepareAsyncReportObjectCreatedRaw(context, request, cq));
-    }
-    ::grpc::Status GetObjectLocation(::grpc::ClientContext* context, const ::orion::ObjectLocationRequest& request, ::orion::ObjectLocationReply* response) override;
-    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::orion::ObjectLocationReply>> AsyncGetObjectLocation(::grpc::ClientContext* context, const ::orion::ObjectLocationRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::orion::ObjectLocationReply>>(AsyncGetObjectLocationRaw(context, request, cq));
-    }
-    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::orion::ObjectLocationReply>> PrepareAsyncGetObjectLocation(::grpc::ClientContext* context, const ::orion::ObjectLocationRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::orion::ObjectLocationReply>>(PrepareAsyncGetObjectLocationRaw(context, request, cq));
-    }
-    class async final :
-      public StubInterface::async_interface {
-     public:
-      void RegisterNode(::grpc::ClientContext* context, const ::orion::RegisterNodeRequest* request, ::orion::RegisterNodeReply* response, std::function<void(::grpc::Status)>) override;
-      void RegisterNode(::grpc::ClientContext* context, const ::orion::RegisterNodeRequest* request, ::orion::RegisterNodeReply* response, ::grpc::ClientUnaryReactor* reactor) override;
-      void SubmitTask(::grpc::ClientContext* context, const ::orion::TaskRequest* request, ::orion::TaskReply* response, std::function<void(::grpc::Status)>) override;
-      void SubmitTask(::grpc::ClientContext* context, const ::orion::TaskRequest* request, ::orion::TaskReply* response, ::grpc::ClientUnaryReactor* reactor) override;
-      void ReportObjectCreated(::grpc::ClientContext* context, const ::orion::ObjectReport* request, ::orion::Empty* response, std::function<void(::grpc::Status)>) override;
-      void ReportObjectCreated(::grpc::ClientContext* context, const ::orion::ObjectReport* request, ::orion::Empty* response, ::grpc::ClientUnaryReactor* reactor) override;
-      void GetObjectLocation(::grpc::ClientContext* context, const ::orion::ObjectLocationRequest* request, ::orion::ObjectLocationReply* response, std::function<void(::grpc::Status)>) override;
-      void GetObjectLocation(::grpc::ClientContext* context, const ::orion::ObjectLocationRequest* request, ::orion::ObjectLocationReply* response, ::grpc::ClientUnaryReactor* reactor) override;
-     private:
-      friend class Stub;
-      explicit async(Stub* stub): stub_(stub) { }
-      Stub* stub() { return stub_; }
-      Stub* stub_;
-    };
-    class async* async() override { return &async_stub_; }
-
-   private:
-    std::shared_ptr< ::grpc::ChannelInterface> channel_;
-    class async async_stub_{this};
-    ::grpc::ClientAsyncResponseReader< ::orion::RegisterNodeReply>* AsyncRegisterNodeRaw(::grpc::ClientContext* context, const ::orion::RegisterNodeRequest& request, ::grpc::CompletionQueue* cq) override;
-    ::grpc::ClientAsyncResponseReader< ::orion::RegisterNodeReply>* PrepareAsyncRegisterNodeRaw(::grpc::ClientContext* context, const ::orion::RegisterNodeRequest& request, ::grpc::CompletionQueue* cq) override;
-    ::grpc::ClientAsyncResponseReader< ::orion::TaskReply>* AsyncSubmitTaskRaw(::grpc::ClientContext* context, const ::orion::TaskRequest& request, ::grpc::CompletionQueue* cq) override;
-    ::grpc::ClientAsyncResponseReader< ::orion::TaskReply>* PrepareAsyncSubmitTaskRaw(::grpc::ClientContext* context, const ::orion::TaskRequest& request, ::grpc::CompletionQueue* cq) override;
-    ::grpc::ClientAsyncResponseReader< ::orion::Empty>* AsyncReportObjectCreatedRaw(::grpc::ClientContext* context, const ::orion::ObjectReport& request, ::grpc::CompletionQueue* cq) override;
-    ::grpc::ClientAsyncResponseReader< ::orion::Empty>* PrepareAsyncReportObjectCreatedRaw(::grpc::ClientContext* context, const ::orion::ObjectReport& request, ::grpc::CompletionQueue* cq) override;
-    ::grpc::ClientAsyncResponseReader< ::orion::ObjectLocationReply>* AsyncGetObjectLocationRaw(::grpc::ClientContext* context, const ::orion::ObjectLocationRequest& request, ::grpc::CompletionQueue* cq) override;
-    ::grpc::ClientAsyncResponseReader< ::orion::ObjectLocationReply>* PrepareAsyncGetObjectLocationRaw(::grpc::ClientContext* context, const ::orion::ObjectLocationRequest& request, ::grpc::CompletionQueue* cq) override;
-    const ::grpc::internal::RpcMethod rpcmethod_RegisterNode_;
-    const ::grpc::internal::RpcMethod rpcmethod_SubmitTask_;
-    const ::grpc::internal::RpcMethod rpcmethod_ReportObjectCreated_;
-    const ::grpc::internal::RpcMethod rpcmethod_GetObjectLocation_;
-  };
-  static std::unique_ptr<Stub> NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options = ::grpc::StubOptions());
-
-  class Service : public ::grpc::Service {
-   public:
-    Service();
-    virtual ~Service();
-    virtual ::grpc::Status RegisterNode(::grpc::ServerContext* context, const ::orion::RegisterNodeRequest* request, ::orion::RegisterNodeReply* response);
-    virtual ::grpc::Status SubmitTask(::grpc::ServerContext* context, const ::orion::TaskRequest* request, ::orion::TaskReply* response);
-    virtual ::grpc::Status ReportObjectCreated(::grpc::ServerContext* context, const ::orion::ObjectReport* request, ::orion::Empty* response);
-    virtual ::grpc::Status GetObjectLocation(::grpc::ServerContext* context, const ::orion::ObjectLocationRequest* request, ::orion::ObjectLocationReply* response);
-  };
-  template <class BaseClass>
-  class WithAsyncMethod_RegisterNode : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithAsyncMethod_RegisterNode() {
-      ::grpc::Service::MarkMethodAsync(0);
-    }
-    ~WithAsyncMethod_RegisterNode() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status RegisterNode(::grpc::ServerContext* /*context*/, const ::orion::RegisterNodeRequest* /*request*/, ::orion::RegisterNodeReply* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    void RequestRegisterNode(::grpc::ServerContext* context, ::orion::RegisterNodeRequest* request, ::grpc::ServerAsyncResponseWriter< ::orion::RegisterNodeReply>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(0, context, request, response, new_call_cq, notification_cq, tag);
-    }
-  };
-  template <class BaseClass>
-  class WithAsyncMethod_SubmitTask : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithAsyncMethod_SubmitTask() {
-      ::grpc::Service::MarkMethodAsync(1);
-    }
-    ~WithAsyncMethod_SubmitTask() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status SubmitTask(::grpc::ServerContext* /*context*/, const ::orion::TaskRequest* /*request*/, ::orion::TaskReply* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    void RequestSubmitTask(::grpc::ServerContext* context, ::orion::TaskRequest* request, ::grpc::ServerAsyncResponseWriter< ::orion::TaskReply>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(1, context, request, response, new_call_cq, notification_cq, tag);
-    }
-  };
-  template <class BaseClass>
-  class WithAsyncMethod_ReportObjectCreated : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithAsyncMethod_ReportObjectCreated() {
-      ::grpc::Service::MarkMethodAsync(2);
-    }
-    ~WithAsyncMethod_ReportObjectCreated() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status ReportObjectCreated(::grpc::ServerContext* /*context*/, const ::orion::ObjectReport* /*request*/, ::orion::Empty* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    void RequestReportObjectCreated(::grpc::ServerContext* context, ::orion::ObjectReport* request, ::grpc::ServerAsyncResponseWriter< ::orion::Empty>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(2, context, request, response, new_call_cq, notification_cq, tag);
-    }
-  };
-  template <class BaseClass>
-  class WithAsyncMethod_GetObjectLocation : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithAsyncMethod_GetObjectLocation() {
-      ::grpc::Service::MarkMethodAsync(3);
-    }
-    ~WithAsyncMethod_GetObjectLocation() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status GetObjectLocation(::grpc::ServerContext* /*context*/, const ::orion::ObjectLocationRequest* /*request*/, ::orion::ObjectLocationReply* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    void RequestGetObjectLocation(::grpc::ServerContext* context, ::orion::ObjectLocationRequest* request, ::grpc::ServerAsyncResponseWriter< ::orion::ObjectLocationReply>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(3, context, request, response, new_call_cq, notification_cq, tag);
-    }
-  };
-  typedef WithAsyncMethod_RegisterNode<WithAsyncMethod_SubmitTask<WithAsyncMethod_ReportObjectCreated<WithAsyncMethod_GetObjectLocation<Service > > > > AsyncService;
-  template <class BaseClass>
-  class WithCallbackMethod_RegisterNode : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithCallbackMethod_RegisterNode() {
-      ::grpc::Service::MarkMethodCallback(0,
-          new ::grpc::internal::CallbackUnaryHandler< ::orion::RegisterNodeRequest, ::orion::RegisterNodeReply>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::orion::RegisterNodeRequest* request, ::orion::RegisterNodeReply* response) { return this->RegisterNode(context, request, response); }));}
-    void SetMessageAllocatorFor_RegisterNode(
-        ::grpc::MessageAllocator< ::orion::RegisterNodeRequest, ::orion::RegisterNodeReply>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(0);
-      static_cast<::grpc::internal::CallbackUnaryHandler< ::orion::RegisterNodeRequest, ::orion::RegisterNodeReply>*>(handler)
-              ->SetMessageAllocator(allocator);
-    }
-    ~WithCallbackMethod_RegisterNode() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status RegisterNode(::grpc::ServerContext* /*context*/, const ::orion::RegisterNodeRequest* /*request*/, ::orion::RegisterNodeReply* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    virtual ::grpc::ServerUnaryReactor* RegisterNode(
-      ::grpc::CallbackServerContext* /*context*/, const ::orion::RegisterNodeRequest* /*request*/, ::orion::RegisterNodeReply* /*response*/)  { return nullptr; }
-  };
-  template <class BaseClass>
-  class WithCallbackMethod_SubmitTask : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithCallbackMethod_SubmitTask() {
-      ::grpc::Service::MarkMethodCallback(1,
-          new ::grpc::internal::CallbackUnaryHandler< ::orion::TaskRequest, ::orion::TaskReply>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::orion::TaskRequest* request, ::orion::TaskReply* response) { return this->SubmitTask(context, request, response); }));}
-    void SetMessageAllocatorFor_SubmitTask(
-        ::grpc::MessageAllocator< ::orion::TaskRequest, ::orion::TaskReply>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(1);
-      static_cast<::grpc::internal::CallbackUnaryHandler< ::orion::TaskRequest, ::orion::TaskReply>*>(handler)
-              ->SetMessageAllocator(allocator);
-    }
-    ~WithCallbackMethod_SubmitTask() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status SubmitTask(::grpc::ServerContext* /*context*/, const ::orion::TaskRequest* /*request*/, ::orion::TaskReply* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    virtual ::grpc::ServerUnaryReactor* SubmitTask(
-      ::grpc::CallbackServerContext* /*context*/, const ::orion::TaskRequest* /*request*/, ::orion::TaskReply* /*response*/)  { return nullptr; }
-  };
-  template <class BaseClass>
-  class WithCallbackMethod_ReportObjectCreated : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithCallbackMethod_ReportObjectCreated() {
-      ::grpc::Service::MarkMethodCallback(2,
-          new ::grpc::internal::CallbackUnaryHandler< ::orion::ObjectReport, ::orion::Empty>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::orion::ObjectReport* request, ::orion::Empty* response) { return this->ReportObjectCreated(context, request, response); }));}
-    void SetMessageAllocatorFor_ReportObjectCreated(
-        ::grpc::MessageAllocator< ::orion::ObjectReport, ::orion::Empty>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(2);
-      static_cast<::grpc::internal::CallbackUnaryHandler< ::orion::ObjectReport, ::orion::Empty>*>(handler)
-              ->SetMessageAllocator(allocator);
-    }
-    ~WithCallbackMethod_ReportObjectCreated() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status ReportObjectCreated(::grpc::ServerContext* /*context*/, const ::orion::ObjectReport* /*request*/, ::orion::Empty* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    virtual ::grpc::ServerUnaryReactor* ReportObjectCreated(
-      ::grpc::CallbackServerContext* /*context*/, const ::orion::ObjectReport* /*request*/, ::orion::Empty* /*response*/)  { return nullptr; }
-  };
-  template <class BaseClass>
-  class WithCallbackMethod_GetObjectLocation : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithCallbackMethod_GetObjectLocation() {
-      ::grpc::Service::MarkMethodCallback(3,
-          new ::grpc::internal::CallbackUnaryHandler< ::orion::ObjectLocationRequest, ::orion::ObjectLocationReply>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::orion::ObjectLocationRequest* request, ::orion::ObjectLocationReply* response) { return this->GetObjectLocation(context, request, response); }));}
-    void SetMessageAllocatorFor_GetObjectLocation(
-        ::grpc::MessageAllocator< ::orion::ObjectLocationRequest, ::orion::ObjectLocationReply>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(3);
-      static_cast<::grpc::internal::CallbackUnaryHandler< ::orion::ObjectLocationRequest, ::orion::ObjectLocationReply>*>(handler)
-              ->SetMessageAllocator(allocator);
-    }
-    ~WithCallbackMethod_GetObjectLocation() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status GetObjectLocation(::grpc::ServerContext* /*context*/, const ::orion::ObjectLocationRequest* /*request*/, ::orion::ObjectLocationReply* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    virtual ::grpc::ServerUnaryReactor* GetObjectLocation(
-      ::grpc::CallbackServerContext* /*context*/, const ::orion::ObjectLocationRequest* /*request*/, ::orion::ObjectLocationReply* /*response*/)  { return nullptr; }
-  };
-  typedef WithCallbackMethod_RegisterNode<WithCallbackMethod_SubmitTask<WithCallbackMethod_ReportObjectCreated<WithCallbackMethod_GetObjectLocation<Service > > > > CallbackService;
-  typedef CallbackService ExperimentalCallbackService;
-  template <class BaseClass>
-  class WithGenericMethod_RegisterNode : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithGenericMethod_RegisterNode() {
-      ::grpc::Service::MarkMethodGeneric(0);
-    }
-    ~WithGenericMethod_RegisterNode() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status RegisterNode(::grpc::ServerContext* /*context*/, const ::orion::RegisterNodeRequest* /*request*/, ::orion::RegisterNodeReply* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-  };
-  template <class BaseClass>
-  class WithGenericMethod_SubmitTask : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithGenericMethod_SubmitTask() {
-      ::grpc::Service::MarkMethodGeneric(1);
-    }
-    ~WithGenericMethod_SubmitTask() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status SubmitTask(::grpc::ServerContext* /*context*/, const ::orion::TaskRequest* /*request*/, ::orion::TaskReply* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-  };
-  template <class BaseClass>
-  class WithGenericMethod_ReportObjectCreated : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithGenericMethod_ReportObjectCreated() {
-      ::grpc::Service::MarkMethodGeneric(2);
-    }
-    ~WithGenericMethod_ReportObjectCreated() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status ReportObjectCreated(::grpc::ServerContext* /*context*/, const ::orion::ObjectReport* /*request*/, ::orion::Empty* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-  };
-  template <class BaseClass>
-  class WithGenericMethod_GetObjectLocation : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithGenericMethod_GetObjectLocation() {
-      ::grpc::Service::MarkMethodGeneric(3);
-    }
-    ~WithGenericMethod_GetObjectLocation() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status GetObjectLocation(::grpc::ServerContext* /*context*/, const ::orion::ObjectLocationRequest* /*request*/, ::orion::ObjectLocationReply* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-  };
-  template <class BaseClass>
-  class WithRawMethod_RegisterNode : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithRawMethod_RegisterNode() {
-      ::grpc::Service::MarkMethodRaw(0);
-    }
-    ~WithRawMethod_RegisterNode() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status RegisterNode(::grpc::ServerContext* /*context*/, const ::orion::RegisterNodeRequest* /*request*/, ::orion::RegisterNodeReply* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    void RequestRegisterNode(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(0, context, request, response, new_call_cq, notification_cq, tag);
-    }
-  };
-  template <class BaseClass>
-  class WithRawMethod_SubmitTask : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithRawMethod_SubmitTask() {
-      ::grpc::Service::MarkMethodRaw(1);
-    }
-    ~WithRawMethod_SubmitTask() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status SubmitTask(::grpc::ServerContext* /*context*/, const ::orion::TaskRequest* /*request*/, ::orion::TaskReply* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    void RequestSubmitTask(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(1, context, request, response, new_call_cq, notification_cq, tag);
-    }
-  };
-  template <class BaseClass>
-  class WithRawMethod_ReportObjectCreated : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithRawMethod_ReportObjectCreated() {
-      ::grpc::Service::MarkMethodRaw(2);
-    }
-    ~WithRawMethod_ReportObjectCreated() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status ReportObjectCreated(::grpc::ServerContext* /*context*/, const ::orion::ObjectReport* /*request*/, ::orion::Empty* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    void RequestReportObjectCreated(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(2, context, request, response, new_call_cq, notification_cq, tag);
-    }
-  };
-  template <class BaseClass>
-  class WithRawMethod_GetObjectLocation : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithRawMethod_GetObjectLocation() {
-      ::grpc::Service::MarkMethodRaw(3);
-    }
-    ~WithRawMethod_GetObjectLocation() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status GetObjectLocation(::grpc::ServerContext* /*context*/, const ::orion::ObjectLocationRequest* /*request*/, ::orion::ObjectLocationReply* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    void RequestGetObjectLocation(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(3, context, request, response, new_call_cq, notification_cq, tag);
-    }
-  };
-  template <class BaseClass>
-  class WithRawCallbackMethod_RegisterNode : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithRawCallbackMethod_RegisterNode() {
-      ::grpc::Service::MarkMethodRawCallback(0,
-          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->RegisterNode(context, request, response); }));
-    }
-    ~WithRawCallbackMethod_RegisterNode() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status RegisterNode(::grpc::ServerContext* /*context*/, const ::orion::RegisterNodeRequest* /*request*/, ::orion::RegisterNodeReply* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    virtual ::grpc::ServerUnaryReactor* RegisterNode(
-      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
-  };
-  template <class BaseClass>
-  class WithRawCallbackMethod_SubmitTask : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithRawCallbackMethod_SubmitTask() {
-      ::grpc::Service::MarkMethodRawCallback(1,
-          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->SubmitTask(context, request, response); }));
-    }
-    ~WithRawCallbackMethod_SubmitTask() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status SubmitTask(::grpc::ServerContext* /*context*/, const ::orion::TaskRequest* /*request*/, ::orion::TaskReply* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    virtual ::grpc::ServerUnaryReactor* SubmitTask(
-      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
-  };
-  template <class BaseClass>
-  class WithRawCallbackMethod_ReportObjectCreated : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithRawCallbackMethod_ReportObjectCreated() {
-      ::grpc::Service::MarkMethodRawCallback(2,
-          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->ReportObjectCreated(context, request, response); }));
-    }
-    ~WithRawCallbackMethod_ReportObjectCreated() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status ReportObjectCreated(::grpc::ServerContext* /*context*/, const ::orion::ObjectReport* /*request*/, ::orion::Empty* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    virtual ::grpc::ServerUnaryReactor* ReportObjectCreated(
-      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
-  };
-  template <class BaseClass>
-  class WithRawCallbackMethod_GetObjectLocation : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithRawCallbackMethod_GetObjectLocation() {
-      ::grpc::Service::MarkMethodRawCallback(3,
-          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->GetObjectLocation(context, request, response); }));
-    }
-    ~WithRawCallbackMethod_GetObjectLocation() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status GetObjectLocation(::grpc::ServerContext* /*context*/, const ::orion::ObjectLocationRequest* /*request*/, ::orion::ObjectLocationReply* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    virtual ::grpc::ServerUnaryReactor* GetObjectLocation(
-      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
-  };
-  template <class BaseClass>
-  class WithStreamedUnaryMethod_RegisterNode : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithStreamedUnaryMethod_RegisterNode() {
-      ::grpc::Service::MarkMethodStreamed(0,
-        new ::grpc::internal::StreamedUnaryHandler<
-          ::orion::RegisterNodeRequest, ::orion::RegisterNodeReply>(
-            [this](::grpc::ServerContext* context,
-                   ::grpc::ServerUnaryStreamer<
-                     ::orion::RegisterNodeRequest, ::orion::RegisterNodeReply>* streamer) {
-                       return this->StreamedRegisterNode(context,
-                         streamer);
-                  }));
-    }
-    ~WithStreamedUnaryMethod_RegisterNode() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable regular version of this method
-    ::grpc::Status RegisterNode(::grpc::ServerContext* /*context*/, const ::orion::RegisterNodeRequest* /*request*/, ::orion::RegisterNodeReply* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    // replace default version of method with streamed unary
-    virtual ::grpc::Status StreamedRegisterNode(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::orion::RegisterNodeRequest,::orion::RegisterNodeReply>* server_unary_streamer) = 0;
-  };
-  template <class BaseClass>
-  class WithStreamedUnaryMethod_SubmitTask : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithStreamedUnaryMethod_SubmitTask() {
-      ::grpc::Service::MarkMethodStreamed(1,
-        new ::grpc::internal::StreamedUnaryHandler<
-          ::orion::TaskRequest, ::orion::TaskReply>(
-            [this](::grpc::ServerContext* context,
-                   ::grpc::ServerUnaryStreamer<
-                     ::orion::TaskRequest, ::orion::TaskReply>* streamer) {
-                       return this->StreamedSubmitTask(context,
-                         streamer);
-                  }));
-    }
-    ~WithStreamedUnaryMethod_SubmitTask() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable regular version of this method
-    ::grpc::Status SubmitTask(::grpc::ServerContext* /*context*/, const ::orion::TaskRequest* /*request*/, ::orion::TaskReply* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    // replace default version of method with streamed unary
-    virtual ::grpc::Status StreamedSubmitTask(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::orion::TaskRequest,::orion::TaskReply>* server_unary_streamer) = 0;
-  };
-  template <class BaseClass>
-  class WithStreamedUnaryMethod_ReportObjectCreated : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithStreamedUnaryMethod_ReportObjectCreated() {
-      ::grpc::Service::MarkMethodStreamed(2,
-        new ::grpc::internal::StreamedUnaryHandler<
-          ::orion::ObjectReport, ::orion::Empty>(
-            [this](::grpc::ServerContext* context,
-                   ::grpc::ServerUnaryStreamer<
-                     ::orion::ObjectReport, ::orion::Empty>* streamer) {
-                       return this->StreamedReportObjectCreated(context,
-                         streamer);
-                  }));
-    }
-    ~WithStreamedUnaryMethod_ReportObjectCreated() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable regular version of this method
-    ::grpc::Status ReportObjectCreated(::grpc::ServerContext* /*context*/, const ::orion::ObjectReport* /*request*/, ::orion::Empty* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    // replace default version of method with streamed unary
-    virtual ::grpc::Status StreamedReportObjectCreated(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::orion::ObjectReport,::orion::Empty>* server_unary_streamer) = 0;
-  };
-  template <class BaseClass>
-  class WithStreamedUnaryMethod_GetObjectLocation : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithStreamedUnaryMethod_GetObjectLocation() {
-      ::grpc::Service::MarkMethodStreamed(3,
-        new ::grpc::internal::StreamedUnaryHandler<
-          ::orion::ObjectLocationRequest, ::orion::ObjectLocationReply>(
-            [this](::grpc::ServerContext* context,
-                   ::grpc::ServerUnaryStreamer<
-                     ::orion::ObjectLocationRequest, ::orion::ObjectLocationReply>* streamer) {
-                       return this->StreamedGetObjectLocation(context,
-                         streamer);
-                  }));
-    }
-    ~WithStreamedUnaryMethod_GetObjectLocation() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable regular version of this method
-    ::grpc::Status GetObjectLocation(::grpc::ServerContext* /*context*/, const ::orion::ObjectLocationRequest* /*request*/, ::orion::ObjectLocationReply* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    // replace default version of method with streamed unary
-    virtual ::grpc::Status StreamedGetObjectLocation(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::orion::ObjectLocationRequest,::orion::ObjectLocationReply>* server_unary_streamer) = 0;
-  };
-  typedef WithStreamedUnaryMethod_RegisterNode<WithStreamedUnaryMethod_SubmitTask<WithStreamedUnaryMethod_ReportObjectCreated<WithStreamedUnaryMethod_GetObjectLocation<Service > > > > StreamedUnaryService;
-  typedef Service SplitStreamedService;
-  typedef WithStreamedUnaryMethod_RegisterNode<WithStreamedUnaryMethod_SubmitTask<WithStreamedUnaryMethod_ReportObjectCreated<WithStreamedUnaryMethod_GetObjectLocation<Service > > > > StreamedService;
-};
-
-class NodeService final {
- public:
-  static constexpr char const* service_full_name() {
-    return "orion.NodeService";
-  }
-  class StubInterface {
-   public:
-    virtual ~StubInterface() {}
-    virtual ::grpc::Status ExecuteTask(::grpc::ClientContext* context, const ::orion::TaskRequest& request, ::orion::TaskReply* response) = 0;
-    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::orion::TaskReply>> AsyncExecuteTask(::grpc::ClientContext* context, const ::orion::TaskRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::orion::TaskReply>>(AsyncExecuteTaskRaw(context, request, cq));
-    }
-    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::orion::TaskReply>> PrepareAsyncExecuteTask(::grpc::ClientContext* context, const ::orion::TaskRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::orion::TaskReply>>(PrepareAsyncExecuteTaskRaw(context, request, cq));
-    }
-    virtual ::grpc::Status GetObject(::grpc::ClientContext* context, const ::orion::ObjectLocationRequest& request, ::orion::ObjectData* response) = 0;
-    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::orion::ObjectData>> AsyncGetObject(::grpc::ClientContext* context, const ::orion::ObjectLocationRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::orion::ObjectData>>(AsyncGetObjectRaw(context, request, cq));
-    }
-    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::orion::ObjectData>> PrepareAsyncGetObject(::grpc::ClientContext* context, const ::orion::ObjectLocationRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::orion::ObjectData>>(PrepareAsyncGetObjectRaw(context, request, cq));
-    }
-    class async_interface {
-     public:
-      virtual ~async_interface() {}
-      virtual void ExecuteTask(::grpc::ClientContext* context, const ::orion::TaskRequest* request, ::orion::TaskReply* response, std::function<void(::grpc::Status)>) = 0;
-      virtual void ExecuteTask(::grpc::ClientContext* context, const ::orion::TaskRequest* request, ::orion::TaskReply* response, ::grpc::ClientUnaryReactor* reactor) = 0;
-      virtual void GetObject(::grpc::ClientContext* context, const ::orion::ObjectLocationRequest* request, ::orion::ObjectData* response, std::function<void(::grpc::Status)>) = 0;
-      virtual void GetObject(::grpc::ClientContext* context, const ::orion::ObjectLocationRequest* request, ::orion::ObjectData* response, ::grpc::ClientUnaryReactor* reactor) = 0;
-    };
-    typedef class async_interface experimental_async_interface;
-    virtual class async_interface* async() { return nullptr; }
-    class async_interface* experimental_async() { return async(); }
-   private:
-    virtual ::grpc::ClientAsyncResponseReaderInterface< ::orion::TaskReply>* AsyncExecuteTaskRaw(::grpc::ClientContext* context, const ::orion::TaskRequest& request, ::grpc::CompletionQueue* cq) = 0;
-    virtual ::grpc::ClientAsyncResponseReaderInterface< ::orion::TaskReply>* PrepareAsyncExecuteTaskRaw(::grpc::ClientContext* context, const ::orion::TaskRequest& request, ::grpc::CompletionQueue* cq) = 0;
-    virtual ::grpc::ClientAsyncResponseReaderInterface< ::orion::ObjectData>* AsyncGetObjectRaw(::grpc::ClientContext* context, const ::orion::ObjectLocationRequest& request, ::grpc::CompletionQueue* cq) = 0;
-    virtual ::grpc::ClientAsyncResponseReaderInterface< ::orion::ObjectData>* PrepareAsyncGetObjectRaw(::grpc::ClientContext* context, const ::orion::ObjectLocationRequest& request, ::grpc::CompletionQueue* cq) = 0;
-  };
-  class Stub final : public StubInterface {
-   public:
-    Stub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options = ::grpc::StubOptions());
-    ::grpc::Status ExecuteTask(::grpc::ClientContext* context, const ::orion::TaskRequest& request, ::orion::TaskReply* response) override;
-    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::orion::TaskReply>> AsyncExecuteTask(::grpc::ClientContext* context, const ::orion::TaskRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::orion::TaskReply>>(AsyncExecuteTaskRaw(context, request, cq));
-    }
-    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::orion::TaskReply>> PrepareAsyncExecuteTask(::grpc::ClientContext* context, const ::orion::TaskRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::orion::TaskReply>>(PrepareAsyncExecuteTaskRaw(context, request, cq));
-    }
-    ::grpc::Status GetObject(::grpc::ClientContext* context, const ::orion::ObjectLocationRequest& request, ::orion::ObjectData* response) override;
-    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::orion::ObjectData>> AsyncGetObject(::grpc::ClientContext* context, const ::orion::ObjectLocationRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::orion::ObjectData>>(AsyncGetObjectRaw(context, request, cq));
-    }
-    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::orion::ObjectData>> PrepareAsyncGetObject(::grpc::ClientContext* context, const ::orion::ObjectLocationRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::orion::ObjectData>>(PrepareAsyncGetObjectRaw(context, request, cq));
-    }
-    class async final :
-      public StubInterface::async_interface {
-     public:
-      void ExecuteTask(::grpc::ClientContext* context, const ::orion::TaskRequest* request, ::orion::TaskReply* response, std::function<void(::grpc::Status)>) override;
-      void ExecuteTask(::grpc::ClientContext* context, const ::orion::TaskRequest* request, ::orion::TaskReply* response, ::grpc::ClientUnaryReactor* reactor) override;
-      void GetObject(::grpc::ClientContext* context, const ::orion::ObjectLocationRequest* request, ::orion::ObjectData* response, std::function<void(::grpc::Status)>) override;
-      void GetObject(::grpc::ClientContext* context, const ::orion::ObjectLocationRequest* request, ::orion::ObjectData* response, ::grpc::ClientUnaryReactor* reactor) override;
-     private:
-      friend class Stub;
-      explicit async(Stub* stub): stub_(stub) { }
-      Stub* stub() { return stub_; }
-      Stub* stub_;
-    };
-    class async* async() override { return &async_stub_; }
-
-   private:
-    std::shared_ptr< ::grpc::ChannelInterface> channel_;
-    class async async_stub_{this};
-    ::grpc::ClientAsyncResponseReader< ::orion::TaskReply>* AsyncExecuteTaskRaw(::grpc::ClientContext* context, const ::orion::TaskRequest& request, ::grpc::CompletionQueue* cq) override;
-    ::grpc::ClientAsyncResponseReader< ::orion::TaskReply>* PrepareAsyncExecuteTaskRaw(::grpc::ClientContext* context, const ::orion::TaskRequest& request, ::grpc::CompletionQueue* cq) override;
-    ::grpc::ClientAsyncResponseReader< ::orion::ObjectData>* AsyncGetObjectRaw(::grpc::ClientContext* context, const ::orion::ObjectLocationRequest& request, ::grpc::CompletionQueue* cq) override;
-    ::grpc::ClientAsyncResponseReader< ::orion::ObjectData>* PrepareAsyncGetObjectRaw(::grpc::ClientContext* context, const ::orion::ObjectLocationRequest& request, ::grpc::CompletionQueue* cq) override;
-    const ::grpc::internal::RpcMethod rpcmethod_ExecuteTask_;
-    const ::grpc::internal::RpcMethod rpcmethod_GetObject_;
-  };
-  static std::unique_ptr<Stub> NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options = ::grpc::StubOptions());
-
-  class Service : public ::grpc::Service {
-   public:
-    Service();
-    virtual ~Service();
-    virtual ::grpc::Status ExecuteTask(::grpc::ServerContext* context, const ::orion::TaskRequest* request, ::orion::TaskReply* response);
-    virtual ::grpc::Status GetObject(::grpc::ServerContext* context, const ::orion::ObjectLocationRequest* request, ::orion::ObjectData* response);
-  };
-  template <class BaseClass>
-  class WithAsyncMethod_ExecuteTask : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithAsyncMethod_ExecuteTask() {
-      ::grpc::Service::MarkMethodAsync(0);
-    }
-    ~WithAsyncMethod_ExecuteTask() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status ExecuteTask(::grpc::ServerContext* /*context*/, const ::orion::TaskRequest* /*request*/, ::orion::TaskReply* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    void RequestExecuteTask(::grpc::ServerContext* context, ::orion::TaskRequest* request, ::grpc::ServerAsyncResponseWriter< ::orion::TaskReply>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(0, context, request, response, new_call_cq, notification_cq, tag);
-    }
-  };
-  template <class BaseClass>
-  class WithAsyncMethod_GetObject : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithAsyncMethod_GetObject() {
-      ::grpc::Service::MarkMethodAsync(1);
-    }
-    ~WithAsyncMethod_GetObject() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status GetObject(::grpc::ServerContext* /*context*/, const ::orion::ObjectLocationRequest* /*request*/, ::orion::ObjectData* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    void RequestGetObject(::grpc::ServerContext* context, ::orion::ObjectLocationRequest* request, ::grpc::ServerAsyncResponseWriter< ::orion::ObjectData>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(1, context, request, response, new_call_cq, notification_cq, tag);
-    }
-  };
-  typedef WithAsyncMethod_ExecuteTask<WithAsyncMethod_GetObject<Service > > AsyncService;
-  template <class BaseClass>
-  class WithCallbackMethod_ExecuteTask : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithCallbackMethod_ExecuteTask() {
-      ::grpc::Service::MarkMethodCallback(0,
-          new ::grpc::internal::CallbackUnaryHandler< ::orion::TaskRequest, ::orion::TaskReply>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::orion::TaskRequest* request, ::orion::TaskReply* response) { return this->ExecuteTask(context, request, response); }));}
-    void SetMessageAllocatorFor_ExecuteTask(
-        ::grpc::MessageAllocator< ::orion::TaskRequest, ::orion::TaskReply>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(0);
-      static_cast<::grpc::internal::CallbackUnaryHandler< ::orion::TaskRequest, ::orion::TaskReply>*>(handler)
-              ->SetMessageAllocator(allocator);
-    }
-    ~WithCallbackMethod_ExecuteTask() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status ExecuteTask(::grpc::ServerContext* /*context*/, const ::orion::TaskRequest* /*request*/, ::orion::TaskReply* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    virtual ::grpc::ServerUnaryReactor* ExecuteTask(
-      ::grpc::CallbackServerContext* /*context*/, const ::orion::TaskRequest* /*request*/, ::orion::TaskReply* /*response*/)  { return nullptr; }
-  };
-  template <class BaseClass>
-  class WithCallbackMethod_GetObject : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithCallbackMethod_GetObject() {
-      ::grpc::Service::MarkMethodCallback(1,
-          new ::grpc::internal::CallbackUnaryHandler< ::orion::ObjectLocationRequest, ::orion::ObjectData>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::orion::ObjectLocationRequest* request, ::orion::ObjectData* response) { return this->GetObject(context, request, response); }));}
-    void SetMessageAllocatorFor_GetObject(
-        ::grpc::MessageAllocator< ::orion::ObjectLocationRequest, ::orion::ObjectData>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(1);
-      static_cast<::grpc::internal::CallbackUnaryHandler< ::orion::ObjectLocationRequest, ::orion::ObjectData>*>(handler)
-              ->SetMessageAllocator(allocator);
-    }
-    ~WithCallbackMethod_GetObject() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status GetObject(::grpc::ServerContext* /*context*/, const ::orion::ObjectLocationRequest* /*request*/, ::orion::ObjectData* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    virtual ::grpc::ServerUnaryReactor* GetObject(
-      ::grpc::CallbackServerContext* /*context*/, const ::orion::ObjectLocationRequest* /*request*/, ::orion::ObjectData* /*response*/)  { return nullptr; }
-  };
-  typedef WithCallbackMethod_ExecuteTask<WithCallbackMethod_GetObject<Service > > CallbackService;
-  typedef CallbackService ExperimentalCallbackService;
-  template <class BaseClass>
-  class WithGenericMethod_ExecuteTask : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithGenericMethod_ExecuteTask() {
-      ::grpc::Service::MarkMethodGeneric(0);
-    }
-    ~WithGenericMethod_ExecuteTask() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status ExecuteTask(::grpc::ServerContext* /*context*/, const ::orion::TaskRequest* /*request*/, ::orion::TaskReply* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-  };
-  template <class BaseClass>
-  class WithGenericMethod_GetObject : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithGenericMethod_GetObject() {
-      ::grpc::Service::MarkMethodGeneric(1);
-    }
-    ~WithGenericMethod_GetObject() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status GetObject(::grpc::ServerContext* /*context*/, const ::orion::ObjectLocationRequest* /*request*/, ::orion::ObjectData* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-  };
-  template <class BaseClass>
-  class WithRawMethod_ExecuteTask : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithRawMethod_ExecuteTask() {
-      ::grpc::Service::MarkMethodRaw(0);
-    }
-    ~WithRawMethod_ExecuteTask() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status ExecuteTask(::grpc::ServerContext* /*context*/, const ::orion::TaskRequest* /*request*/, ::orion::TaskReply* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    void RequestExecuteTask(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(0, context, request, response, new_call_cq, notification_cq, tag);
-    }
-  };
-  template <class BaseClass>
-  class WithRawMethod_GetObject : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithRawMethod_GetObject() {
-      ::grpc::Service::MarkMethodRaw(1);
-    }
-    ~WithRawMethod_GetObject() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status GetObject(::grpc::ServerContext* /*context*/, const ::orion::ObjectLocationRequest* /*request*/, ::orion::ObjectData* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    void RequestGetObject(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(1, context, request, response, new_call_cq, notification_cq, tag);
-    }
-  };
-  template <class BaseClass>
-  class WithRawCallbackMethod_ExecuteTask : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithRawCallbackMethod_ExecuteTask() {
-      ::grpc::Service::MarkMethodRawCallback(0,
-          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->ExecuteTask(context, request, response); }));
-    }
-    ~WithRawCallbackMethod_ExecuteTask() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status ExecuteTask(::grpc::ServerContext* /*context*/, const ::orion::TaskRequest* /*request*/, ::orion::TaskReply* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    virtual ::grpc::ServerUnaryReactor* ExecuteTask(
-      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
-  };
-  template <class BaseClass>
-  class WithRawCallbackMethod_GetObject : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithRawCallbackMethod_GetObject() {
-      ::grpc::Service::MarkMethodRawCallback(1,
-          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->GetObject(context, request, response); }));
-    }
-    ~WithRawCallbackMethod_GetObject() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status GetObject(::grpc::ServerContext* /*context*/, const ::orion::ObjectLocationRequest* /*request*/, ::orion::ObjectData* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    virtual ::grpc::ServerUnaryReactor* GetObject(
-      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
-  };
-  template <class BaseClass>
-  class WithStreamedUnaryMethod_ExecuteTask : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithStreamedUnaryMethod_ExecuteTask() {
-      ::grpc::Service::MarkMethodStreamed(0,
-        new ::grpc::internal::StreamedUnaryHandler<
-          ::orion::TaskRequest, ::orion::TaskReply>(
-            [this](::grpc::ServerContext* context,
-                   ::grpc::ServerUnaryStreamer<
-                     ::orion::TaskRequest, ::orion::TaskReply>* streamer) {
-                       return this->StreamedExecuteTask(context,
-                         streamer);
-                  }));
-    }
-    ~WithStreamedUnaryMethod_ExecuteTask() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable regular version of this method
-    ::grpc::Status ExecuteTask(::grpc::ServerContext* /*context*/, const ::orion::TaskRequest* /*request*/, ::orion::TaskReply* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    // replace default version of method with streamed unary
-    virtual ::grpc::Status StreamedExecuteTask(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::orion::TaskRequest,::orion::TaskReply>* server_unary_streamer) = 0;
-  };
-  template <class BaseClass>
-  class WithStreamedUnaryMethod_GetObject : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithStreamedUnaryMethod_GetObject() {
-      ::grpc::Service::MarkMethodStreamed(1,
-        new ::grpc::internal::StreamedUnaryHandler<
-          ::orion::ObjectLocationRequest, ::orion::ObjectData>(
-            [this](::grpc::ServerContext* context,
-                   ::grpc::ServerUnaryStreamer<
-                     ::orion::ObjectLocationRequest, ::orion::ObjectData>* streamer) {
-                       return this->StreamedGetObject(context,
-                         streamer);
-                  }));
-    }
-    ~WithStreamedUnaryMethod_GetObject() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable regular version of this method
-    ::grpc::Status GetObject(::grpc::ServerContext* /*context*/, const ::orion::ObjectLocationRequest* /*request*/, ::orion::ObjectData* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    // replace default version of method with streamed unary
-    virtual ::grpc::Status StreamedGetObject(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::orion::ObjectLocationRequest,::orion::ObjectData>* server_unary_streamer) = 0;
-  };
-  typedef WithStreamedUnaryMethod_ExecuteTask<WithStreamedUnaryMethod_GetObject<Service > > StreamedUnaryService;
-  typedef Service SplitStreamedService;
-  typedef WithStreamedUnaryMethod_ExecuteTask<WithStreamedUnaryMethod_GetObject<Service > > StreamedService;
-};
-
-}  // namespace orion
-
-
-#include <grpcpp/ports_undef.inc>
-#endif  // GRPC_orion_2eproto__INCLUDED
@@ -3,12 +3,29 @@
 //
 
 #include "node_runtime.h"
+#include "object_fetcher.h"
 
+#include <algorithm>
 #include <iostream>
+#include <chrono>
 #include <grpcpp/grpcpp.h>
 #include "distributed/generated/orion.grpc.pb.h"
 
 namespace orion::distributed {
+    // Freed ids are reported at most this often, or sooner once a batch fills
+    // (or along with created ids, which are sent immediately)
+    static constexpr auto   kFreeReportInterval = std::chrono::milliseconds(50);
+    static constexpr size_t kFreeReportBatch    = 256;
+
+    static void to_proto(const NodeLoad& load, size_t workers, orion::NodeLoad& out) {
+        out.set_workers(uint32_t(workers));
+        out.set_cpus(uint32_t(load.cpus));
+        out.set_queued(uint32_t(load.queued));
+        out.set_running(uint32_t(load.running));
+        out.set_memory_bytes(load.memory_bytes);
+        out.set_memory_budget(load.memory_budget);
+    }
+
     // Simple random ID generator (temporary)
     static std::string generate_node_id() {
         static int counter = 0;
@@ -38,6 +55,20 @@ namespace orion::distributed {
     }
 
 
+    NodeRuntime::~NodeRuntime() = default;
+
+    void NodeRuntime::set_spill_config(orion::SpillConfig config) {
+        spill_config_ = std::move(config);
+    }
+
+    void NodeRuntime::set_heartbeat_interval(std::chrono::milliseconds interval) {
+        heartbeat_interval_ = std::max(interval, std::chrono::milliseconds(1));
+    }
+
+    void NodeRuntime::set_transport(Transport transport) {
+        transport_ = transport;
+    }
+
     // Start local runtime
     void NodeRuntime::start() {
         if (running_) return;
@@ -46,12 +77,55 @@ namespace orion::distributed {
                   << node_id_
                   << " on port " << port_ << "\n";
 
-        runtime_ = std::make_unique<orion::Runtime>(num_workers_);
+        runtime_ = std::make_unique<orion::Runtime>(
+            num_workers_, orion::RuntimeOptions{.reference_counting = true,
+                                                .spill = spill_config_});
+
+        {
+            std::lock_guard<std::mutex> lock(report_mu_);
+            reporting_ = true;
+        }
+        runtime_->set_on_put_callback([this](const orion::ObjectId& id, size_t bytes) {
+            {
+                std::lock_guard<std::mutex> lock(report_mu_);
+                if (replicas_.count(id)) return;
+                created_.push_back(id);
+                created_sizes_.push_back(bytes);
+                if (created_.size() == 1) report_cv_.notify_one();
+            }
+            // A task finished: make room for a backlogged one
+            release_backlog();
+        });
+        runtime_->set_on_free_callback([this](const orion::ObjectId& id) {
+            std::lock_guard<std::mutex> lock(report_mu_);
+            if (replicas_.erase(id)) return;
+            freed_.push_back(id);
+            if (freed_.size() >= kFreeReportBatch) report_cv_.notify_one();
+        });
+        reporter_ = std::thread(&NodeRuntime::report_loop, this);
+
+        if (!cluster_address_.empty()) {
+            fetcher_ = std::make_unique<ObjectFetcher>(
+                runtime_->store(), cluster_address_, node_id_,
+                [this](orion::ObjectId id) {
+                    std::lock_guard<std::mutex> lock(report_mu_);
+                    replicas_.insert(id);
+                },
+                ObjectFetcher::kDefaultThreads, transport_);
+        }
 
         // 🔜 Later: start RPC server here
 
         register_with_cluster();   // 👈 NEW
 
+        if (!cluster_address_.empty()) {
+            {
+                std::lock_guard<std::mutex> lock(beat_mu_);
+                beating_ = true;
+            }
+            heartbeater_ = std::thread(&NodeRuntime::heartbeat_loop, this);
+        }
+
         running_ = true;
     }
 
@@ -61,11 +135,46 @@ namespace orion::distributed {
 
         std::cout << "[NodeRuntime] Shutting down node\n";
 
+        {
+            std::lock_guard<std::mutex> lock(beat_mu_);
+            beating_ = false;
+        }
+        beat_cv_.notify_one();
+        if (heartbeater_.joinable()) {
+            heartbeater_.join();
+        }
+
+        fetcher_.reset();
+
+        // Backlogged tasks never started; drop them before the workers go
+        std::deque<orion::Task> backlog;
+        {
+            std::lock_guard<std::mutex> lock(held_mu_);
+            backlog.swap(backlog_);
+            backlogged_.clear();
+        }
+        backlog.clear();
+
         if (runtime_) {
             runtime_->shutdown();
-            runtime_.reset();
         }
 
+        {
+            std::lock_guard<std::mutex> lock(report_mu_);
+            reporting_ = false;
+        }
+        report_cv_.notify_one();
+        if (reporter_.joinable()) {
+            reporter_.join();
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(held_mu_);
+            held_.clear();
+        }
+        runtime_.reset();
+        replicas_.clear();   // reporter is gone; nothing else touches it
+
         // Later:
         // stop RPC server here
 
@@ -76,9 +185,292 @@ namespace orion::distributed {
         return *runtime_;
     }
 
+    void NodeRuntime::admit(std::vector<orion::Task> tasks) {
+        std::vector<orion::ObjectId> dep_ids;
+        {
+            std::lock_guard<std::mutex> lock(held_mu_);
+            for (auto& task : tasks) {
+                // The task holds its deps from now on, as it would in the
+                // local runtime, so the head may free its own claim on them
+                for (auto& dep : task.deps) {
+                    if (!dep.owner) dep.owner = runtime_->store().make_owner(dep.id);
+                    dep_ids.push_back(dep.id);
+                }
+                backlogged_.insert(task.id);
+                backlog_.push_back(std::move(task));
+            }
+        }
+        fetch_missing(dep_ids);
+        release_backlog();
+    }
+
+    std::vector<orion::ObjectId> NodeRuntime::steal(const std::vector<orion::ObjectId>& task_ids) {
+        std::vector<orion::ObjectId> stolen;
+        std::vector<orion::Task> dropped;   // release their deps outside held_mu_
+        {
+            std::lock_guard<std::mutex> lock(held_mu_);
+            for (const auto& id : task_ids) {
+                if (backlogged_.erase(id)) stolen.push_back(id);
+            }
+            if (stolen.empty()) return stolen;
+            for (auto it = backlog_.begin(); it != backlog_.end();) {
+                if (backlogged_.count(it->id)) {
+                    ++it;
+                } else {
+                    dropped.push_back(std::move(*it));
+                    it = backlog_.erase(it);
+                }
+            }
+        }
+        return stolen;
+    }
+
+    void NodeRuntime::release_backlog() {
+        std::lock_guard<std::mutex> lock(held_mu_);
+        if (backlog_.empty() || !runtime_) return;
+
+        // Tasks waiting for inputs do not count: they hold no worker, and a
+        // chain forwarded here needs its later links submitted to finish
+        const orion::RuntimeLoad tasks = runtime_->load();
+        const size_t limit = num_workers_ * kAdmitPerWorker;
+        size_t busy = tasks.queued + tasks.running;
+        std::vector<orion::Task> batch;
+        while (!backlog_.empty() && busy < limit) {
+            backlogged_.erase(backlog_.front().id);
+            batch.push_back(std::move(backlog_.front()));
+            backlog_.pop_front();
+            ++busy;
+        }
+        // Under held_mu_, so fetch_missing() never sees an output that is
+        // neither backlogged nor held
+        if (!batch.empty()) hold_locked_(runtime_->submit_batch(std::move(batch)));
+    }
+
+    void NodeRuntime::hold_locked_(std::vector<orion::ObjectRef> refs) {
+        for (auto& ref : refs) {
+            orion::ObjectId id = ref.id;
+            held_[id] = std::move(ref);
+        }
+    }
+
+    void NodeRuntime::free_objects(const std::vector<orion::ObjectId>& object_ids) {
+        std::vector<orion::ObjectRef> dropped;   // released outside held_mu_
+        {
+            std::lock_guard<std::mutex> lock(held_mu_);
+            for (const auto& id : object_ids) {
+                auto it = held_.find(id);
+                if (it == held_.end()) continue;
+                dropped.push_back(std::move(it->second));
+                held_.erase(it);
+            }
+        }
+    }
+
+    void NodeRuntime::drop_head_state() {
+        std::vector<orion::ObjectRef> dropped;   // released outside held_mu_
+        std::deque<orion::Task> backlog;
+        {
+            std::lock_guard<std::mutex> lock(held_mu_);
+            for (auto& [id, ref] : held_) dropped.push_back(std::move(ref));
+            held_.clear();
+            backlog.swap(backlog_);
+            backlogged_.clear();
+        }
+        {
+            // Unsent created reports name objects that are going away
+            std::lock_guard<std::mutex> lock(report_mu_);
+            created_.clear();
+            created_sizes_.clear();
+        }
+        std::cout << "[NodeRuntime] Dropping " << dropped.size() << " held objects and "
+                  << backlog.size() << " backlogged tasks of the previous registration\n"
+                  << std::flush;
+    }
+
+    void NodeRuntime::fetch_missing(const std::vector<orion::ObjectId>& object_ids) {
+        if (!fetcher_) return;
+        // Held and backlogged ids are outputs of tasks accepted here: the
+        // local scheduler runs their consumers once they are stored
+        std::vector<orion::ObjectId> remote;
+        {
+            std::lock_guard<std::mutex> lock(held_mu_);
+            for (const auto& id : object_ids) {
+                if (!held_.count(id) && !backlogged_.count(id)) remote.push_back(id);
+            }
+        }
+        for (const auto& id : remote) {
+            fetcher_->request(id);
+        }
+    }
+
+    void NodeRuntime::set_create_listener(CreateListener listener) {
+        std::lock_guard<std::mutex> lock(report_mu_);
+        create_listener_ = std::move(listener);
+    }
+
+    void NodeRuntime::set_free_listener(FreeListener listener) {
+        std::lock_guard<std::mutex> lock(report_mu_);
+        free_listener_ = std::move(listener);
+    }
+
+    void NodeRuntime::report_loop() {
+        std::unique_ptr<orion::ClusterHead::Stub> stub;
+        if (!cluster_address_.empty()) {
+            stub = orion::ClusterHead::NewStub(
+                grpc::CreateChannel(cluster_address_, grpc::InsecureChannelCredentials()));
+        }
+
+        std::unique_lock<std::mutex> lock(report_mu_);
+        bool failed = false;   // the head did not take the last report
+        while (true) {
+            // Created ids hold up dependent tasks on the head: send them
+            // right away. Freed ids can wait for a full batch. After a failed
+            // report, the retry waits out the interval.
+            report_cv_.wait_for(lock, kFreeReportInterval, [&] {
+                return !reporting_ ||
+                       (!failed && (!created_.empty() || freed_.size() >= kFreeReportBatch));
+            });
+
+            std::vector<orion::ObjectId> created;
+            std::vector<uint64_t> sizes;
+            std::vector<orion::ObjectId> freed;
+            created.swap(created_);
+            sizes.swap(created_sizes_);
+            freed.swap(freed_);
+            const bool last = !reporting_;
+            CreateListener create_listener = create_listener_;
+            FreeListener free_listener = free_listener_;
+            lock.unlock();
+
+            // Created before freed: the head drops a location only after it
+            // has recorded it
+            bool created_sent = true;
+            bool freed_sent = true;
+            if (!created.empty()) {
+                if (create_listener) {
+                    create_listener(created, sizes);
+                } else if (stub) {
+                    orion::ObjectCreatedReport req;
+                    req.set_node_id(node_id_);
+                    req.mutable_object_ids()->Reserve(int(created.size()));
+                    for (const auto& id : created) {
+                        req.add_object_ids(id.value());
+                    }
+                    req.mutable_sizes()->Add(sizes.begin(), sizes.end());
+                    orion::Empty reply;
+                    grpc::ClientContext ctx;
+                    grpc::Status status = stub->ReportObjectsCreated(&ctx, req, &reply);
+                    if (!status.ok()) {
+                        std::cerr << "[NodeRuntime] ReportObjectsCreated FAILED: "
+                                  << status.error_message() << "\n" << std::flush;
+                        created_sent = false;
+                    }
+                }
+            }
+
+            if (!freed.empty()) {
+                if (!created_sent) {
+                    // Held back with them, to keep the order
+                    freed_sent = false;
+                } else if (free_listener) {
+                    free_listener(freed);
+                } else if (stub) {
+                    orion::ObjectFreeReport req;
+                    req.set_node_id(node_id_);
+                    req.mutable_ids()->Reserve(int(freed.size()));
+                    for (const auto& id : freed) {
+                        req.add_ids(id.value());
+                    }
+                    orion::Empty reply;
+                    grpc::ClientContext ctx;
+                    grpc::Status status = stub->ReportObjectsFreed(&ctx, req, &reply);
+                    if (!status.ok()) {
+                        std::cerr << "[NodeRuntime] ReportObjectsFreed FAILED: "
+                                  << status.error_message() << "\n" << std::flush;
+                        freed_sent = false;
+                    }
+                }
+            }
+
+            // Puts release the backlog as tasks finish, but the finishing
+            // task still counts as running then; this catches what they left
+            if (!last) release_backlog();
+
+            lock.lock();
+            // Unsent ids go out first in the next report. On the way out
+            // there is no next one: they are dropped.
+            failed = !created_sent || !freed_sent;
+            if (!last && !created_sent) {
+                created.insert(created.end(), created_.begin(), created_.end());
+                sizes.insert(sizes.end(), created_sizes_.begin(), created_sizes_.end());
+                created_.swap(created);
+                created_sizes_.swap(sizes);
+            }
+            if (!last && !freed_sent) {
+                freed.insert(freed.end(), freed_.begin(), freed_.end());
+                freed_.swap(freed);
+            }
+            if (last && created_.empty() && freed_.empty()) return;
+        }
+    }
+
+    NodeLoad NodeRuntime::load() {
+        NodeLoad load;
+        load.cpus = int(std::thread::hardware_concurrency());
+        load.memory_budget = spill_config_.memory_budget;
+        if (runtime_) {
+            const orion::RuntimeLoad tasks = runtime_->load();
+            std::lock_guard<std::mutex> lock(held_mu_);
+            load.queued = tasks.waiting + tasks.queued + backlog_.size();
+            load.running = tasks.running;
+            load.memory_bytes = runtime_->spill_stats().memory_bytes;
+        }
+        return load;
+    }
+
+    void NodeRuntime::heartbeat_loop() {
+        auto stub = orion::ClusterHead::NewStub(
+            grpc::CreateChannel(cluster_address_, grpc::InsecureChannelCredentials()));
+        bool reachable = true;   // log only when this changes
+
+        std::unique_lock<std::mutex> lock(beat_mu_);
+        while (!beat_cv_.wait_for(lock, heartbeat_interval_, [&] { return !beating_; })) {
+            lock.unlock();
+
+            orion::HeartbeatRequest req;
+            req.set_node_id(node_id_);
+            to_proto(load(), num_workers_, *req.mutable_load());
+            orion::HeartbeatReply reply;
+            grpc::ClientContext ctx;
+            ctx.set_deadline(std::chrono::system_clock::now() + 10 * heartbeat_interval_);
+            grpc::Status status = stub->Heartbeat(&ctx, req, &reply);
+
+            if (!status.ok()) {
+                if (reachable) {
+                    std::cerr << "[NodeRuntime] Heartbeat FAILED: "
+                              << status.error_message() << "\n" << std::flush;
+                }
+                reachable = false;
+            } else {
+                if (!reachable) {
+                    std::cout << "[NodeRuntime] Heartbeat OK again\n" << std::flush;
+                }
+                reachable = true;
+                if (!reply.known()) {
+                    std::cout << "[NodeRuntime] Head does not know " << node_id_
+                              << "; registering again\n" << std::flush;
+                    drop_head_state();
+                    register_with_cluster();
+                }
+            }
+
+            lock.lock();
+        }
+    }
+
     // Real gRPC registration with the head server.
     // If cluster_address is empty (in-process mode), skip.
-    void NodeRuntime::register_with_cluster() const {
+    void NodeRuntime::register_with_cluster() {
         std::cout << "[NodeRuntime] Registering "
                   << node_id_
                   << " with cluster at "
@@ -97,6 +489,7 @@ namespace orion::distributed {
         orion::RegisterNodeRequest req;
         req.set_node_id(node_id_);
         req.set_address(address_);
+        to_proto(load(), num_workers_, *req.mutable_load());
 
         orion::RegisterNodeReply reply;
         grpc::ClientContext ctx;
@@ -9,16 +9,66 @@
 #pragma once
 
 #include <cstddef>
+#include <deque>
 #include <memory>
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <unordered_set>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <functional>
+#include <chrono>
 
 #include "../local/runtime.h"
+#include "cluster/node_registry.h"
+#include "rpc/node_client.h"
 
 namespace orion::distributed {
 
+    class ObjectFetcher;
+
     // Represents a single Orion node (one machine)
     // Owns a local runtime and will later host RPC services
+    //
+    // The local runtime reference-counts its objects. Outputs of tasks the
+    // head dispatched here are held on the head's behalf until the head sends
+    // FreeObjects; freed ids are batched and reported back to the head.
+    //
+    // Every object stored locally is also reported to the head, which only
+    // then treats it as existing here. Created ids are sent as soon as the
+    // reporter is free, so ids that finish while a report is in flight go
+    // out together in the next one. A report the head does not take is
+    // kept and sent again, ahead of newer ids, on the next pass.
+    //
+    // With a head to ask, inputs produced on other nodes are fetched from
+    // their owner (ObjectFetcher). Those copies are not reported: the head
+    // keeps pointing at the owner, and the copy is freed here once the local
+    // tasks reading it have run.
+    //
+    // The head may send a task before its inputs exist, when they are
+    // outputs of tasks it sent here too. Such a task waits in the local
+    // scheduler, not on the head, so a chain runs here at local speed.
+    //
+    // Accepted tasks enter the local runtime only while it has fewer than
+    // kAdmitPerWorker ready or running tasks per worker; the rest wait in a
+    // backlog, in arrival order. Backlogged tasks have not started, so the
+    // head may take them back (steal()) and give them to an idle node.
+    //
+    // A registered node sends its load (load()) to the head every
+    // kHeartbeatInterval by default. The head declares a node that falls
+    // silent dead; if it was only slow, it registers again when the head
+    // answers that it does not know it.
     class NodeRuntime {
     public:
+        static constexpr auto kHeartbeatInterval = std::chrono::milliseconds(100);
+        static constexpr size_t kAdmitPerWorker = 2;
+
+        using CreateListener = std::function<void(const std::vector<orion::ObjectId>&,
+                                                  const std::vector<uint64_t>& sizes)>;
+        using FreeListener   = std::function<void(const std::vector<orion::ObjectId>&)>;
+
         // num_workers = worker threads on this node
         // port = RPC port (used later)
         NodeRuntime(size_t num_workers,
@@ -26,7 +76,20 @@ namespace orion::distributed {
                           std::string cluster_address = "",
                           std::string node_id = "",
                           std::string address = "");
+        ~NodeRuntime();
+
+
+        // Memory budget / spill directory for the node's object store.
+        // Takes effect on the next start().
+        void set_spill_config(orion::SpillConfig config);
+
+        // How often load goes to the head; keep it well under the head's
+        // node timeout. Takes effect on the next start().
+        void set_heartbeat_interval(std::chrono::milliseconds interval);
 
+        // Transport remote inputs are fetched over; the other nodes must
+        // serve the same. Takes effect on the next start().
+        void set_transport(Transport transport);
 
         // Start node (workers + RPC server later)
         void start();
@@ -35,11 +98,33 @@ namespace orion::distributed {
         void stop();
 
         // this will let cluster know hi i am here with x cores
-        void register_with_cluster() const;   // 👈 NEW
+        void register_with_cluster();   // 👈 NEW
+
+        // Capacity and current load, as sent to the head
+        NodeLoad load();
+        size_t num_workers() const { return num_workers_; }
 
         // Access local runtime (useful for testing)
         orion::Runtime& local_runtime();
 
+        // Accept tasks from the head. From here on the node holds their
+        // deps, and pulls those produced elsewhere; their outputs are held
+        // for the head until free_objects() names them.
+        void admit(std::vector<orion::Task> tasks);
+
+        // Give back those of these tasks that are still backlogged; they
+        // will not run here. Returns their ids.
+        std::vector<orion::ObjectId> steal(const std::vector<orion::ObjectId>& task_ids);
+
+        // Head released these objects. Each is freed once the local tasks
+        // still consuming it have run.
+        void free_objects(const std::vector<orion::ObjectId>& object_ids);
+
+        // Receive created / freed ids instead of reporting them to the head
+        // over gRPC (in-process, or to send them over another transport)
+        void set_create_listener(CreateListener listener);
+        void set_free_listener(FreeListener listener);
+
         const std::string& node_id() const { return node_id_; }
         const std::string& address()  const { return address_; }
 
@@ -47,6 +132,8 @@ namespace orion::distributed {
         std::unique_ptr<orion::Runtime> runtime_;
         size_t num_workers_;
         int port_;
+        orion::SpillConfig spill_config_;
+        Transport transport_ = Transport::Grpc;
 
         // to know what cluster does this node belong to
         std::string cluster_address_;
@@ -56,6 +143,56 @@ namespace orion::distributed {
         std::string address_;     // "host:port" reported to head
 
         bool running_ = false;
+
+        // Pulls remote inputs; null without a head
+        std::unique_ptr<ObjectFetcher> fetcher_;
+
+        // Keep refs alive for the head until free_objects() names them.
+        // Caller holds held_mu_.
+        void hold_locked_(std::vector<orion::ObjectRef> refs);
+
+        // Move backlogged tasks into the local runtime while it is below
+        // kAdmitPerWorker per worker
+        void release_backlog();
+
+        // The head declared this node dead and forgot what it holds here:
+        // free those outputs and drop the tasks not started yet (the head
+        // sent them elsewhere). Called before registering again.
+        void drop_head_state();
+
+        // Start pulling any of these objects that are neither stored here
+        // nor produced by a task accepted here from the nodes that own them.
+        // No-op without a head (in-process).
+        void fetch_missing(const std::vector<orion::ObjectId>& object_ids);
+
+        // Outputs held on behalf of the head, and accepted tasks not yet in
+        // the local runtime (by id too, for steal() and fetch_missing())
+        std::unordered_map<orion::ObjectId, orion::ObjectRef> held_;
+        std::deque<orion::Task> backlog_;
+        std::unordered_set<orion::ObjectId> backlogged_;
+        std::mutex held_mu_;
+
+        // Created and freed ids waiting to be reported (batched by report_loop)
+        void report_loop();
+
+        // Sends load() to the head until stop()
+        void heartbeat_loop();
+        std::thread heartbeater_;
+        std::chrono::milliseconds heartbeat_interval_ = kHeartbeatInterval;
+        bool beating_ = false;
+        std::mutex beat_mu_;
+        std::condition_variable beat_cv_;
+
+        std::vector<orion::ObjectId> created_;
+        std::vector<uint64_t> created_sizes_;
+        std::vector<orion::ObjectId> freed_;
+        std::unordered_set<orion::ObjectId> replicas_;   // fetched copies; not reported
+        bool reporting_ = false;
+        std::thread reporter_;
+        std::mutex report_mu_;
+        std::condition_variable report_cv_;
+        CreateListener create_listener_;
+        FreeListener free_listener_;
     };
 
 } // namespace orion::distributed
@@ -1,19 +1,22 @@
 //
 // NodeServiceImpl — gRPC NodeService implementation that runs on each worker node.
-// Receives ExecuteTask calls from the head, resolves the function via FunctionRegistry,
-// and submits the task to the local Runtime.
+// Receives ExecuteTask / ExecuteTasks calls from the head, resolves the function via
+// FunctionRegistry, and admits the tasks to the node (NodeRuntime::admit). Inputs that
+// live on other nodes are fetched from them; GetObject serves this node's objects in
+// return. StealTasks hands back tasks that have not started.
 //
 
 #pragma once
 
 #include <iostream>
 #include <string>
-#include <cstring>
 
 #include <grpcpp/grpcpp.h>
 #include "distributed/generated/orion.grpc.pb.h"
 
 #include "distributed/node_runtime.h"
+#include "distributed/node_task.h"
+#include "distributed/object_fetcher.h"
 #include "distributed/functions/function_registry.h"
 #include "core/task.h"
 #include "core/object_ref.h"
@@ -31,74 +34,107 @@ public:
                              ::orion::TaskReply* reply) override
     {
         std::cout << "[Node:" << node_.node_id()
-                  << "] ExecuteTask  task=" << req->task_id()
+                  << "] ExecuteTask  task=" << orion::ObjectId::from_value(req->task())
                   << "  fn=" << req->function_name() << "\n" << std::flush;
 
-        if (!fn_reg_.exists(req->function_name())) {
-            std::cerr << "[Node:" << node_.node_id()
-                      << "] Unknown function: " << req->function_name() << "\n";
+        orion::Task task;
+        if (!build_task(*req, task)) {
             return grpc::Status(grpc::StatusCode::NOT_FOUND,
                                 "Unknown function: " + req->function_name());
         }
 
-        // ── Deserialize literal args from proto (bytes → std::any int) ─────────
-        // TaskRequest.args carries literal int values serialized as 4-byte LE.
-        // These are injected directly into the closure so the work function
-        // receives real values even when the object store has no dep objects.
-        std::vector<std::any> literal_args;
-        for (const auto& bytes : req->args()) {
-            if (bytes.size() >= 4) {
-                int val = 0;
-                std::memcpy(&val, bytes.data(), 4);
-                literal_args.push_back(val);
-            }
-        }
+        std::vector<orion::Task> tasks;
+        tasks.push_back(std::move(task));
+        node_.admit(std::move(tasks));
 
-        // Build an orion::Task that the local Runtime can execute
-        orion::Task task;
-        task.id            = req->task_id();
-        task.function_name = req->function_name();
+        reply->set_accepted(true);
+        reply->set_node_id(node_.node_id());
+        return grpc::Status::OK;
+    }
 
-        for (const auto& dep_id : req->dep_ids()) {
-            task.deps.push_back(orion::ObjectRef{dep_id});
+    // A batch of tasks from the head; all accepted ones are admitted
+    // together (see NodeRuntime::admit).
+    grpc::Status ExecuteTasks(grpc::ServerContext*,
+                              const ::orion::TaskBatch* req,
+                              ::orion::TaskBatchReply* reply) override
+    {
+        std::cout << "[Node:" << node_.node_id()
+                  << "] ExecuteTasks  count=" << req->tasks_size() << "\n" << std::flush;
+
+        std::vector<orion::Task> tasks;
+        tasks.reserve(req->tasks_size());
+        for (const auto& task_req : req->tasks()) {
+            orion::Task task;
+            if (!build_task(task_req, task)) {
+                reply->add_rejected_ids(task_req.task());
+                continue;
+            }
+            tasks.push_back(std::move(task));
         }
 
-        // Capture function name and literal args by value.
-        // If literal_args is non-empty they are passed directly to the function;
-        // otherwise the object-store resolver supplies the dep values (normal path).
-        const std::string fn_name = req->function_name();
-        task.work = [this, fn_name, literal_args](std::vector<std::any> dep_vals) -> std::any {
-            // Prefer literal args (sent over the wire) over dep values from store.
-            const std::vector<std::any>& effective_args =
-                literal_args.empty() ? dep_vals : literal_args;
+        // Held for the head until it sends FreeObjects
+        node_.admit(std::move(tasks));
 
-            std::any result = fn_reg_.invoke(fn_name, effective_args);
-            std::cout << "[Node:" << node_.node_id()
-                      << "] Task complete  fn=" << fn_name << "\n" << std::flush;
-            return result;
-        };
-
-        node_.local_runtime().submit(std::move(task));
-
-        reply->set_accepted(true);
         reply->set_node_id(node_.node_id());
         return grpc::Status::OK;
     }
 
-    // Milestone 3 — return the raw bytes of a completed object.
-    // For now this is stubbed.
+    // Another node is fetching one of our objects: stream its encoded bytes.
     grpc::Status GetObject(grpc::ServerContext*,
                            const ::orion::ObjectLocationRequest* req,
-                           ::orion::ObjectData* reply) override
+                           grpc::ServerWriter<::orion::ObjectChunk>* writer) override
     {
+        const orion::ObjectId object_id = orion::ObjectId::from_value(req->object());
         std::cout << "[Node:" << node_.node_id()
-                  << "] GetObject  object=" << req->object_id()
-                  << "  (TODO — Milestone 3)\n" << std::flush;
-        reply->set_object_id(req->object_id());
-        return grpc::Status(grpc::StatusCode::UNIMPLEMENTED, "Milestone 3");
+                  << "] GetObject  object=" << object_id << "\n" << std::flush;
+        return ObjectFetcher::serve(node_.local_runtime().store(), object_id, writer);
+    }
+
+    // The head released these objects (driver dropped them, no pending consumers).
+    grpc::Status FreeObjects(grpc::ServerContext*,
+                             const ::orion::ObjectIdList* req,
+                             ::orion::Empty*) override
+    {
+        std::vector<orion::ObjectId> ids;
+        ids.reserve(req->ids_size());
+        for (uint64_t id : req->ids()) {
+            ids.push_back(orion::ObjectId::from_value(id));
+        }
+        node_.free_objects(ids);
+        return grpc::Status::OK;
+    }
+
+    // The head moves tasks that have not started here to an idler node.
+    grpc::Status StealTasks(grpc::ServerContext*,
+                            const ::orion::ObjectIdList* req,
+                            ::orion::ObjectIdList* reply) override
+    {
+        std::vector<orion::ObjectId> ids;
+        ids.reserve(req->ids_size());
+        for (uint64_t id : req->ids()) {
+            ids.push_back(orion::ObjectId::from_value(id));
+        }
+        const auto stolen = node_.steal(ids);
+        std::cout << "[Node:" << node_.node_id() << "] StealTasks  asked="
+                  << ids.size() << "  given=" << stolen.size() << "\n" << std::flush;
+        for (const auto& id : stolen) reply->add_ids(id.value());
+        return grpc::Status::OK;
     }
 
 private:
+    // Turn a TaskRequest into a Task the local Runtime can execute.
+    // Returns false if the function is not registered here.
+    bool build_task(const ::orion::TaskRequest& req, orion::Task& task) {
+        task.id            = orion::ObjectId::from_value(req.task());
+        task.function_name = req.function_name();
+
+        for (uint64_t dep_id : req.deps()) {
+            task.deps.push_back(orion::ObjectRef{orion::ObjectId::from_value(dep_id)});
+        }
+        task.args.assign(req.args().begin(), req.args().end());
+        return bind_node_task(node_, fn_reg_, task);
+    }
+
     NodeRuntime&      node_;
     FunctionRegistry& fn_reg_;
 };
@@ -0,0 +1,59 @@
+//
+// bind_node_task — turns a task as it arrives from the head (id, function
+// name, deps and literal args, over either transport) into one the node's
+// local Runtime can run, by resolving the function via FunctionRegistry.
+//
+
+#pragma once
+
+#include <any>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "distributed/node_runtime.h"
+#include "distributed/functions/function_registry.h"
+#include "core/task.h"
+
+namespace orion::distributed {
+
+    // Sets task.work. Returns false if the function is not registered here.
+    inline bool bind_node_task(NodeRuntime& node, FunctionRegistry& fn_reg, orion::Task& task) {
+        if (!fn_reg.exists(task.function_name)) {
+            std::cerr << "[Node:" << node.node_id()
+                      << "] Unknown function: " << task.function_name << "\n";
+            return false;
+        }
+
+        // ── Deserialize literal args (bytes → std::any int) ──────────────────
+        // Task.args carries literal int values serialized as 4-byte LE.
+        // These are injected directly into the closure so the work function
+        // receives real values even when the object store has no dep objects.
+        std::vector<std::any> literal_args;
+        for (const auto& bytes : task.args) {
+            if (bytes.size() >= 4) {
+                int val = 0;
+                std::memcpy(&val, bytes.data(), 4);
+                literal_args.push_back(val);
+            }
+        }
+
+        // Capture function name and literal args by value.
+        // If literal_args is non-empty they are passed directly to the function;
+        // otherwise the object-store resolver supplies the dep values (normal path).
+        const std::string fn_name = task.function_name;
+        task.work = [&node, &fn_reg, fn_name, literal_args](std::vector<std::any> dep_vals) -> std::any {
+            // Prefer literal args (sent over the wire) over dep values from store.
+            const std::vector<std::any>& effective_args =
+                literal_args.empty() ? dep_vals : literal_args;
+
+            std::any result = fn_reg.invoke(fn_name, effective_args);
+            std::cout << "[Node:" << node.node_id()
+                      << "] Task complete  fn=" << fn_name << "\n" << std::flush;
+            return result;
+        };
+        return true;
+    }
+
+} // namespace orion::distributed
@@ -0,0 +1,593 @@
+// object_fetcher.cpp — node-to-node object transfer (the data plane)
+
+#include "object_fetcher.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <future>
+#include <iostream>
+#include <new>
+
+#include <unistd.h>
+
+#include "../core/object_codec.h"
+#include "rpc/tcp_connection.h"
+
+namespace orion::distributed {
+
+    // A failed transfer is retried this many times, this far apart
+    static constexpr int  kAttempts   = 3;
+    static constexpr auto kRetryDelay = std::chrono::milliseconds(100);
+    // Waiting for an object still being produced backs off up to this
+    static constexpr auto kMaxRetryDelay = std::chrono::seconds(1);
+    // A TCP transfer gives up once the owner sends nothing for this long
+    static constexpr auto kSocketTimeout = std::chrono::seconds(30);
+    // How long a gRPC GetObject waits for a spilled object to be restored
+    static constexpr auto kRestoreWait = kSocketTimeout;
+    // Longest codec name a GetObjectReply may carry
+    static constexpr uint32_t kMaxCodecName = 256;
+
+    // Largest object size a sender may announce: this machine's memory. A
+    // bigger one is taken for a corrupt reply rather than allocated.
+    static uint64_t max_object_bytes() {
+        static const uint64_t bytes = [] {
+            const long pages = ::sysconf(_SC_PHYS_PAGES);
+            const long page = ::sysconf(_SC_PAGESIZE);
+            return pages > 0 && page > 0 ? uint64_t(pages) * uint64_t(page) : UINT64_MAX;
+        }();
+        return bytes;
+    }
+
+    // What a failed object or a codec threw, for errors and replies
+    static std::string describe(std::exception_ptr error) {
+        try {
+            std::rethrow_exception(error);
+        } catch (const std::exception& e) {
+            return e.what();
+        } catch (...) {
+            return "unknown exception";
+        }
+    }
+
+    // A size the codec's prepare refused: no payload of its type has it
+    static std::string invalid_size(uint64_t total, const orion::ObjectCodec::Entry& codec) {
+        return "size " + std::to_string(total) + " invalid for codec '" + codec.name + "'";
+    }
+
+    // Decode received bytes; false with `error` set if the codec throws
+    static bool decode(const orion::ObjectCodec::Entry& codec, std::string_view bytes,
+                       std::any& value, std::string& error) {
+        try {
+            value = codec.decode(bytes);
+            return true;
+        } catch (...) {
+            error = "codec '" + codec.name + "' cannot decode: " +
+                    describe(std::current_exception());
+            return false;
+        }
+    }
+
+    ObjectFetcher::ObjectFetcher(orion::ObjectStore& store,
+                                 std::string head_address,
+                                 std::string self_node_id,
+                                 ReplicaHook on_replica,
+                                 size_t threads,
+                                 Transport transport)
+        : store_(store),
+          self_node_id_(std::move(self_node_id)),
+          on_replica_(std::move(on_replica)),
+          transport_(transport) {
+        head_ = ::orion::ClusterHead::NewStub(
+            grpc::CreateChannel(head_address, grpc::InsecureChannelCredentials()));
+        for (size_t i = 0; i < std::max<size_t>(threads, 1); ++i) {
+            threads_.emplace_back(&ObjectFetcher::run_loop, this);
+        }
+    }
+
+    ObjectFetcher::~ObjectFetcher() {
+        {
+            std::lock_guard<std::mutex> lock(mu_);
+            stopping_ = true;
+            for (auto* ctx : active_) ctx->TryCancel();
+            for (int fd : active_sockets_) tcp_abort(fd);
+        }
+        work_cv_.notify_all();
+        stop_cv_.notify_all();
+        for (auto& t : threads_) t.join();
+        for (auto& [address, fds] : idle_sockets_) {
+            for (int fd : fds) tcp_close(fd);
+        }
+
+        // Nothing will finish the transfers still queued
+        std::lock_guard<std::mutex> lock(mu_);
+        for (auto& [id, t] : transfers_) t->done = true;
+        transfers_.clear();
+        done_cv_.notify_all();
+    }
+
+    void ObjectFetcher::request(orion::ObjectId id) {
+        start(id);
+    }
+
+    bool ObjectFetcher::fetch(orion::ObjectId id) {
+        auto transfer = start(id);
+        if (!transfer) return true;
+
+        std::unique_lock<std::mutex> lock(mu_);
+        done_cv_.wait(lock, [&] { return transfer->done; });
+        return transfer->ok;
+    }
+
+    std::shared_ptr<ObjectFetcher::Transfer> ObjectFetcher::start(orion::ObjectId id) {
+        if (store_.contains(id)) return nullptr;
+
+        std::lock_guard<std::mutex> lock(mu_);
+        if (stopping_) {
+            auto failed = std::make_shared<Transfer>();
+            failed->done = true;
+            return failed;
+        }
+        auto [it, added] = transfers_.try_emplace(id);
+        if (added) {
+            it->second = std::make_shared<Transfer>();
+            queue_.push_back(id);
+            work_cv_.notify_one();
+        }
+        return it->second;
+    }
+
+    void ObjectFetcher::run_loop() {
+        while (true) {
+            orion::ObjectId id;
+            {
+                std::unique_lock<std::mutex> lock(mu_);
+                work_cv_.wait(lock, [&] { return stopping_ || !queue_.empty(); });
+                if (stopping_) return;
+                id = queue_.front();
+                queue_.pop_front();
+            }
+
+            bool ok = false;
+            std::string error;
+            int failures = 0;
+            auto delay = kRetryDelay;
+            const auto give_up = std::chrono::steady_clock::now() + kProducerWait;
+            while (true) {
+                // It may have arrived by another route (produced here, or
+                // put by a transfer that raced this one)
+                const Attempt attempt = store_.contains(id) ? Attempt::Done : transfer(id, error);
+                if (attempt == Attempt::Done) {
+                    ok = true;
+                    break;
+                }
+                if (attempt == Attempt::Failed) {
+                    if (++failures >= kAttempts) break;
+                    delay = kRetryDelay;
+                } else if (std::chrono::steady_clock::now() >= give_up) {
+                    break;
+                }
+
+                std::unique_lock<std::mutex> lock(mu_);
+                if (stop_cv_.wait_for(lock, delay, [&] { return stopping_; })) break;
+                if (attempt == Attempt::NotYet) {
+                    delay = std::min<std::chrono::milliseconds>(delay * 2, kMaxRetryDelay);
+                }
+            }
+            if (!ok) {
+                std::cerr << "[ObjectFetcher] Fetching " << id << " FAILED: "
+                          << error << "\n" << std::flush;
+            }
+
+            std::lock_guard<std::mutex> lock(mu_);
+            auto it = transfers_.find(id);
+            if (it != transfers_.end()) {
+                it->second->done = true;
+                it->second->ok = ok;
+                transfers_.erase(it);
+            }
+            done_cv_.notify_all();
+        }
+    }
+
+    ObjectFetcher::Attempt ObjectFetcher::transfer(orion::ObjectId id, std::string& error) {
+        error.clear();
+
+        // ── Where is it? ─────────────────────────────────────────────────────
+        ::orion::ObjectLocationRequest req;
+        req.set_object(id.value());
+
+        ::orion::ObjectLocationReply location;
+        {
+            grpc::ClientContext ctx;
+            grpc::Status status = head_->GetObjectLocation(&ctx, req, &location);
+            if (!status.ok()) {
+                error = "GetObjectLocation: " + status.error_message();
+                return status.error_code() == grpc::StatusCode::UNAVAILABLE ? Attempt::NotYet
+                                                                             : Attempt::Failed;
+            }
+        }
+        if (location.node_id() == self_node_id_) {
+            // Objects are put before they are reported, so the head's entry
+            // is stale: it was freed here
+            error = "head places it on this node, which no longer has it";
+            return Attempt::Failed;
+        }
+        if (location.address().empty()) {
+            error = "no address for " + location.node_id();
+            return Attempt::Failed;
+        }
+
+        return transport_ == Transport::Tcp ? pull_tcp(id, location, error)
+                                            : pull_grpc(id, location, error);
+    }
+
+    ObjectFetcher::Attempt ObjectFetcher::pull_grpc(orion::ObjectId id,
+                                                    const ::orion::ObjectLocationReply& location,
+                                                    std::string& error) {
+        ::orion::ObjectLocationRequest req;
+        req.set_object(id.value());
+
+        grpc::ClientContext ctx;
+        {
+            std::lock_guard<std::mutex> lock(mu_);
+            if (stopping_) {
+                error = "shutting down";
+                return Attempt::Failed;
+            }
+            active_.insert(&ctx);
+        }
+        struct Untrack {
+            ObjectFetcher* self;
+            grpc::ClientContext* ctx;
+            ~Untrack() {
+                std::lock_guard<std::mutex> lock(self->mu_);
+                self->active_.erase(ctx);
+            }
+        } untrack{this, &ctx};
+
+        auto reader = node_stub(location.address()).GetObject(&ctx, req);
+
+        const orion::ObjectCodec::Entry* codec = nullptr;
+        auto value = std::make_shared<std::any>();
+        char* dst = nullptr;         // in-place payload bytes, if the codec allows
+        std::string staging;         // encoded bytes otherwise
+        size_t total = 0;
+        size_t received = 0;
+        bool first = true;
+
+        ::orion::ObjectChunk chunk;
+        while (reader->Read(&chunk)) {
+            if (first) {
+                first = false;
+                codec = orion::ObjectCodec::find_by_name(chunk.codec());
+                if (!codec) {
+                    error = "no codec named '" + chunk.codec() + "'";
+                    ctx.TryCancel();
+                    break;
+                }
+                total = chunk.total_bytes();
+                if (total > max_object_bytes()) {
+                    error = "announced size " + std::to_string(total) + " is too large";
+                    ctx.TryCancel();
+                    break;
+                }
+                try {
+                    if (codec->prepare) {
+                        dst = codec->prepare(*value, total);
+                    } else {
+                        staging.reserve(total);
+                    }
+                } catch (const std::bad_alloc&) {
+                    error = "cannot allocate " + std::to_string(total) + " bytes";
+                    ctx.TryCancel();
+                    break;
+                }
+                // Decoding such bytes would read past them (scalars) or drop
+                // a partial element (vectors)
+                if (codec->prepare && !dst) {
+                    error = invalid_size(total, *codec);
+                    ctx.TryCancel();
+                    break;
+                }
+            }
+
+            const std::string& data = chunk.data();
+            if (data.size() > total - received) {
+                error = "more bytes than announced";
+                ctx.TryCancel();
+                break;
+            }
+            if (dst) {
+                std::memcpy(dst + received, data.data(), data.size());
+            } else {
+                staging.append(data);
+            }
+            received += data.size();
+        }
+
+        grpc::Status status = reader->Finish();
+        if (!error.empty()) return Attempt::Failed;
+        if (!status.ok()) {
+            error = "GetObject from " + location.node_id() + ": " + status.error_message();
+            return Attempt::Failed;
+        }
+        if (first || received != total) {
+            error = "stream ended after " + std::to_string(received) + " of " +
+                    std::to_string(total) + " bytes";
+            return Attempt::Failed;
+        }
+        if (!dst && !decode(*codec, staging, *value, error)) return Attempt::Failed;
+
+        if (on_replica_) on_replica_(id);
+        store_.put_handle(id, std::move(value));
+        return Attempt::Done;
+    }
+
+    ObjectFetcher::Attempt ObjectFetcher::pull_tcp(orion::ObjectId id,
+                                                   const ::orion::ObjectLocationReply& location,
+                                                   std::string& error) {
+        const std::string& address = location.address();
+        const int fd = take_socket(address, error);
+        if (fd < 0) return Attempt::Failed;
+        {
+            std::lock_guard<std::mutex> lock(mu_);
+            if (stopping_) {
+                tcp_close(fd);
+                error = "shutting down";
+                return Attempt::Failed;
+            }
+            active_sockets_.insert(fd);
+        }
+        // Closed unless the exchange ended cleanly, in which case it is kept
+        bool reusable = false;
+        struct Untrack {
+            ObjectFetcher* self;
+            const std::string& address;
+            int fd;
+            bool& reusable;
+            ~Untrack() {
+                {
+                    std::lock_guard<std::mutex> lock(self->mu_);
+                    self->active_sockets_.erase(fd);
+                }
+                if (reusable) {
+                    self->return_socket(address, fd);
+                } else {
+                    tcp_close(fd);
+                }
+            }
+        } untrack{this, address, fd, reusable};
+
+        const uint64_t raw_id = id.value();
+        const FrameHeader request{sizeof(raw_id), 1, FrameType::GetObject};
+        if (!tcp_send_frame(fd, request, {std::string_view(reinterpret_cast<const char*>(&raw_id),
+                                                          sizeof(raw_id))})) {
+            error = "GetObject to " + location.node_id() + ": send failed";
+            return Attempt::Failed;
+        }
+
+        FrameHeader reply;
+        if (!tcp_read_exact(fd, &reply, sizeof(reply)) ||
+            reply.type != FrameType::GetObjectReply || reply.request_id != 1) {
+            error = "GetObject from " + location.node_id() + ": no reply";
+            return Attempt::Failed;
+        }
+        if (reply.status != FrameStatus::Ok) {
+            std::string message(size_t(std::min<uint64_t>(reply.length, 4096)), '\0');
+            reusable = message.size() == reply.length &&
+                       tcp_read_exact(fd, message.data(), message.size());
+            error = "GetObject from " + location.node_id() + ": " + message;
+            return Attempt::Failed;
+        }
+
+        // codec name and size, then the payload itself
+        uint32_t name_bytes = 0;
+        std::string name;
+        uint64_t total = 0;
+        if (!tcp_read_exact(fd, &name_bytes, sizeof(name_bytes)) || name_bytes > kMaxCodecName) {
+            error = "bad GetObjectReply";
+            return Attempt::Failed;
+        }
+        name.resize(name_bytes);
+        if (!tcp_read_exact(fd, name.data(), name.size()) ||
+            !tcp_read_exact(fd, &total, sizeof(total)) || total > max_object_bytes() ||
+            reply.length != sizeof(name_bytes) + name_bytes + sizeof(total) + total) {
+            error = "bad GetObjectReply";
+            return Attempt::Failed;
+        }
+        const orion::ObjectCodec::Entry* codec = orion::ObjectCodec::find_by_name(name);
+        if (!codec) {
+            error = "no codec named '" + name + "'";
+            return Attempt::Failed;
+        }
+
+        auto value = std::make_shared<std::any>();
+        char* dst = nullptr;
+        std::string staging;   // encoded bytes, for codecs without in-place payloads
+        try {
+            if (codec->prepare) {
+                dst = codec->prepare(*value, total);
+            } else {
+                staging.resize(total);
+            }
+        } catch (const std::bad_alloc&) {
+            error = "cannot allocate " + std::to_string(total) + " bytes";
+            return Attempt::Failed;
+        }
+        if (codec->prepare && !dst) {
+            // The payload is left unread: the connection is not reused
+            error = invalid_size(total, *codec);
+            return Attempt::Failed;
+        }
+        if (!tcp_read_exact(fd, dst ? dst : staging.data(), total)) {
+            error = "GetObject from " + location.node_id() + ": stream ended early";
+            return Attempt::Failed;
+        }
+        reusable = true;
+        if (!dst && !decode(*codec, staging, *value, error)) return Attempt::Failed;
+
+        if (on_replica_) on_replica_(id);
+        store_.put_handle(id, std::move(value));
+        return Attempt::Done;
+    }
+
+    int ObjectFetcher::take_socket(const std::string& address, std::string& error) {
+        {
+            std::lock_guard<std::mutex> lock(stubs_mu_);
+            auto it = idle_sockets_.find(address);
+            if (it != idle_sockets_.end() && !it->second.empty()) {
+                const int fd = it->second.back();
+                it->second.pop_back();
+                return fd;
+            }
+        }
+        const int fd = tcp_connect(address, kSocketTimeout, error);
+        if (fd < 0) error = "GetObject: " + error;
+        return fd;
+    }
+
+    void ObjectFetcher::return_socket(const std::string& address, int fd) {
+        std::lock_guard<std::mutex> lock(stubs_mu_);
+        idle_sockets_[address].push_back(fd);
+    }
+
+    ::orion::NodeService::Stub& ObjectFetcher::node_stub(const std::string& address) {
+        std::lock_guard<std::mutex> lock(stubs_mu_);
+        auto& stub = nodes_[address];
+        if (!stub) {
+            stub = ::orion::NodeService::NewStub(
+                grpc::CreateChannel(address, grpc::InsecureChannelCredentials()));
+        }
+        return *stub;
+    }
+
+    grpc::Status ObjectFetcher::serve(orion::ObjectStore& store, orion::ObjectId id,
+                                      grpc::ServerWriter<::orion::ObjectChunk>* writer) {
+        // A spilled object is restored first, on the store's I/O thread; this
+        // handler thread waits for it. Bounded: an object freed meanwhile is
+        // never restored.
+        auto restored = std::make_shared<std::promise<void>>();
+        if (store.when_restored(id, [restored] { restored->set_value(); }) &&
+            restored->get_future().wait_for(kRestoreWait) != std::future_status::ready) {
+            return grpc::Status(grpc::StatusCode::UNAVAILABLE,
+                                "Object not restored in time: " + id.name());
+        }
+
+        // Holding the handle keeps the payload alive for the whole stream,
+        // even if the object is freed meanwhile
+        orion::ObjectHandle handle;
+        try {
+            handle = store.get_handle(id);
+        } catch (...) {
+            return grpc::Status(grpc::StatusCode::INTERNAL,
+                                "Object failed: " + describe(std::current_exception()));
+        }
+        if (!handle) {
+            return grpc::Status(grpc::StatusCode::NOT_FOUND, "Object not here: " + id.name());
+        }
+        const orion::ObjectCodec::Entry* codec = orion::ObjectCodec::find(handle->type());
+        if (!codec) {
+            return grpc::Status(grpc::StatusCode::FAILED_PRECONDITION,
+                                std::string("No codec for type ") + handle->type().name());
+        }
+
+        std::string encoded;
+        std::string_view bytes;
+        try {
+            if (codec->view) {
+                bytes = codec->view(*handle);
+            } else {
+                codec->encode(*handle, encoded);
+                bytes = encoded;
+            }
+        } catch (...) {
+            return grpc::Status(grpc::StatusCode::INTERNAL,
+                                "Cannot encode: " + describe(std::current_exception()));
+        }
+
+        // The first chunk always goes out, so empty objects arrive too
+        ::orion::ObjectChunk chunk;
+        chunk.set_object_id(id.value());
+        chunk.set_codec(codec->name);
+        chunk.set_total_bytes(bytes.size());
+        size_t offset = 0;
+        do {
+            const size_t n = std::min(kChunkBytes, bytes.size() - offset);
+            chunk.set_data(bytes.data() + offset, n);
+            if (!writer->Write(chunk)) {
+                return grpc::Status(grpc::StatusCode::CANCELLED, "Receiver went away");
+            }
+            offset += n;
+            // Later chunks carry data only
+            chunk.clear_object_id();
+            chunk.clear_codec();
+            chunk.clear_total_bytes();
+        } while (offset < bytes.size());
+
+        return grpc::Status::OK;
+    }
+
+    // The GetObjectReply for an object that is resident, failed or absent
+    static void reply_object(orion::ObjectStore& store, orion::ObjectId id,
+                             TcpConnection& conn, uint32_t request_id) {
+        orion::ObjectHandle handle;
+        try {
+            handle = store.get_handle(id);
+        } catch (...) {
+            conn.send(FrameType::GetObjectReply, request_id,
+                      "Object failed: " + describe(std::current_exception()),
+                      FrameStatus::Failed);
+            return;
+        }
+        if (!handle) {
+            conn.send(FrameType::GetObjectReply, request_id, "Object not here: " + id.name(),
+                      FrameStatus::NotFound);
+            return;
+        }
+        const orion::ObjectCodec::Entry* codec = orion::ObjectCodec::find(handle->type());
+        if (!codec) {
+            conn.send(FrameType::GetObjectReply, request_id,
+                      std::string("No codec for type ") + handle->type().name(),
+                      FrameStatus::Failed);
+            return;
+        }
+
+        // The payload goes out from where it is stored; the handle keeps it
+        // alive until written, even if the object is freed meanwhile
+        std::string prefix;
+        WireWriter out(prefix);
+        out.bytes(codec->name);
+        try {
+            if (codec->view) {
+                const std::string_view bytes = codec->view(*handle);
+                out.u64(bytes.size());
+                conn.send(FrameType::GetObjectReply, request_id, std::move(prefix), bytes,
+                          std::move(handle));
+            } else {
+                auto encoded = std::make_shared<std::string>();
+                codec->encode(*handle, *encoded);
+                out.u64(encoded->size());
+                conn.send(FrameType::GetObjectReply, request_id, std::move(prefix), *encoded,
+                          std::move(encoded));
+            }
+        } catch (...) {
+            conn.send(FrameType::GetObjectReply, request_id,
+                      "Cannot encode: " + describe(std::current_exception()),
+                      FrameStatus::Failed);
+        }
+    }
+
+    void ObjectFetcher::serve(orion::ObjectStore& store, orion::ObjectId id,
+                              TcpConnection& conn, uint32_t request_id) {
+        // A spilled object is sent once restored, from the store's I/O
+        // thread, so the loop thread goes back to its other connections
+        auto reply = [&store, id, conn = conn.shared_from_this(), request_id] {
+            reply_object(store, id, *conn, request_id);
+        };
+        if (!store.when_restored(id, reply)) reply();
+    }
+
+} // namespace orion::distributed
@@ -0,0 +1,143 @@
+// object_fetcher.h — node-to-node object transfer (the data plane)
+//
+// A task dispatched to this node may read objects produced on other nodes.
+// The fetcher asks the head where such an object lives (GetObjectLocation)
+// and streams it from the owner with NodeService::GetObject, in chunks of
+// kChunkBytes.
+//
+// Chunks are written straight into the payload that is then stored, so a
+// transfer holds the object plus at most one chunk in memory. That holds for
+// types whose codec can prepare a payload in place (strings, vectors of
+// trivial types, scalars). Other codec types are collected as encoded bytes
+// and decoded once, at the cost of one extra copy.
+//
+// Requests for an object already being fetched join that transfer instead
+// of starting another. A fixed set of threads runs the transfers, so a burst
+// of requests does not open one stream per object at once.
+//
+// An object the head has no copy of but is producing (it was lost with its
+// node and is being rebuilt from lineage) is asked for again with backoff,
+// for up to kProducerWait, instead of failing after kAttempts.
+//
+// Over the TCP transport an object is one GetObjectReply frame instead of a
+// chunk stream, and its payload is read off the socket directly into the
+// buffer the codec prepared, with no chunk copies at all. Connections to
+// each owner are kept for the next transfer.
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <grpcpp/grpcpp.h>
+#include "distributed/generated/orion.grpc.pb.h"
+
+#include "../core/object_store.h"
+#include "rpc/node_client.h"
+
+namespace orion::distributed {
+
+    class TcpConnection;
+
+    class ObjectFetcher {
+    public:
+        // Chunk size on the wire, for both the sender and the receiver
+        static constexpr size_t kChunkBytes = 1 << 20;
+        static constexpr size_t kDefaultThreads = 4;
+        static constexpr auto kProducerWait = std::chrono::seconds(30);
+
+        // Runs just before a fetched object is put into the store
+        using ReplicaHook = std::function<void(orion::ObjectId)>;
+
+        ObjectFetcher(orion::ObjectStore& store,
+                      std::string head_address,
+                      std::string self_node_id,
+                      ReplicaHook on_replica = {},
+                      size_t threads = kDefaultThreads,
+                      Transport transport = Transport::Grpc);
+        // Cancels transfers in progress and drops queued ones
+        ~ObjectFetcher();
+
+        ObjectFetcher(const ObjectFetcher&) = delete;
+        ObjectFetcher& operator=(const ObjectFetcher&) = delete;
+
+        // Start fetching `id` unless it is local or already on its way.
+        // Returns at once; the object arrives through a store put.
+        void request(orion::ObjectId id);
+
+        // Fetch `id` and wait for it. True once it is in the local store.
+        bool fetch(orion::ObjectId id);
+
+        // Send `id` from `store` to a GetObject caller. Used by NodeService.
+        // A spilled object is restored first; a failed one is answered with
+        // INTERNAL and its error.
+        static grpc::Status serve(orion::ObjectStore& store, orion::ObjectId id,
+                                  grpc::ServerWriter<::orion::ObjectChunk>* writer);
+        // The same as a GetObjectReply frame, sent from the stored payload.
+        // Used by TcpNodeServer. Returns at once: a spilled object is sent
+        // from the store's I/O thread once restored, not from the loop.
+        static void serve(orion::ObjectStore& store, orion::ObjectId id,
+                          TcpConnection& conn, uint32_t request_id);
+
+    private:
+        struct Transfer {
+            bool done = false;
+            bool ok = false;
+        };
+
+        // Starts (or joins) a transfer; nullptr if `id` is already local
+        std::shared_ptr<Transfer> start(orion::ObjectId id);
+
+        void run_loop();
+
+        enum class Attempt {
+            Done,      // stored
+            Failed,    // counts against kAttempts
+            NotYet,    // the head is still producing it
+        };
+
+        // One attempt: locate, stream, store. Fills `error` unless Done.
+        Attempt transfer(orion::ObjectId id, std::string& error);
+        // The stream part, per transport
+        Attempt pull_grpc(orion::ObjectId id, const ::orion::ObjectLocationReply& location,
+                          std::string& error);
+        Attempt pull_tcp(orion::ObjectId id, const ::orion::ObjectLocationReply& location,
+                         std::string& error);
+
+        ::orion::NodeService::Stub& node_stub(const std::string& address);
+        // An idle connection to `address`, or a new one; -1 on failure
+        int take_socket(const std::string& address, std::string& error);
+        void return_socket(const std::string& address, int fd);
+
+        orion::ObjectStore& store_;
+        std::string self_node_id_;
+        ReplicaHook on_replica_;
+
+        std::unique_ptr<::orion::ClusterHead::Stub> head_;
+        const Transport transport_;
+        std::unordered_map<std::string, std::unique_ptr<::orion::NodeService::Stub>> nodes_;
+        std::unordered_map<std::string, std::vector<int>> idle_sockets_;   // by owner address
+        std::mutex stubs_mu_;
+
+        std::unordered_map<orion::ObjectId, std::shared_ptr<Transfer>> transfers_;
+        std::deque<orion::ObjectId> queue_;
+        std::unordered_set<grpc::ClientContext*> active_;   // cancelled on shutdown
+        std::unordered_set<int> active_sockets_;             // aborted on shutdown
+        bool stopping_ = false;
+        std::mutex mu_;
+        std::condition_variable work_cv_;
+        std::condition_variable done_cv_;
+        std::condition_variable stop_cv_;   // wakes transfers waiting to retry
+        std::vector<std::thread> threads_;
+    };
+
+} // namespace orion::distributed
@@ -2,11 +2,26 @@
 // GrpcNodeClient — head-side NodeClient implementation that calls
 // NodeService::ExecuteTask on real worker nodes via gRPC.
 //
+// Calls are asynchronous (completion-queue API) and pipelined: submit_task
+// and free_objects only build the request and start the call, so
+// ClusterScheduler::schedule never waits on the network and a slow node
+// does not hold up dispatch to the others. Each node allows up to `window`
+// calls in flight; calls beyond that queue per node, in order, and are
+// started as earlier ones complete. One completion thread handles every
+// reply. A batch (submit_tasks → ExecuteTasks) takes one window slot, as
+// does a steal_tasks → StealTasks call.
+//
 
 #pragma once
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
 #include <string>
+#include <thread>
 #include <unordered_map>
+#include <vector>
 #include <mutex>
 #include <memory>
 #include <iostream>
@@ -21,84 +36,328 @@ namespace orion::distributed {
 
 class GrpcNodeClient : public NodeClient {
 public:
-    explicit GrpcNodeClient(NodeRegistry& registry)
-        : registry_(registry) {}
+    static constexpr size_t kDefaultWindow = 64;
+    // A call still unanswered after this long fails and frees its slot
+    static constexpr auto kCallTimeout = std::chrono::seconds(30);
+
+    explicit GrpcNodeClient(NodeRegistry& registry, size_t window = kDefaultWindow)
+        : registry_(registry), window_(window ? window : 1) {
+        completer_ = std::thread(&GrpcNodeClient::complete_loop, this);
+    }
+
+    // Waits for every queued and in-flight call
+    ~GrpcNodeClient() override {
+        flush();
+        cq_.Shutdown();
+        completer_.join();
+    }
 
-    // Convert orion::Task → TaskRequest proto and call NodeService::ExecuteTask.
-    // The task MUST have function_name set; dep_ids are passed as proto repeated strings.
+    GrpcNodeClient(const GrpcNodeClient&) = delete;
+    GrpcNodeClient& operator=(const GrpcNodeClient&) = delete;
+
+    // Convert orion::Task → TaskRequest proto and start NodeService::ExecuteTask.
+    // Returns without waiting for the node; failures are logged on completion.
     orion::ObjectRef submit_task(const std::string& node_id,
                                  orion::Task task) override
     {
-        auto* stub = get_or_create_stub(node_id);
-        if (!stub) {
-            std::cerr << "[GrpcNodeClient] No stub for node=" << node_id << "\n";
-            return orion::ObjectRef{task.id};
+        auto call = std::make_unique<ExecuteCall>();
+        to_request(task, call->request);
+        enqueue(node_id, std::move(call));
+        return orion::ObjectRef{task.id};
+    }
+
+    // All tasks travel in one ExecuteTasks call
+    void submit_tasks(const std::string& node_id, std::vector<orion::Task> tasks,
+                      DispatchDone done) override
+    {
+        auto call = std::make_unique<BatchCall>();
+        call->request.mutable_tasks()->Reserve(int(tasks.size()));
+        for (auto& task : tasks) {
+            to_request(task, *call->request.add_tasks());
+        }
+        call->done = std::move(done);
+        enqueue(node_id, std::move(call));
+    }
+
+    void free_objects(const std::string& node_id,
+                      const std::vector<orion::ObjectId>& object_ids) override
+    {
+        auto call = std::make_unique<FreeCall>();
+        call->request.mutable_ids()->Reserve(int(object_ids.size()));
+        for (const auto& id : object_ids) {
+            call->request.add_ids(id.value());
+        }
+        enqueue(node_id, std::move(call));
+    }
+
+    void steal_tasks(const std::string& node_id,
+                     const std::vector<orion::ObjectId>& task_ids,
+                     StealDone done) override
+    {
+        auto call = std::make_unique<StealCall>();
+        call->request.mutable_ids()->Reserve(int(task_ids.size()));
+        for (const auto& id : task_ids) {
+            call->request.add_ids(id.value());
         }
+        call->done = std::move(done);
+        enqueue(node_id, std::move(call));
+    }
+
+    // Block until every call started or queued so far has completed
+    void flush() override {
+        std::unique_lock<std::mutex> lock(mu_);
+        idle_cv_.wait(lock, [&] { return outstanding_ == 0; });
+    }
+
+    // Calls queued or in flight, over all nodes
+    size_t outstanding() {
+        std::lock_guard<std::mutex> lock(mu_);
+        return outstanding_;
+    }
+
+    // Log every accepted task (on by default)
+    static void set_verbose(bool verbose) {
+        verbose_.store(verbose, std::memory_order_relaxed);
+    }
+
+private:
+    struct Node;
 
-        // Build proto request
-        ::orion::TaskRequest req;
-        req.set_task_id(task.id);
+    // The task MUST have function_name set; ids travel as their 64-bit values
+    static void to_request(orion::Task& task, ::orion::TaskRequest& req) {
+        req.set_task(task.id.value());
         req.set_function_name(task.function_name);
+        req.mutable_deps()->Reserve(int(task.deps.size()));
         for (const auto& dep : task.deps) {
-            req.add_dep_ids(dep.id);
+            req.add_deps(dep.id.value());
         }
         // Forward serialized literal args bytes to the node
-        for (const auto& bytes : task.args) {
-            req.add_args(bytes);
+        for (auto& bytes : task.args) {
+            req.add_args(std::move(bytes));
         }
+    }
 
-        ::orion::TaskReply reply;
+    // One RPC. Owned by its Node's backlog until started, then by the
+    // completion queue until its tag comes back.
+    struct Call {
+        virtual ~Call() = default;
+        virtual void start(orion::NodeService::Stub& stub, grpc::CompletionQueue& cq) = 0;
+        virtual void finish(const std::string& node_id) = 0;
+
+        Node* node = nullptr;
         grpc::ClientContext ctx;
+        grpc::Status status;
+    };
 
-        grpc::Status status = stub->ExecuteTask(&ctx, req, &reply);
+    struct ExecuteCall final : Call {
+        ::orion::TaskRequest request;
+        ::orion::TaskReply reply;
+        std::unique_ptr<grpc::ClientAsyncResponseReader<::orion::TaskReply>> rpc;
 
-        if (status.ok() && reply.accepted()) {
-            std::cout << "[GrpcNodeClient] ExecuteTask(" << task.id
-                      << ") accepted by " << node_id << "\n" << std::flush;
-        } else {
-            std::cerr << "[GrpcNodeClient] ExecuteTask FAILED for task="
-                      << task.id << ": " << status.error_message() << "\n";
+        void start(orion::NodeService::Stub& stub, grpc::CompletionQueue& cq) override {
+            rpc = stub.PrepareAsyncExecuteTask(&ctx, request, &cq);
+            rpc->StartCall();
+            rpc->Finish(&reply, &status, this);
         }
 
-        return orion::ObjectRef{task.id};
+        void finish(const std::string& node_id) override {
+            const auto task_id = orion::ObjectId::from_value(request.task());
+            if (status.ok() && reply.accepted()) {
+                if (verbose_.load(std::memory_order_relaxed)) {
+                    std::cout << "[GrpcNodeClient] ExecuteTask(" << task_id
+                              << ") accepted by " << node_id << "\n" << std::flush;
+                }
+            } else {
+                std::cerr << "[GrpcNodeClient] ExecuteTask FAILED for task="
+                          << task_id << ": " << status.error_message() << "\n";
+            }
+        }
+    };
+
+    struct BatchCall final : Call {
+        ::orion::TaskBatch request;
+        ::orion::TaskBatchReply reply;
+        DispatchDone done;
+        std::unique_ptr<grpc::ClientAsyncResponseReader<::orion::TaskBatchReply>> rpc;
+
+        void start(orion::NodeService::Stub& stub, grpc::CompletionQueue& cq) override {
+            rpc = stub.PrepareAsyncExecuteTasks(&ctx, request, &cq);
+            rpc->StartCall();
+            rpc->Finish(&reply, &status, this);
+        }
+
+        void finish(const std::string& node_id) override {
+            std::vector<orion::ObjectId> rejected;
+            if (status.ok()) {
+                if (verbose_.load(std::memory_order_relaxed)) {
+                    std::cout << "[GrpcNodeClient] ExecuteTasks(" << request.tasks_size()
+                              << " tasks) accepted by " << node_id << "\n" << std::flush;
+                }
+                rejected.reserve(reply.rejected_ids_size());
+                for (uint64_t id : reply.rejected_ids()) {
+                    rejected.push_back(orion::ObjectId::from_value(id));
+                    std::cerr << "[GrpcNodeClient] Task " << rejected.back()
+                              << " rejected by " << node_id << "\n";
+                }
+            } else {
+                std::cerr << "[GrpcNodeClient] ExecuteTasks FAILED on " << node_id << " ("
+                          << request.tasks_size() << " tasks): " << status.error_message() << "\n";
+            }
+            if (done) done(status.ok(), std::move(rejected));
+        }
+    };
+
+    struct FreeCall final : Call {
+        ::orion::ObjectIdList request;
+        ::orion::Empty reply;
+        std::unique_ptr<grpc::ClientAsyncResponseReader<::orion::Empty>> rpc;
+
+        void start(orion::NodeService::Stub& stub, grpc::CompletionQueue& cq) override {
+            rpc = stub.PrepareAsyncFreeObjects(&ctx, request, &cq);
+            rpc->StartCall();
+            rpc->Finish(&reply, &status, this);
+        }
+
+        void finish(const std::string& node_id) override {
+            if (!status.ok()) {
+                std::cerr << "[GrpcNodeClient] FreeObjects FAILED on " << node_id
+                          << ": " << status.error_message() << "\n";
+            }
+        }
+    };
+
+    struct StealCall final : Call {
+        ::orion::ObjectIdList request;
+        ::orion::ObjectIdList reply;
+        StealDone done;
+        std::unique_ptr<grpc::ClientAsyncResponseReader<::orion::ObjectIdList>> rpc;
+
+        void start(orion::NodeService::Stub& stub, grpc::CompletionQueue& cq) override {
+            rpc = stub.PrepareAsyncStealTasks(&ctx, request, &cq);
+            rpc->StartCall();
+            rpc->Finish(&reply, &status, this);
+        }
+
+        void finish(const std::string& node_id) override {
+            std::vector<orion::ObjectId> stolen;
+            if (status.ok()) {
+                stolen.reserve(reply.ids_size());
+                for (uint64_t id : reply.ids()) {
+                    stolen.push_back(orion::ObjectId::from_value(id));
+                }
+            } else {
+                std::cerr << "[GrpcNodeClient] StealTasks FAILED on " << node_id
+                          << ": " << status.error_message() << "\n";
+            }
+            if (done) done(std::move(stolen));
+        }
+    };
+
+    struct Node {
+        std::string node_id;
+        std::unique_ptr<orion::NodeService::Stub> stub;
+        size_t in_flight = 0;
+        std::deque<std::unique_ptr<Call>> backlog;   // waiting for a window slot
+    };
+
+    // Queue `call` for `node_id` and start whatever the window allows. A
+    // call to an unknown node fails at once, so its callback still runs.
+    void enqueue(const std::string& node_id, std::unique_ptr<Call> call) {
+        std::vector<Call*> to_start;
+        {
+            std::lock_guard<std::mutex> lock(mu_);
+            Node* node = node_locked(node_id);
+            if (node) {
+                call->node = node;
+                node->backlog.push_back(std::move(call));
+                ++outstanding_;
+                take_startable_locked(*node, to_start);
+            }
+        }
+        if (call) {
+            std::cerr << "[GrpcNodeClient] No stub for node=" << node_id << "\n";
+            call->status = grpc::Status(grpc::StatusCode::UNAVAILABLE, "unknown node");
+            call->finish(node_id);
+            return;
+        }
+        start(to_start);
     }
 
-private:
-    // Returns raw pointer to stub (owned by stubs_ map).
-    // Creates a new stub if this node_id hasn't been seen yet.
-    orion::NodeService::Stub* get_or_create_stub(const std::string& node_id) {
-        std::lock_guard<std::mutex> lock(mu_);
+    // Move calls from the backlog into the window. Caller holds mu_.
+    void take_startable_locked(Node& node, std::vector<Call*>& out) {
+        while (node.in_flight < window_ && !node.backlog.empty()) {
+            out.push_back(node.backlog.front().release());
+            node.backlog.pop_front();
+            ++node.in_flight;
+        }
+    }
 
-        auto it = stubs_.find(node_id);
-        if (it != stubs_.end()) {
-            return it->second.get();
+    // Start calls outside mu_; a started call belongs to the completion queue
+    void start(const std::vector<Call*>& calls) {
+        for (Call* call : calls) {
+            call->ctx.set_deadline(std::chrono::system_clock::now() + kCallTimeout);
+            call->start(*call->node->stub, cq_);
         }
+    }
 
-        // Look up the node's address from the registry
-        auto nodes = registry_.nodes();
-        std::string address;
-        for (const auto& n : nodes) {
-            if (n.node_id == node_id) {
-                address = n.address;
-                break;
+    void complete_loop() {
+        void* tag = nullptr;
+        bool ok = false;
+        std::vector<Call*> to_start;
+        while (cq_.Next(&tag, &ok)) {
+            std::unique_ptr<Call> call(static_cast<Call*>(tag));
+            Node& node = *call->node;
+            call->finish(node.node_id);
+
+            to_start.clear();
+            {
+                std::lock_guard<std::mutex> lock(mu_);
+                --node.in_flight;
+                take_startable_locked(node, to_start);
+                if (--outstanding_ == 0) idle_cv_.notify_all();
             }
+            start(to_start);
+        }
+    }
+
+    // Returns the node's channel state, creating it on first use.
+    // nullptr if the registry does not know the node. Caller holds mu_.
+    Node* node_locked(const std::string& node_id) {
+        auto it = nodes_.find(node_id);
+        if (it != nodes_.end()) {
+            return it->second.get();
         }
 
-        if (address.empty()) {
+        // Look up the node's address from the registry
+        const auto members = registry_.snapshot();
+        const NodeState* known = members->find(node_id);
+        if (!known) {
             std::cerr << "[GrpcNodeClient] Unknown node_id=" << node_id << "\n";
             return nullptr;
         }
 
-        auto channel = grpc::CreateChannel(address, grpc::InsecureChannelCredentials());
-        auto stub = orion::NodeService::NewStub(channel);
-        auto* ptr = stub.get();
-        stubs_[node_id] = std::move(stub);
+        auto node = std::make_unique<Node>();
+        node->node_id = node_id;
+        node->stub = orion::NodeService::NewStub(
+            grpc::CreateChannel(known->address, grpc::InsecureChannelCredentials()));
+        Node* ptr = node.get();
+        nodes_[node_id] = std::move(node);
         return ptr;
     }
 
     NodeRegistry& registry_;
-    std::unordered_map<std::string, std::unique_ptr<orion::NodeService::Stub>> stubs_;
+    const size_t window_;
+
+    // Nodes are never removed, so Call::node stays valid
+    std::unordered_map<std::string, std::unique_ptr<Node>> nodes_;
+    size_t outstanding_ = 0;
     std::mutex mu_;
+    std::condition_variable idle_cv_;
+
+    grpc::CompletionQueue cq_;
+    std::thread completer_;
+
+    static inline std::atomic<bool> verbose_{true};
 };
 
 } // namespace orion::distributed
@@ -9,6 +9,7 @@
 #pragma once
 
 #include <unordered_map>
+#include <vector>
 #include <string>
 #include <stdexcept>
 
@@ -28,7 +29,40 @@ namespace orion::distributed {
             if (it == nodes_.end() || it->second == nullptr) {
                 throw std::runtime_error("Unknown node_id: " + node_id);
             }
-            return it->second->local_runtime().submit(std::move(task));
+            // The node holds the output for the head until free_objects()
+            const orion::ObjectId task_id = task.id;
+            std::vector<orion::Task> tasks;
+            tasks.push_back(std::move(task));
+            it->second->admit(std::move(tasks));
+            return orion::ObjectRef{task_id};
+        }
+
+        void submit_tasks(const std::string& node_id, std::vector<orion::Task> tasks,
+                          DispatchDone done) override {
+            auto it = nodes_.find(node_id);
+            if (it == nodes_.end() || it->second == nullptr) {
+                throw std::runtime_error("Unknown node_id: " + node_id);
+            }
+            it->second->admit(std::move(tasks));
+            if (done) done(true, {});
+        }
+
+        void free_objects(const std::string& node_id,
+                          const std::vector<orion::ObjectId>& object_ids) override {
+            auto it = nodes_.find(node_id);
+            if (it == nodes_.end() || it->second == nullptr) return;
+            it->second->free_objects(object_ids);
+        }
+
+        void steal_tasks(const std::string& node_id,
+                         const std::vector<orion::ObjectId>& task_ids,
+                         StealDone done) override {
+            auto it = nodes_.find(node_id);
+            std::vector<orion::ObjectId> stolen;
+            if (it != nodes_.end() && it->second != nullptr) {
+                stolen = it->second->steal(task_ids);
+            }
+            if (done) done(std::move(stolen));
         }
 
     private:
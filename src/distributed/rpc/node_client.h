@@ -8,21 +8,74 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 #include <memory>
+#include <optional>
+#include <vector>
+#include <functional>
 
 #include "../../core/task.h"
 #include "../../core/object_ref.h"
 
 namespace orion::distributed {
 
+    // How the head and the nodes talk: gRPC (GrpcNodeClient / NodeServiceImpl)
+    // or raw TCP (TcpNodeClient / TcpNodeServer). A cluster uses one; the
+    // head and every node must be started with the same.
+    enum class Transport { Grpc, Tcp };
+
+    // "grpc" or "tcp"
+    inline std::optional<Transport> parse_transport(std::string_view name) {
+        if (name == "grpc") return Transport::Grpc;
+        if (name == "tcp") return Transport::Tcp;
+        return std::nullopt;
+    }
+
     // Abstract client: "send a task to a node"
     class NodeClient {
     public:
         virtual ~NodeClient() = default;
 
+        // Called once the node has taken a batch (true) or the call failed.
+        // `rejected` lists the tasks of a taken batch that the node will not
+        // run (e.g. their function is not registered there).
+        using DispatchDone = std::function<void(bool accepted,
+                                                std::vector<orion::ObjectId> rejected)>;
+        // Called with the tasks the node gave back (none if the call failed)
+        using StealDone = std::function<void(std::vector<orion::ObjectId> stolen)>;
+
         // Fire-and-forget execution request. Returns the ObjectRef of task output.
         virtual orion::ObjectRef submit_task(const std::string& node_id,
                                              orion::Task task) = 0;
+
+        // Send several tasks to one node. `done` runs with true once the
+        // node has taken the batch. Transports without a batch call send the
+        // tasks one by one.
+        virtual void submit_tasks(const std::string& node_id,
+                                  std::vector<orion::Task> tasks,
+                                  DispatchDone done = {}) {
+            for (auto& task : tasks) {
+                submit_task(node_id, std::move(task));
+            }
+            if (done) done(true, {});
+        }
+
+        // Block until every dispatch started so far has completed
+        virtual void flush() {}
+
+        // Tell a node the head no longer needs these objects. Transports
+        // without object lifetime support ignore it.
+        virtual void free_objects(const std::string& /*node_id*/,
+                                  const std::vector<orion::ObjectId>& /*object_ids*/) {}
+
+        // Ask a node to give back those of these tasks it has not started.
+        // Given-back tasks will not run there. Transports that cannot take
+        // tasks back give back none.
+        virtual void steal_tasks(const std::string& /*node_id*/,
+                                 const std::vector<orion::ObjectId>& /*task_ids*/,
+                                 StealDone done) {
+            if (done) done({});
+        }
     };
 
 } // namespace orion::distributed
@@ -0,0 +1,715 @@
+// tcp_connection.cpp — sockets and event loop of the raw TCP transport
+
+#include "tcp_connection.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#ifdef __linux__
+#include <sys/epoll.h>
+#endif
+
+namespace orion::distributed {
+
+    // iovecs per vectored write
+    static constexpr int kMaxIov = 64;
+    // Free room the read buffer keeps before each read
+    static constexpr size_t kReadChunk = 64 << 10;
+    // Longest the loop sleeps when no tick is due
+    static constexpr int kIdleWaitMs = 500;
+
+#ifdef MSG_NOSIGNAL
+    static constexpr int kSendFlags = MSG_NOSIGNAL;
+#else
+    static constexpr int kSendFlags = 0;   // SO_NOSIGPIPE is set on the socket instead
+#endif
+
+    // ── Sockets ──────────────────────────────────────────────────────────────
+
+    // IPv4 "host:port"; an empty host or 0.0.0.0 means any interface
+    static bool resolve(const std::string& address, sockaddr_in& out, std::string& error) {
+        const size_t colon = address.rfind(':');
+        if (colon == std::string::npos) {
+            error = "no port in '" + address + "'";
+            return false;
+        }
+        const std::string host = address.substr(0, colon);
+        const std::string port = address.substr(colon + 1);
+
+        addrinfo hints{};
+        hints.ai_family = AF_INET;
+        hints.ai_socktype = SOCK_STREAM;
+        hints.ai_flags = host.empty() ? AI_PASSIVE : 0;
+        addrinfo* found = nullptr;
+        const int rc = ::getaddrinfo(host.empty() ? nullptr : host.c_str(), port.c_str(),
+                                     &hints, &found);
+        if (rc != 0 || !found) {
+            error = "cannot resolve '" + address + "': " + ::gai_strerror(rc);
+            return false;
+        }
+        std::memcpy(&out, found->ai_addr, sizeof(out));
+        ::freeaddrinfo(found);
+        return true;
+    }
+
+    static void set_options(int fd, bool nonblocking) {
+        ::fcntl(fd, F_SETFD, FD_CLOEXEC);
+        if (nonblocking) ::fcntl(fd, F_SETFL, ::fcntl(fd, F_GETFL) | O_NONBLOCK);
+        const int one = 1;
+        // Frames are small and already batched; do not wait to coalesce them
+        ::setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+#ifdef SO_NOSIGPIPE
+        ::setsockopt(fd, SOL_SOCKET, SO_NOSIGPIPE, &one, sizeof(one));
+#endif
+    }
+
+    static bool would_block() {
+        return errno == EAGAIN || errno == EWOULDBLOCK;
+    }
+
+    // ── Poller ───────────────────────────────────────────────────────────────
+
+    // Errors and hang-ups are reported as readable: the read finds them
+    struct PollEvent {
+        int fd;
+        bool readable;
+        bool writable;
+    };
+
+    // Waits on sockets for the loop, and can be woken from other threads.
+    // add / set_write / remove may be called from any thread.
+    class Poller {
+    public:
+        Poller() {
+            if (::pipe(wake_) != 0) throw std::runtime_error("pipe failed");
+            for (int fd : wake_) set_options(fd, true);
+#ifdef __linux__
+            epoll_ = ::epoll_create1(EPOLL_CLOEXEC);
+            if (epoll_ < 0) throw std::runtime_error("epoll_create1 failed");
+#endif
+            add(wake_[0], false);
+        }
+
+        ~Poller() {
+#ifdef __linux__
+            ::close(epoll_);
+#endif
+            ::close(wake_[0]);
+            ::close(wake_[1]);
+        }
+
+        void wake() {
+            const char c = 0;
+            [[maybe_unused]] ssize_t n = ::write(wake_[1], &c, 1);   // full pipe: already woken
+        }
+
+#ifdef __linux__
+        void add(int fd, bool write) { control(EPOLL_CTL_ADD, fd, write); }
+        void set_write(int fd, bool write) { control(EPOLL_CTL_MOD, fd, write); }
+        void remove(int fd) { ::epoll_ctl(epoll_, EPOLL_CTL_DEL, fd, nullptr); }
+
+        void wait(int timeout_ms, std::vector<PollEvent>& out) {
+            epoll_event events[64];
+            const int n = ::epoll_wait(epoll_, events, 64, timeout_ms);
+            for (int i = 0; i < n; ++i) {
+                const uint32_t e = events[i].events;
+                if (events[i].data.fd == wake_[0]) {
+                    drain_wake();
+                    continue;
+                }
+                out.push_back({events[i].data.fd, bool(e & (EPOLLIN | EPOLLHUP | EPOLLERR)),
+                               bool(e & EPOLLOUT)});
+            }
+        }
+
+    private:
+        void control(int op, int fd, bool write) {
+            epoll_event ev{};
+            ev.events = EPOLLIN | (write ? EPOLLOUT : 0u);
+            ev.data.fd = fd;
+            ::epoll_ctl(epoll_, op, fd, &ev);
+        }
+
+        int epoll_ = -1;
+#else
+        // poll(2): the set is rebuilt on every wait, so changes wake the loop
+        void add(int fd, bool write) {
+            {
+                std::lock_guard<std::mutex> lock(mu_);
+                fds_[fd] = write;
+            }
+            wake();
+        }
+
+        void set_write(int fd, bool write) {
+            {
+                std::lock_guard<std::mutex> lock(mu_);
+                auto it = fds_.find(fd);
+                if (it == fds_.end()) return;
+                it->second = write;
+            }
+            wake();
+        }
+
+        void remove(int fd) {
+            std::lock_guard<std::mutex> lock(mu_);
+            fds_.erase(fd);
+        }
+
+        void wait(int timeout_ms, std::vector<PollEvent>& out) {
+            pfds_.clear();
+            {
+                std::lock_guard<std::mutex> lock(mu_);
+                for (const auto& [fd, write] : fds_) {
+                    pfds_.push_back({fd, short(POLLIN | (write ? POLLOUT : 0)), 0});
+                }
+            }
+            if (::poll(pfds_.data(), nfds_t(pfds_.size()), timeout_ms) <= 0) return;
+            for (const auto& p : pfds_) {
+                if (!p.revents) continue;
+                if (p.fd == wake_[0]) {
+                    drain_wake();
+                    continue;
+                }
+                out.push_back({p.fd, bool(p.revents & (POLLIN | POLLHUP | POLLERR)),
+                               bool(p.revents & POLLOUT)});
+            }
+        }
+
+    private:
+        std::unordered_map<int, bool> fds_;   // fd → wants POLLOUT
+        std::vector<pollfd> pfds_;            // loop thread only
+        std::mutex mu_;
+#endif
+        void drain_wake() {
+            char buf[64];
+            while (::read(wake_[0], buf, sizeof(buf)) > 0) {}
+        }
+
+        int wake_[2] = {-1, -1};
+    };
+
+    // ── TcpLoop ──────────────────────────────────────────────────────────────
+
+    TcpLoop::TcpLoop() : poller_(std::make_unique<Poller>()) {
+        running_ = true;
+        thread_ = std::thread(&TcpLoop::run, this);
+    }
+
+    TcpLoop::~TcpLoop() {
+        stop();
+    }
+
+    void TcpLoop::stop() {
+        if (!running_.exchange(false)) return;
+        poller_->wake();
+        thread_.join();
+
+        if (const int fd = listen_fd_.exchange(-1); fd >= 0) ::close(fd);
+        std::vector<std::shared_ptr<TcpConnection>> conns;
+        {
+            std::lock_guard<std::mutex> lock(mu_);
+            for (const auto& [fd, conn] : conns_) conns.push_back(conn);
+            closing_.clear();
+        }
+        for (const auto& conn : conns) {
+            conn->close();
+            finish(conn);
+        }
+    }
+
+    std::shared_ptr<TcpConnection> TcpLoop::connect(const std::string& address,
+                                                    FrameHandler on_frame,
+                                                    CloseHandler on_close) {
+        if (!running_) return nullptr;
+        sockaddr_in addr{};
+        std::string error;
+        if (!resolve(address, addr, error)) {
+            std::cerr << "[TcpLoop] " << error << "\n";
+            return nullptr;
+        }
+        const int fd = ::socket(AF_INET, SOCK_STREAM, 0);
+        if (fd < 0) {
+            std::cerr << "[TcpLoop] socket: " << std::strerror(errno) << "\n";
+            return nullptr;
+        }
+        set_options(fd, true);
+
+        bool connecting = false;
+        if (::connect(fd, reinterpret_cast<const sockaddr*>(&addr), sizeof(addr)) != 0) {
+            if (errno != EINPROGRESS) {
+                std::cerr << "[TcpLoop] connect to " << address << ": "
+                          << std::strerror(errno) << "\n";
+                ::close(fd);
+                return nullptr;
+            }
+            connecting = true;   // finished (or failed) once writable
+        }
+
+        std::shared_ptr<TcpConnection> conn(new TcpConnection(
+            *this, fd, address, connecting, std::move(on_frame), std::move(on_close)));
+        add(conn, connecting);
+        return conn;
+    }
+
+    int TcpLoop::listen(const std::string& address, FrameHandler on_frame,
+                        CloseHandler on_close) {
+        sockaddr_in addr{};
+        std::string error;
+        if (!resolve(address, addr, error)) {
+            std::cerr << "[TcpLoop] " << error << "\n";
+            return -1;
+        }
+        const int fd = ::socket(AF_INET, SOCK_STREAM, 0);
+        if (fd < 0) return -1;
+        const int one = 1;
+        ::setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+        if (::bind(fd, reinterpret_cast<const sockaddr*>(&addr), sizeof(addr)) != 0 ||
+            ::listen(fd, SOMAXCONN) != 0) {
+            std::cerr << "[TcpLoop] listen on " << address << ": "
+                      << std::strerror(errno) << "\n";
+            ::close(fd);
+            return -1;
+        }
+        set_options(fd, true);
+
+        socklen_t len = sizeof(addr);
+        ::getsockname(fd, reinterpret_cast<sockaddr*>(&addr), &len);
+        {
+            std::lock_guard<std::mutex> lock(mu_);
+            accept_frame_ = std::move(on_frame);
+            accept_close_ = std::move(on_close);
+            listen_fd_ = fd;
+        }
+        poller_->add(fd, false);
+        return ntohs(addr.sin_port);
+    }
+
+    void TcpLoop::every(std::chrono::milliseconds interval, Tick tick) {
+        {
+            std::lock_guard<std::mutex> lock(mu_);
+            tick_interval_ = std::max(interval, std::chrono::milliseconds(1));
+            tick_ = std::move(tick);
+        }
+        poller_->wake();
+    }
+
+    void TcpLoop::add(const std::shared_ptr<TcpConnection>& conn, bool want_write) {
+        {
+            std::lock_guard<std::mutex> lock(mu_);
+            conns_[conn->fd_] = conn;
+        }
+        poller_->add(conn->fd_, want_write);
+    }
+
+    void TcpLoop::closing(std::weak_ptr<TcpConnection> conn) {
+        {
+            std::lock_guard<std::mutex> lock(mu_);
+            closing_.push_back(std::move(conn));
+        }
+        poller_->wake();
+    }
+
+    void TcpLoop::set_want_write(int fd, bool want) {
+        poller_->set_write(fd, want);
+    }
+
+    void TcpLoop::run() {
+        std::vector<PollEvent> events;
+        std::vector<std::weak_ptr<TcpConnection>> closing;
+        auto next_tick = std::chrono::steady_clock::now();
+
+        while (running_) {
+            Tick tick;
+            int wait_ms = kIdleWaitMs;
+            {
+                std::lock_guard<std::mutex> lock(mu_);
+                if (tick_) {
+                    const auto now = std::chrono::steady_clock::now();
+                    if (now >= next_tick) {
+                        tick = tick_;
+                        next_tick = now + tick_interval_;
+                    }
+                    wait_ms = int(std::clamp<int64_t>(
+                        std::chrono::duration_cast<std::chrono::milliseconds>(next_tick - now).count(),
+                        0, kIdleWaitMs));
+                }
+            }
+            if (tick) tick();
+
+            events.clear();
+            poller_->wait(wait_ms, events);
+            for (const auto& ev : events) {
+                if (ev.fd == listen_fd_) {
+                    accept_all();
+                    continue;
+                }
+                std::shared_ptr<TcpConnection> conn;
+                {
+                    std::lock_guard<std::mutex> lock(mu_);
+                    auto it = conns_.find(ev.fd);
+                    if (it != conns_.end()) conn = it->second;
+                }
+                if (!conn) continue;
+                if (ev.writable) write_to(*conn);
+                if (ev.readable && !conn->closed()) read_from(*conn);
+                if (conn->closed()) finish(conn);
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(mu_);
+                closing.swap(closing_);
+            }
+            for (const auto& weak : closing) {
+                if (auto conn = weak.lock()) finish(conn);
+            }
+            closing.clear();
+        }
+    }
+
+    void TcpLoop::accept_all() {
+        while (true) {
+            sockaddr_in addr{};
+            socklen_t len = sizeof(addr);
+            const int fd = ::accept(listen_fd_, reinterpret_cast<sockaddr*>(&addr), &len);
+            if (fd < 0) {
+                if (errno == EINTR) continue;
+                if (!would_block()) {
+                    std::cerr << "[TcpLoop] accept: " << std::strerror(errno) << "\n";
+                }
+                return;
+            }
+            set_options(fd, true);
+
+            char host[INET_ADDRSTRLEN] = {};
+            ::inet_ntop(AF_INET, &addr.sin_addr, host, sizeof(host));
+            FrameHandler on_frame;
+            CloseHandler on_close;
+            {
+                std::lock_guard<std::mutex> lock(mu_);
+                on_frame = accept_frame_;
+                on_close = accept_close_;
+            }
+            std::shared_ptr<TcpConnection> conn(new TcpConnection(
+                *this, fd, std::string(host) + ":" + std::to_string(ntohs(addr.sin_port)),
+                false, std::move(on_frame), std::move(on_close)));
+            add(conn, false);
+        }
+    }
+
+    void TcpLoop::read_from(TcpConnection& conn) {
+        auto& in = conn.in_;
+        while (!conn.closed()) {
+            if (in.size() - conn.in_size_ < kReadChunk) in.resize(conn.in_size_ + kReadChunk);
+            const ssize_t n = ::recv(conn.fd_, in.data() + conn.in_size_,
+                                     in.size() - conn.in_size_, 0);
+            if (n == 0) {
+                conn.close();
+                return;
+            }
+            if (n < 0) {
+                if (errno == EINTR) continue;
+                if (!would_block()) conn.close();
+                return;
+            }
+            conn.in_size_ += size_t(n);
+
+            // Hand out every whole frame
+            size_t pos = 0;
+            size_t need = 0;   // bytes of the first incomplete frame
+            while (conn.in_size_ - pos >= sizeof(FrameHeader)) {
+                FrameHeader header;
+                std::memcpy(&header, in.data() + pos, sizeof(header));
+                if (header.length > kMaxFrameBytes) {
+                    std::cerr << "[TcpLoop] " << header.length << "-byte frame from "
+                              << conn.peer_ << "; closing\n";
+                    conn.close();
+                    return;
+                }
+                const size_t frame = sizeof(FrameHeader) + size_t(header.length);
+                if (conn.in_size_ - pos < frame) {
+                    need = frame;
+                    break;
+                }
+                conn.on_frame_(conn, header,
+                               std::string_view(in.data() + pos + sizeof(FrameHeader),
+                                                size_t(header.length)));
+                pos += frame;
+                if (conn.closed()) return;
+            }
+            if (pos > 0) {
+                std::memmove(in.data(), in.data() + pos, conn.in_size_ - pos);
+                conn.in_size_ -= pos;
+            }
+            // Room for all of a large frame at once; give the room back after
+            if (need > in.size()) {
+                in.resize(need);
+            } else if (in.size() > 4 * kReadChunk && conn.in_size_ < kReadChunk) {
+                in.resize(kReadChunk);
+                in.shrink_to_fit();
+            }
+        }
+    }
+
+    void TcpLoop::write_to(TcpConnection& conn) {
+        std::lock_guard<std::mutex> lock(conn.out_mu_);
+        if (conn.closed()) return;
+        if (conn.connecting_) {
+            int err = 0;
+            socklen_t len = sizeof(err);
+            ::getsockopt(conn.fd_, SOL_SOCKET, SO_ERROR, &err, &len);
+            if (err != 0) {
+                std::cerr << "[TcpLoop] connect to " << conn.peer_ << ": "
+                          << std::strerror(err) << "\n";
+                conn.close_locked_();
+                return;
+            }
+            conn.connecting_ = false;
+        }
+        if (!conn.flush_locked_()) {
+            conn.close_locked_();
+            return;
+        }
+        if (conn.out_.empty()) {
+            conn.want_write_ = false;
+            set_want_write(conn.fd_, false);
+            conn.drained_cv_.notify_all();
+        } else if (!conn.want_write_) {
+            conn.want_write_ = true;
+            set_want_write(conn.fd_, true);
+        }
+    }
+
+    void TcpLoop::finish(const std::shared_ptr<TcpConnection>& conn) {
+        {
+            std::lock_guard<std::mutex> lock(mu_);
+            auto it = conns_.find(conn->fd_);
+            if (it == conns_.end() || it->second != conn) return;   // already finished
+            conns_.erase(it);
+        }
+        poller_->remove(conn->fd_);
+        {
+            // From here no sender touches the socket
+            std::lock_guard<std::mutex> lock(conn->out_mu_);
+            conn->closed_ = true;
+            conn->out_.clear();
+        }
+        conn->drained_cv_.notify_all();
+        ::close(conn->fd_);
+        if (conn->on_close_) conn->on_close_(*conn);
+    }
+
+    // ── TcpConnection ────────────────────────────────────────────────────────
+
+    TcpConnection::TcpConnection(TcpLoop& loop, int fd, std::string peer, bool connecting,
+                                 TcpLoop::FrameHandler on_frame, TcpLoop::CloseHandler on_close)
+        : loop_(loop),
+          fd_(fd),
+          peer_(std::move(peer)),
+          on_frame_(std::move(on_frame)),
+          on_close_(std::move(on_close)),
+          connecting_(connecting) {}
+
+    bool TcpConnection::send(FrameType type, uint32_t request_id, std::string payload,
+                             FrameStatus status) {
+        return enqueue(type, request_id, status, std::move(payload), {}, nullptr);
+    }
+
+    bool TcpConnection::send(FrameType type, uint32_t request_id, std::string prefix,
+                             std::string_view body, std::shared_ptr<const void> owner) {
+        return enqueue(type, request_id, FrameStatus::Ok, std::move(prefix), body,
+                       std::move(owner));
+    }
+
+    bool TcpConnection::enqueue(FrameType type, uint32_t request_id, FrameStatus status,
+                                std::string prefix, std::string_view body,
+                                std::shared_ptr<const void> owner) {
+        Outgoing out;
+        const FrameHeader header{prefix.size() + body.size(), request_id, type, status};
+        std::memcpy(out.header, &header, sizeof(header));
+        out.prefix = std::move(prefix);
+        out.body = body;
+        out.owner = std::move(owner);
+
+        std::lock_guard<std::mutex> lock(out_mu_);
+        if (closed()) return false;
+        out_.push_back(std::move(out));
+        // Behind a pending connect or earlier frames: the loop writes it
+        if (connecting_ || want_write_) return true;
+
+        if (!flush_locked_()) {
+            close_locked_();
+            return false;
+        }
+        if (!out_.empty()) {
+            want_write_ = true;
+            loop_.set_want_write(fd_, true);
+        }
+        return true;
+    }
+
+    int TcpConnection::Outgoing::unwritten(iovec* out, int room) const {
+        int n = 0;
+        size_t skip = written;
+        auto add = [&](const char* p, size_t len) {
+            if (skip >= len) {
+                skip -= len;
+                return;
+            }
+            if (n < room) {
+                out[n].iov_base = const_cast<char*>(p + skip);
+                out[n].iov_len = len - skip;
+                ++n;
+            }
+            skip = 0;
+        };
+        add(header, sizeof(header));
+        add(prefix.data(), prefix.size());
+        add(body.data(), body.size());
+        return n;
+    }
+
+    bool TcpConnection::flush_locked_() {
+        iovec iov[kMaxIov];
+        while (!out_.empty()) {
+            // Every queued frame that fits goes out in one call
+            int n = 0;
+            for (const auto& out : out_) {
+                if (kMaxIov - n < 3) break;
+                n += out.unwritten(iov + n, kMaxIov - n);
+            }
+
+            msghdr msg{};
+            msg.msg_iov = iov;
+            msg.msg_iovlen = n;
+            const ssize_t sent = ::sendmsg(fd_, &msg, kSendFlags);
+            if (sent < 0) {
+                if (errno == EINTR) continue;
+                return would_block();
+            }
+
+            size_t left = size_t(sent);
+            while (left > 0) {
+                Outgoing& front = out_.front();
+                const size_t rest = front.size() - front.written;
+                if (left < rest) {
+                    front.written += left;
+                    break;
+                }
+                left -= rest;
+                out_.pop_front();
+            }
+        }
+        return true;
+    }
+
+    void TcpConnection::close() {
+        std::lock_guard<std::mutex> lock(out_mu_);
+        close_locked_();
+    }
+
+    void TcpConnection::close_locked_() {
+        if (closed_.exchange(true)) return;
+        out_.clear();
+        drained_cv_.notify_all();
+        loop_.closing(weak_from_this());
+    }
+
+    bool TcpConnection::drain() {
+        std::unique_lock<std::mutex> lock(out_mu_);
+        drained_cv_.wait(lock, [&] { return closed() || out_.empty(); });
+        return !closed();
+    }
+
+    // ── Blocking helpers ─────────────────────────────────────────────────────
+
+    int tcp_connect(const std::string& address, std::chrono::milliseconds timeout,
+                    std::string& error) {
+        sockaddr_in addr{};
+        if (!resolve(address, addr, error)) return -1;
+        const int fd = ::socket(AF_INET, SOCK_STREAM, 0);
+        if (fd < 0) {
+            error = std::string("socket: ") + std::strerror(errno);
+            return -1;
+        }
+        set_options(fd, false);
+        timeval tv{};
+        tv.tv_sec = time_t(timeout.count() / 1000);
+        tv.tv_usec = suseconds_t((timeout.count() % 1000) * 1000);
+        ::setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+        ::setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &tv, sizeof(tv));
+
+        if (::connect(fd, reinterpret_cast<const sockaddr*>(&addr), sizeof(addr)) != 0) {
+            error = "connect to " + address + ": " + std::strerror(errno);
+            ::close(fd);
+            return -1;
+        }
+        return fd;
+    }
+
+    bool tcp_send_frame(int fd, const FrameHeader& header,
+                        std::initializer_list<std::string_view> parts) {
+        iovec iov[8];
+        int n = 0;
+        iov[n++] = {const_cast<FrameHeader*>(&header), sizeof(header)};
+        for (std::string_view part : parts) {
+            if (n == 8) return false;
+            iov[n++] = {const_cast<char*>(part.data()), part.size()};
+        }
+
+        int first = 0;
+        while (first < n) {
+            msghdr msg{};
+            msg.msg_iov = iov + first;
+            msg.msg_iovlen = n - first;
+            ssize_t sent = ::sendmsg(fd, &msg, kSendFlags);
+            if (sent < 0) {
+                if (errno == EINTR) continue;
+                return false;
+            }
+            while (first < n && size_t(sent) >= iov[first].iov_len) {
+                sent -= ssize_t(iov[first].iov_len);
+                ++first;
+            }
+            if (first < n) {
+                iov[first].iov_base = static_cast<char*>(iov[first].iov_base) + sent;
+                iov[first].iov_len -= size_t(sent);
+            }
+        }
+        return true;
+    }
+
+    bool tcp_read_exact(int fd, void* dst, size_t n) {
+        char* p = static_cast<char*>(dst);
+        while (n > 0) {
+            const ssize_t got = ::recv(fd, p, n, 0);
+            if (got < 0 && errno == EINTR) continue;
+            if (got <= 0) return false;
+            p += got;
+            n -= size_t(got);
+        }
+        return true;
+    }
+
+    void tcp_close(int fd) {
+        if (fd >= 0) ::close(fd);
+    }
+
+    void tcp_abort(int fd) {
+        if (fd >= 0) ::shutdown(fd, SHUT_RDWR);
+    }
+
+} // namespace orion::distributed
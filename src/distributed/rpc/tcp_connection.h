@@ -0,0 +1,194 @@
+// tcp_connection.h — sockets and event loop of the raw TCP transport
+//
+// A TcpLoop owns one thread that waits on all of its sockets (epoll on
+// Linux, poll elsewhere) and reads whole frames (tcp_wire.h) off them; each
+// frame goes to its connection's handler, on that thread. Sending may happen
+// from any thread: TcpConnection::send queues the frame and at once writes
+// as much as the socket takes, with one vectored write covering the header,
+// the payload and any frames queued before it. The loop writes the rest as
+// the socket drains.
+//
+// A payload can be sent from where it already lives (a `body` view plus an
+// owner that keeps it alive until written), which is how stored objects go
+// out without being copied.
+//
+// The blocking helpers at the bottom are for callers that own a socket
+// outright: ObjectFetcher reads object payloads with them straight into the
+// buffer the object will live in.
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "tcp_wire.h"
+
+struct iovec;
+
+namespace orion::distributed {
+
+    class TcpConnection;
+    class Poller;
+
+    class TcpLoop {
+    public:
+        using FrameHandler = std::function<void(TcpConnection&, const FrameHeader&,
+                                                std::string_view payload)>;
+        using CloseHandler = std::function<void(TcpConnection&)>;
+        using Tick = std::function<void()>;
+
+        TcpLoop();
+        // stop()
+        ~TcpLoop();
+
+        TcpLoop(const TcpLoop&) = delete;
+        TcpLoop& operator=(const TcpLoop&) = delete;
+
+        // Start connecting to "host:port" without waiting for it; frames sent
+        // meanwhile are queued. nullptr if the address does not resolve or
+        // the connect fails at once.
+        std::shared_ptr<TcpConnection> connect(const std::string& address,
+                                               FrameHandler on_frame,
+                                               CloseHandler on_close = {});
+
+        // Accept connections on "host:port" (port 0 picks a free one).
+        // Returns the bound port, or -1. One listener per loop.
+        int listen(const std::string& address, FrameHandler on_frame,
+                   CloseHandler on_close = {});
+
+        // Run `tick` on the loop thread about every `interval`
+        void every(std::chrono::milliseconds interval, Tick tick);
+
+        // Stops the thread and closes every connection; their close handlers
+        // run on the calling thread. Idempotent.
+        void stop();
+
+    private:
+        friend class TcpConnection;
+
+        void run();
+        void add(const std::shared_ptr<TcpConnection>& conn, bool want_write);
+        void accept_all();
+        void read_from(TcpConnection& conn);
+        void write_to(TcpConnection& conn);
+        // Drop a closed connection and run its close handler (loop thread,
+        // or the stopping thread once the loop is gone)
+        void finish(const std::shared_ptr<TcpConnection>& conn);
+        // A connection closed from another thread: finish it on the loop
+        void closing(std::weak_ptr<TcpConnection> conn);
+        void set_want_write(int fd, bool want);
+
+        std::unique_ptr<Poller> poller_;
+        std::atomic<int> listen_fd_{-1};
+        FrameHandler accept_frame_;
+        CloseHandler accept_close_;
+
+        std::unordered_map<int, std::shared_ptr<TcpConnection>> conns_;
+        std::vector<std::weak_ptr<TcpConnection>> closing_;
+        std::mutex mu_;   // conns_, closing_, the listener's handlers, the tick
+
+        std::chrono::milliseconds tick_interval_{0};
+        Tick tick_;
+
+        std::atomic<bool> running_{false};
+        std::thread thread_;
+    };
+
+    class TcpConnection : public std::enable_shared_from_this<TcpConnection> {
+    public:
+        TcpConnection(const TcpConnection&) = delete;
+        TcpConnection& operator=(const TcpConnection&) = delete;
+
+        // Queue a frame with `payload`; false if the connection is closed
+        bool send(FrameType type, uint32_t request_id, std::string payload,
+                  FrameStatus status = FrameStatus::Ok);
+
+        // Queue a frame whose payload is `prefix` then `body`, written from
+        // where `body` lives; `owner` keeps it alive until then
+        bool send(FrameType type, uint32_t request_id, std::string prefix,
+                  std::string_view body, std::shared_ptr<const void> owner);
+
+        // From any thread. Queued frames are dropped; the close handler runs
+        // on the loop thread.
+        void close();
+        bool closed() const { return closed_.load(std::memory_order_acquire); }
+
+        // Block until everything queued so far is written (true) or the
+        // connection closes (false)
+        bool drain();
+
+        // "host:port" as given to connect(), or the accepted peer
+        const std::string& peer() const { return peer_; }
+
+    private:
+        friend class TcpLoop;
+
+        TcpConnection(TcpLoop& loop, int fd, std::string peer, bool connecting,
+                      TcpLoop::FrameHandler on_frame, TcpLoop::CloseHandler on_close);
+
+        struct Outgoing {
+            char header[sizeof(FrameHeader)];
+            std::string prefix;
+            std::string_view body;
+            std::shared_ptr<const void> owner;
+            size_t written = 0;
+
+            size_t size() const { return sizeof(header) + prefix.size() + body.size(); }
+            // Unwritten parts as iovecs; returns how many were added
+            int unwritten(iovec* out, int room) const;
+        };
+
+        bool enqueue(FrameType type, uint32_t request_id, FrameStatus status,
+                     std::string prefix, std::string_view body,
+                     std::shared_ptr<const void> owner);
+        // Write what the socket takes now. False on a socket error. Caller
+        // holds out_mu_.
+        bool flush_locked_();
+        // Mark closed and wake the loop. Caller holds out_mu_.
+        void close_locked_();
+
+        TcpLoop& loop_;
+        const int fd_;
+        const std::string peer_;
+        const TcpLoop::FrameHandler on_frame_;
+        const TcpLoop::CloseHandler on_close_;
+
+        std::deque<Outgoing> out_;
+        bool connecting_;
+        bool want_write_ = false;
+        std::atomic<bool> closed_{false};
+        std::mutex out_mu_;
+        std::condition_variable drained_cv_;
+
+        // Loop thread only: bytes read but not yet handled
+        std::vector<char> in_;
+        size_t in_size_ = 0;
+    };
+
+    // ── Blocking helpers ─────────────────────────────────────────────────────
+
+    // Connect to "host:port" and wait for it. Returns the socket, or -1 with
+    // `error` filled. Reads give up after `timeout` without data.
+    int tcp_connect(const std::string& address, std::chrono::milliseconds timeout,
+                    std::string& error);
+    // Write a whole frame (header, then `parts` in order)
+    bool tcp_send_frame(int fd, const FrameHeader& header,
+                        std::initializer_list<std::string_view> parts);
+    // Read exactly `n` bytes into `dst`
+    bool tcp_read_exact(int fd, void* dst, size_t n);
+    void tcp_close(int fd);
+    // Make reads and writes on `fd` fail at once, from another thread
+    void tcp_abort(int fd);
+
+} // namespace orion::distributed
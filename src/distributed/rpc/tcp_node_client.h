@@ -0,0 +1,381 @@
+//
+// TcpNodeClient — head-side NodeClient over the raw TCP transport
+// (tcp_wire.h); TcpNodeServer is the node end.
+//
+// One connection per node, opened on first use and again after it breaks.
+// Calls are pipelined with no window: a frame is written from the calling
+// thread as far as the socket takes it, so dispatching a batch costs one
+// vectored write and no thread hop. Replies come back on the TcpLoop thread,
+// which runs the callbacks, as GrpcNodeClient's completion thread does. A
+// batch (submit_tasks) is one ExecuteTasks frame; FreeObjects frames get no
+// reply.
+//
+// Nodes send their created / freed reports up the same connection;
+// set_report_handlers() says where they go (the ClusterScheduler, on the
+// head).
+//
+// A call fails when its connection does. A connection that has calls
+// outstanding but receives nothing for kCallTimeout is closed, much as a
+// GrpcNodeClient call times out.
+//
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "node_client.h"
+#include "tcp_connection.h"
+#include "../cluster/node_registry.h"
+
+namespace orion::distributed {
+
+class TcpNodeClient : public NodeClient {
+public:
+    static constexpr auto kCallTimeout = std::chrono::seconds(30);
+
+    using CreatedHandler = std::function<void(const std::string& node_id,
+                                              const std::vector<orion::ObjectId>& object_ids,
+                                              const std::vector<uint64_t>& sizes)>;
+    using FreedHandler = std::function<void(const std::string& node_id,
+                                            const std::vector<orion::ObjectId>& object_ids)>;
+
+    explicit TcpNodeClient(NodeRegistry& registry) : registry_(registry) {
+        loop_.every(std::chrono::seconds(1), [this] { expire(); });
+    }
+
+    // Waits for every outstanding call
+    ~TcpNodeClient() override {
+        flush();
+        loop_.stop();
+    }
+
+    TcpNodeClient(const TcpNodeClient&) = delete;
+    TcpNodeClient& operator=(const TcpNodeClient&) = delete;
+
+    // Where node reports go; they are dropped until this is set. Handlers
+    // run on the loop thread.
+    void set_report_handlers(CreatedHandler on_created, FreedHandler on_freed) {
+        std::lock_guard<std::mutex> lock(mu_);
+        on_created_ = std::move(on_created);
+        on_freed_ = std::move(on_freed);
+    }
+
+    orion::ObjectRef submit_task(const std::string& node_id, orion::Task task) override {
+        const orion::ObjectId task_id = task.id;
+        std::vector<orion::Task> tasks;
+        tasks.push_back(std::move(task));
+        submit_tasks(node_id, std::move(tasks), {});
+        return orion::ObjectRef{task_id};
+    }
+
+    // All tasks travel in one ExecuteTasks frame
+    void submit_tasks(const std::string& node_id, std::vector<orion::Task> tasks,
+                      DispatchDone done) override
+    {
+        std::string payload;
+        WireWriter out(payload);
+        out.u32(uint32_t(tasks.size()));
+        for (auto& task : tasks) out.task(task);
+
+        Pending pending;
+        pending.type = FrameType::ExecuteTasks;
+        pending.tasks = tasks.size();
+        pending.dispatch_done = std::move(done);
+        call(node_id, std::move(payload), std::move(pending));
+    }
+
+    void free_objects(const std::string& node_id,
+                      const std::vector<orion::ObjectId>& object_ids) override
+    {
+        std::string payload;
+        WireWriter(payload).ids(object_ids);
+
+        std::shared_ptr<TcpConnection> conn;
+        {
+            std::lock_guard<std::mutex> lock(mu_);
+            if (Node* node = node_locked(node_id)) conn = node->conn;
+        }
+        if (!conn || !conn->send(FrameType::FreeObjects, 0, std::move(payload))) {
+            std::cerr << "[TcpNodeClient] FreeObjects FAILED on " << node_id << "\n";
+        }
+    }
+
+    void steal_tasks(const std::string& node_id,
+                     const std::vector<orion::ObjectId>& task_ids,
+                     StealDone done) override
+    {
+        std::string payload;
+        WireWriter(payload).ids(task_ids);
+
+        Pending pending;
+        pending.type = FrameType::StealTasks;
+        pending.steal_done = std::move(done);
+        call(node_id, std::move(payload), std::move(pending));
+    }
+
+    // Block until every call made so far has been answered (or failed) and
+    // every frame sent so far is written
+    void flush() override {
+        std::vector<std::shared_ptr<TcpConnection>> conns;
+        {
+            std::unique_lock<std::mutex> lock(mu_);
+            idle_cv_.wait(lock, [&] { return outstanding_ == 0; });
+            for (const auto& [node_id, node] : nodes_) conns.push_back(node->conn);
+        }
+        for (const auto& conn : conns) conn->drain();
+    }
+
+    // Calls sent and not yet answered, over all nodes
+    size_t outstanding() {
+        std::lock_guard<std::mutex> lock(mu_);
+        return outstanding_;
+    }
+
+    // Log every accepted batch (on by default)
+    static void set_verbose(bool verbose) {
+        verbose_.store(verbose, std::memory_order_relaxed);
+    }
+
+private:
+    // A call waiting for its reply
+    struct Pending {
+        FrameType type{};
+        size_t tasks = 0;
+        DispatchDone dispatch_done;
+        StealDone steal_done;
+    };
+
+    struct Node {
+        std::string node_id;
+        std::shared_ptr<TcpConnection> conn;
+        std::unordered_map<uint32_t, Pending> pending;   // by request id
+        std::chrono::steady_clock::time_point last_heard;
+    };
+
+    // Send a request and remember it until its reply. A call to a node that
+    // cannot be reached fails at once, so its callback still runs.
+    void call(const std::string& node_id, std::string payload, Pending pending) {
+        const FrameType type = pending.type;
+        std::shared_ptr<TcpConnection> conn;
+        uint32_t request_id = 0;
+        {
+            std::lock_guard<std::mutex> lock(mu_);
+            if (Node* node = node_locked(node_id)) {
+                request_id = next_request_id_++;
+                if (request_id == 0) request_id = next_request_id_++;   // 0: no reply
+                if (node->pending.empty()) node->last_heard = std::chrono::steady_clock::now();
+                node->pending.emplace(request_id, std::move(pending));
+                ++outstanding_;
+                conn = node->conn;
+            }
+        }
+        if (!conn) {
+            fail(node_id, pending, "unknown node");
+            return;
+        }
+        // If the connection is closed, its close handler fails the call
+        conn->send(type, request_id, std::move(payload));
+    }
+
+    void on_frame(const std::string& node_id, TcpConnection& conn,
+                  const FrameHeader& header, std::string_view payload) {
+        WireReader in(payload);
+        switch (header.type) {
+            case FrameType::ObjectsCreated: {
+                const auto ids = in.ids();
+                const auto sizes = in.u64s();
+                CreatedHandler handler;
+                if (heard_from(node_id, conn)) {
+                    std::lock_guard<std::mutex> lock(mu_);
+                    handler = on_created_;
+                }
+                if (!in.done()) {
+                    std::cerr << "[TcpNodeClient] Malformed ObjectsCreated from " << node_id << "\n";
+                } else if (handler) {
+                    handler(node_id, ids, sizes);
+                }
+                return;
+            }
+
+            case FrameType::ObjectsFreed: {
+                const auto ids = in.ids();
+                FreedHandler handler;
+                if (heard_from(node_id, conn)) {
+                    std::lock_guard<std::mutex> lock(mu_);
+                    handler = on_freed_;
+                }
+                if (!in.done()) {
+                    std::cerr << "[TcpNodeClient] Malformed ObjectsFreed from " << node_id << "\n";
+                } else if (handler) {
+                    handler(node_id, ids);
+                }
+                return;
+            }
+
+            default:
+                break;
+        }
+
+        // A reply: finish its call
+        Pending pending;
+        {
+            std::lock_guard<std::mutex> lock(mu_);
+            auto node_it = nodes_.find(node_id);
+            if (node_it == nodes_.end() || node_it->second->conn.get() != &conn) return;
+            Node& node = *node_it->second;
+            node.last_heard = std::chrono::steady_clock::now();
+            auto it = node.pending.find(header.request_id);
+            if (it == node.pending.end()) {
+                std::cerr << "[TcpNodeClient] Unexpected reply from " << node_id << "\n";
+                return;
+            }
+            pending = std::move(it->second);
+            node.pending.erase(it);
+        }
+
+        if (header.status != FrameStatus::Ok) {
+            fail(node_id, pending, std::string(payload));
+        } else if (pending.type == FrameType::ExecuteTasks) {
+            auto rejected = in.ids();
+            if (!in.ok()) rejected.clear();
+            if (verbose_.load(std::memory_order_relaxed)) {
+                std::cout << "[TcpNodeClient] ExecuteTasks(" << pending.tasks
+                          << " tasks) accepted by " << node_id << "\n" << std::flush;
+            }
+            for (const auto& id : rejected) {
+                std::cerr << "[TcpNodeClient] Task " << id << " rejected by " << node_id << "\n";
+            }
+            if (pending.dispatch_done) pending.dispatch_done(true, std::move(rejected));
+        } else if (pending.type == FrameType::StealTasks) {
+            auto stolen = in.ids();
+            if (!in.ok()) stolen.clear();
+            if (pending.steal_done) pending.steal_done(std::move(stolen));
+        }
+
+        std::lock_guard<std::mutex> lock(mu_);
+        if (--outstanding_ == 0) idle_cv_.notify_all();
+    }
+
+    // Fail every call still waiting on a connection that closed; the next
+    // call to the node opens a new one
+    void on_close(const std::string& node_id, TcpConnection& conn) {
+        std::vector<Pending> failed;
+        {
+            std::lock_guard<std::mutex> lock(mu_);
+            auto it = nodes_.find(node_id);
+            if (it == nodes_.end() || it->second->conn.get() != &conn) return;
+            for (auto& [request_id, pending] : it->second->pending) {
+                failed.push_back(std::move(pending));
+            }
+            nodes_.erase(it);
+        }
+        if (!failed.empty()) {
+            std::cerr << "[TcpNodeClient] Connection to " << node_id << " lost with "
+                      << failed.size() << " calls outstanding\n";
+        }
+        for (auto& pending : failed) fail(node_id, pending, "connection lost");
+
+        std::lock_guard<std::mutex> lock(mu_);
+        outstanding_ -= failed.size();
+        if (outstanding_ == 0) idle_cv_.notify_all();
+    }
+
+    // Run a failed call's callback
+    static void fail(const std::string& node_id, Pending& pending, const std::string& reason) {
+        if (pending.type == FrameType::ExecuteTasks) {
+            std::cerr << "[TcpNodeClient] ExecuteTasks FAILED on " << node_id << " ("
+                      << pending.tasks << " tasks): " << reason << "\n";
+            if (pending.dispatch_done) pending.dispatch_done(false, {});
+        } else {
+            std::cerr << "[TcpNodeClient] StealTasks FAILED on " << node_id
+                      << ": " << reason << "\n";
+            if (pending.steal_done) pending.steal_done({});
+        }
+    }
+
+    // A report counts as hearing from the node. False if `conn` is no
+    // longer the node's connection.
+    bool heard_from(const std::string& node_id, TcpConnection& conn) {
+        std::lock_guard<std::mutex> lock(mu_);
+        auto it = nodes_.find(node_id);
+        if (it == nodes_.end() || it->second->conn.get() != &conn) return false;
+        it->second->last_heard = std::chrono::steady_clock::now();
+        return true;
+    }
+
+    // Close connections whose calls have gone unanswered for kCallTimeout
+    // (loop thread, every second)
+    void expire() {
+        std::vector<std::shared_ptr<TcpConnection>> stale;
+        {
+            std::lock_guard<std::mutex> lock(mu_);
+            const auto now = std::chrono::steady_clock::now();
+            for (const auto& [node_id, node] : nodes_) {
+                if (!node->pending.empty() && now - node->last_heard > kCallTimeout) {
+                    std::cerr << "[TcpNodeClient] " << node_id << " silent for "
+                              << std::chrono::duration_cast<std::chrono::seconds>(kCallTimeout).count()
+                              << "s with calls outstanding; closing\n";
+                    stale.push_back(node->conn);
+                }
+            }
+        }
+        for (const auto& conn : stale) conn->close();
+    }
+
+    // Returns the node's connection state, connecting on first use. nullptr
+    // if the registry does not know the node or the connect fails at once.
+    // Caller holds mu_.
+    Node* node_locked(const std::string& node_id) {
+        auto it = nodes_.find(node_id);
+        if (it != nodes_.end()) {
+            return it->second.get();
+        }
+
+        const auto members = registry_.snapshot();
+        const NodeState* known = members->find(node_id);
+        if (!known) {
+            std::cerr << "[TcpNodeClient] Unknown node_id=" << node_id << "\n";
+            return nullptr;
+        }
+
+        auto conn = loop_.connect(
+            known->address,
+            [this, node_id](TcpConnection& c, const FrameHeader& header, std::string_view payload) {
+                on_frame(node_id, c, header, payload);
+            },
+            [this, node_id](TcpConnection& c) { on_close(node_id, c); });
+        if (!conn) return nullptr;
+
+        auto node = std::make_unique<Node>();
+        node->node_id = node_id;
+        node->conn = std::move(conn);
+        Node* ptr = node.get();
+        nodes_[node_id] = std::move(node);
+        return ptr;
+    }
+
+    NodeRegistry& registry_;
+
+    std::unordered_map<std::string, std::unique_ptr<Node>> nodes_;
+    uint32_t next_request_id_ = 1;
+    size_t outstanding_ = 0;
+    CreatedHandler on_created_;
+    FreedHandler on_freed_;
+    std::mutex mu_;
+    std::condition_variable idle_cv_;
+
+    TcpLoop loop_;   // last: stopped before the members its handlers use go
+
+    static inline std::atomic<bool> verbose_{true};
+};
+
+} // namespace orion::distributed
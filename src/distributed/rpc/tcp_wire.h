@@ -0,0 +1,199 @@
+// tcp_wire.h — frames of the raw TCP transport (TcpNodeClient / TcpNodeServer)
+//
+// Every message is a 16-byte FrameHeader followed by `length` payload bytes.
+// A request that wants an answer carries a nonzero request_id; the answer
+// echoes it, so requests on one connection can be pipelined and answered in
+// any order. Payloads are packed little-endian integers and length-prefixed
+// byte strings (WireWriter / WireReader), with no schema or field tags: both
+// ends are built from the same tree.
+//
+// Header fields are copied in host byte order, so both ends must be
+// little-endian (every platform this builds on is).
+//
+//   ExecuteTasks      head → node   u32 n, n × task          → ExecuteTasksReply
+//   ExecuteTasksReply node → head   ids rejected
+//   FreeObjects       head → node   ids                      (no reply)
+//   StealTasks        head → node   ids                      → StealTasksReply
+//   StealTasksReply   node → head   ids given back
+//   ObjectsCreated    node → head   ids, u64s sizes          (no reply)
+//   ObjectsFreed      node → head   ids                      (no reply)
+//   GetObject         node → node   u64 id                   → GetObjectReply
+//   GetObjectReply    node → node   bytes codec, u64 size, then the payload
+//
+// where task = u64 id, bytes function_name, ids deps, u32 n, n × bytes arg
+// and ids / u64s = u32 n, n × u64. A reply whose status is not Ok carries
+// an error message as its whole payload instead.
+
+#pragma once
+
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../../core/object_id.h"
+#include "../../core/task.h"
+
+namespace orion::distributed {
+
+    static_assert(std::endian::native == std::endian::little,
+                  "the TCP transport copies integers in host byte order");
+
+    enum class FrameType : uint16_t {
+        ExecuteTasks = 1,
+        ExecuteTasksReply,
+        FreeObjects,
+        StealTasks,
+        StealTasksReply,
+        ObjectsCreated,
+        ObjectsFreed,
+        GetObject,
+        GetObjectReply,
+    };
+
+    enum class FrameStatus : uint16_t {
+        Ok = 0,
+        NotFound,     // GetObject: not stored on this node
+        Failed,       // malformed request, no codec, unknown frame type
+    };
+
+    struct FrameHeader {
+        uint64_t length = 0;        // payload bytes after the header
+        uint32_t request_id = 0;    // 0: no reply wanted
+        FrameType type{};
+        FrameStatus status = FrameStatus::Ok;
+    };
+    static_assert(sizeof(FrameHeader) == 16);
+
+    // Frames the event loop buffers whole; larger ones close the connection.
+    // Object payloads are read by ObjectFetcher outside the loop and are not
+    // bound by it.
+    static constexpr uint64_t kMaxFrameBytes = 256 << 20;
+
+    // Encoded size of a task with an empty name and no deps or args: the
+    // most tasks a payload can hold is its size over this
+    static constexpr size_t kMinTaskBytes = sizeof(uint64_t) + 3 * sizeof(uint32_t);
+
+    // Appends encoded fields to a payload
+    class WireWriter {
+    public:
+        explicit WireWriter(std::string& out) : out_(out) {}
+
+        void u32(uint32_t v) { append(&v, sizeof(v)); }
+        void u64(uint64_t v) { append(&v, sizeof(v)); }
+
+        void bytes(std::string_view s) {
+            u32(uint32_t(s.size()));
+            out_.append(s);
+        }
+
+        void ids(const std::vector<orion::ObjectId>& ids) {
+            u32(uint32_t(ids.size()));
+            for (const auto& id : ids) u64(id.value());
+        }
+
+        void u64s(const std::vector<uint64_t>& values) {
+            u32(uint32_t(values.size()));
+            append(values.data(), values.size() * sizeof(uint64_t));
+        }
+
+        // Everything but the work closure, which the node binds by name
+        void task(const orion::Task& task) {
+            u64(task.id.value());
+            bytes(task.function_name);
+            u32(uint32_t(task.deps.size()));
+            for (const auto& dep : task.deps) u64(dep.id.value());
+            u32(uint32_t(task.args.size()));
+            for (const auto& arg : task.args) bytes(arg);
+        }
+
+    private:
+        void append(const void* p, size_t n) {
+            out_.append(static_cast<const char*>(p), n);
+        }
+
+        std::string& out_;
+    };
+
+    // Reads fields back. A read past the end fails it and every read after
+    // it (ok() turns false), so callers check once at the end.
+    class WireReader {
+    public:
+        explicit WireReader(std::string_view in) : in_(in) {}
+
+        bool ok() const { return ok_; }
+        bool done() const { return ok_ && in_.empty(); }
+
+        uint32_t u32() { uint32_t v = 0; take(&v, sizeof(v)); return v; }
+        uint64_t u64() { uint64_t v = 0; take(&v, sizeof(v)); return v; }
+
+        std::string_view bytes() {
+            const uint32_t n = u32();
+            if (!ok_ || n > in_.size()) return fail();
+            std::string_view s = in_.substr(0, n);
+            in_.remove_prefix(n);
+            return s;
+        }
+
+        std::vector<orion::ObjectId> ids() {
+            std::vector<orion::ObjectId> out;
+            const uint32_t n = count(sizeof(uint64_t));
+            out.reserve(n);
+            for (uint32_t i = 0; i < n; ++i) out.push_back(orion::ObjectId::from_value(u64()));
+            return out;
+        }
+
+        std::vector<uint64_t> u64s() {
+            std::vector<uint64_t> out(count(sizeof(uint64_t)));
+            take(out.data(), out.size() * sizeof(uint64_t));
+            return out;
+        }
+
+        // Fills id, function_name, deps and args; work is left to the caller
+        bool task(orion::Task& task) {
+            task.id = orion::ObjectId::from_value(u64());
+            task.function_name = std::string(bytes());
+            const uint32_t deps = count(sizeof(uint64_t));
+            task.deps.reserve(deps);
+            for (uint32_t i = 0; i < deps; ++i) {
+                task.deps.push_back(orion::ObjectRef{orion::ObjectId::from_value(u64())});
+            }
+            const uint32_t args = u32();
+            for (uint32_t i = 0; ok_ && i < args; ++i) task.args.emplace_back(bytes());
+            return ok_;
+        }
+
+    private:
+        // An element count, checked against the bytes left; 0 on failure
+        uint32_t count(size_t element_bytes) {
+            const uint32_t n = u32();
+            if (!ok_ || n > in_.size() / element_bytes) {
+                fail();
+                return 0;
+            }
+            return n;
+        }
+
+        void take(void* p, size_t n) {
+            if (!ok_ || n > in_.size()) {
+                fail();
+                return;
+            }
+            if (n == 0) return;
+            std::memcpy(p, in_.data(), n);
+            in_.remove_prefix(n);
+        }
+
+        std::string_view fail() {
+            ok_ = false;
+            in_ = {};
+            return {};
+        }
+
+        std::string_view in_;
+        bool ok_ = true;
+    };
+
+} // namespace orion::distributed
@@ -0,0 +1,186 @@
+//
+// TcpNodeServer — the node end of the raw TCP transport (rpc/tcp_wire.h),
+// serving what NodeServiceImpl serves over gRPC: ExecuteTasks, FreeObjects
+// and StealTasks from the head, GetObject from other nodes. Frames are
+// handled on one TcpLoop thread; tasks are admitted to the node
+// (NodeRuntime::admit) and objects are written out from the store.
+//
+// The node's created / freed reports go back to the head up the connection
+// the head dispatches on, so the head needs no listener of its own. Reports
+// made while no head is connected are sent once one is.
+//
+
+#pragma once
+
+#include <algorithm>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "distributed/node_runtime.h"
+#include "distributed/node_task.h"
+#include "distributed/object_fetcher.h"
+#include "distributed/functions/function_registry.h"
+#include "distributed/rpc/tcp_connection.h"
+
+namespace orion::distributed {
+
+class TcpNodeServer {
+public:
+    TcpNodeServer(NodeRuntime& node, FunctionRegistry& fn_reg)
+        : node_(node), fn_reg_(fn_reg) {}
+
+    ~TcpNodeServer() { shutdown(); }
+
+    TcpNodeServer(const TcpNodeServer&) = delete;
+    TcpNodeServer& operator=(const TcpNodeServer&) = delete;
+
+    // Listen on "host:port" and take over the node's reports. Returns the
+    // bound port, or -1.
+    int start(const std::string& listen_address) {
+        node_.set_create_listener([this](const std::vector<orion::ObjectId>& ids,
+                                         const std::vector<uint64_t>& sizes) {
+            std::string payload;
+            WireWriter out(payload);
+            out.ids(ids);
+            out.u64s(sizes);
+            report(FrameType::ObjectsCreated, std::move(payload));
+        });
+        node_.set_free_listener([this](const std::vector<orion::ObjectId>& ids) {
+            std::string payload;
+            WireWriter(payload).ids(ids);
+            report(FrameType::ObjectsFreed, std::move(payload));
+        });
+
+        return loop_.listen(
+            listen_address,
+            [this](TcpConnection& conn, const FrameHeader& header, std::string_view payload) {
+                handle(conn, header, payload);
+            },
+            [this](TcpConnection& conn) {
+                std::lock_guard<std::mutex> lock(head_mu_);
+                if (head_.get() == &conn) head_.reset();
+            });
+    }
+
+    // Stop serving; reports go nowhere until the next start()
+    void shutdown() {
+        loop_.stop();
+        node_.set_create_listener({});
+        node_.set_free_listener({});
+    }
+
+private:
+    void handle(TcpConnection& conn, const FrameHeader& header, std::string_view payload) {
+        WireReader in(payload);
+        switch (header.type) {
+            case FrameType::ExecuteTasks: {
+                became_head(conn);
+                const uint32_t count = in.u32();
+                std::cout << "[Node:" << node_.node_id()
+                          << "] ExecuteTasks  count=" << count << "\n" << std::flush;
+
+                std::vector<orion::Task> tasks;
+                std::vector<orion::ObjectId> rejected;
+                // `count` is the peer's word; reserve no more than fit in the payload
+                tasks.reserve(std::min<size_t>(count, payload.size() / kMinTaskBytes));
+                for (uint32_t i = 0; i < count && in.ok(); ++i) {
+                    orion::Task task;
+                    if (!in.task(task)) break;
+                    if (!bind_node_task(node_, fn_reg_, task)) {
+                        rejected.push_back(task.id);
+                        continue;
+                    }
+                    tasks.push_back(std::move(task));
+                }
+                if (!in.done()) {
+                    conn.send(FrameType::ExecuteTasksReply, header.request_id,
+                              "malformed ExecuteTasks", FrameStatus::Failed);
+                    return;
+                }
+
+                // Held for the head until it sends FreeObjects
+                node_.admit(std::move(tasks));
+
+                std::string reply;
+                WireWriter(reply).ids(rejected);
+                conn.send(FrameType::ExecuteTasksReply, header.request_id, std::move(reply));
+                return;
+            }
+
+            case FrameType::FreeObjects: {
+                became_head(conn);
+                const auto ids = in.ids();
+                if (in.done()) node_.free_objects(ids);
+                return;
+            }
+
+            case FrameType::StealTasks: {
+                became_head(conn);
+                const auto ids = in.ids();
+                std::vector<orion::ObjectId> stolen;
+                if (in.done()) stolen = node_.steal(ids);
+                std::cout << "[Node:" << node_.node_id() << "] StealTasks  asked="
+                          << ids.size() << "  given=" << stolen.size() << "\n" << std::flush;
+                std::string reply;
+                WireWriter(reply).ids(stolen);
+                conn.send(FrameType::StealTasksReply, header.request_id, std::move(reply));
+                return;
+            }
+
+            case FrameType::GetObject: {
+                const orion::ObjectId object_id = orion::ObjectId::from_value(in.u64());
+                if (!in.done()) {
+                    conn.send(FrameType::GetObjectReply, header.request_id,
+                              "malformed GetObject", FrameStatus::Failed);
+                    return;
+                }
+                std::cout << "[Node:" << node_.node_id()
+                          << "] GetObject  object=" << object_id << "\n" << std::flush;
+                ObjectFetcher::serve(node_.local_runtime().store(), object_id, conn,
+                                     header.request_id);
+                return;
+            }
+
+            default:
+                std::cerr << "[Node:" << node_.node_id() << "] Unexpected frame type "
+                          << unsigned(header.type) << " from " << conn.peer() << "\n";
+                if (header.request_id != 0) {
+                    conn.send(header.type, header.request_id, "unexpected frame type",
+                              FrameStatus::Failed);
+                }
+                return;
+        }
+    }
+
+    // Head-only calls mark the connection reports go up; on a new one,
+    // reports held back meanwhile go first
+    void became_head(TcpConnection& conn) {
+        std::lock_guard<std::mutex> lock(head_mu_);
+        if (head_.get() == &conn) return;
+        head_ = conn.shared_from_this();
+        for (auto& [type, payload] : unsent_) head_->send(type, 0, std::move(payload));
+        unsent_.clear();
+    }
+
+    void report(FrameType type, std::string payload) {
+        std::lock_guard<std::mutex> lock(head_mu_);
+        // Sent from a copy: a report the connection drops is kept for the next
+        if (head_ && head_->send(type, 0, payload)) return;
+        unsent_.emplace_back(type, std::move(payload));
+    }
+
+    NodeRuntime&      node_;
+    FunctionRegistry& fn_reg_;
+
+    std::shared_ptr<TcpConnection> head_;
+    std::vector<std::pair<FrameType, std::string>> unsent_;
+    std::mutex head_mu_;
+
+    TcpLoop loop_;   // last: stopped before the members its handlers use go
+};
+
+} // namespace orion::distributed
@@ -1,17 +1,33 @@
 // head_main.cpp — Orion Cluster Head Server
 // Implements the gRPC ClusterHead service.
 //
-// Usage:  ./head [port]   (default: 50050)
+// Usage:  ./head [port] [max_batch] [max_linger_us] [node_timeout_ms] [transport]
+//         (default: 50050 64 200 1000 grpc)
+//   Tasks bound for the same node are sent together, up to max_batch per
+//   ExecuteTasks call, waiting at most max_linger_us for a batch to fill.
+//   A node silent for node_timeout_ms is declared dead and its unfinished
+//   tasks are dispatched again elsewhere.
+//   transport "tcp" talks to nodes over the raw TCP transport instead of
+//   gRPC (TcpNodeClient); start every node with "tcp" too. Nodes still
+//   register, heartbeat and locate objects over gRPC.
 //
 // Milestone 1 observable output:
 //   [Head] Listening on 0.0.0.0:50050
-//   [Head] RegisterNode  node=node-1  addr=127.0.0.1:6001
-//   [Head] RegisterNode  node=node-2  addr=127.0.0.1:6002
+//   [Head] RegisterNode  node=node-1  addr=127.0.0.1:6001  workers=2  cpus=8
+//   [Head] RegisterNode  node=node-2  addr=127.0.0.1:6002  workers=2  cpus=8
+//   (each node then sends its load in a Heartbeat every 100 ms)
 //
 // Milestone 2 observable output (added):
-//   [Head] SubmitTask  task=t1  fn=add  → dispatching to node-1
-//   [GrpcNodeClient] ExecuteTask(t1) accepted by node-1
+//   [Head] SubmitTask  task=#1e5a63cd2743b958  fn=add
+//   [Head] SubmitGraph  tasks=3   (a whole DAG in one call)
+//   [GrpcNodeClient] ExecuteTasks(1 tasks) accepted by node-1
+//   (ids arrive as 64-bit values; names stay on the submitting side)
+//
+// Milestone 3 observable output (added):
+//   [Head] ReportObjectsCreated  node=node-1  count=1
+//   (tasks depending on those objects are dispatched only after this)
 
+#include <algorithm>
 #include <iostream>
 #include <string>
 #include <memory>
@@ -21,7 +37,43 @@
 #include "distributed/generated/orion.grpc.pb.h"
 #include "distributed/cluster/node_registry.h"
 #include "distributed/cluster/cluster_scheduler.h"
+#include "distributed/cluster/failure_detector.h"
 #include "distributed/rpc/grpc_node_client.h"
+#include "distributed/rpc/tcp_node_client.h"
+
+static constexpr int kMaxGraphBytes = 256 << 20;
+
+static orion::distributed::NodeLoad from_proto(const orion::NodeLoad& load) {
+    orion::distributed::NodeLoad out;
+    out.cpus          = int(load.cpus());
+    out.queued        = load.queued();
+    out.running       = load.running();
+    out.memory_bytes  = load.memory_bytes();
+    out.memory_budget = load.memory_budget();
+    return out;
+}
+
+// Build an orion::Task from a submitted TaskRequest.
+// The work closure is intentionally empty here — the head only makes the
+// scheduling decision; NodeServiceImpl on the target node does the actual work.
+static orion::Task from_proto(const orion::TaskRequest& req) {
+    orion::Task task;
+    task.id            = orion::ObjectId::from_value(req.task());
+    task.function_name = req.function_name();
+
+    for (uint64_t dep_id : req.deps()) {
+        task.deps.push_back(orion::ObjectRef{orion::ObjectId::from_value(dep_id)});
+    }
+    // Forward literal args bytes so GrpcNodeClient can include them in the
+    // TaskRequest it sends to the worker node.
+    for (const auto& bytes : req.args()) {
+        task.args.push_back(bytes);
+    }
+
+    // No-op work on the head side — real execution happens on the node.
+    task.work = [](std::vector<std::any>) -> std::any { return std::any{}; };
+    return task;
+}
 
 // ── gRPC ClusterHead service implementation ──────────────────────────────────
 class HeadServiceImpl final : public orion::ClusterHead::Service {
@@ -34,12 +86,26 @@ public:
     grpc::Status RegisterNode(grpc::ServerContext*,
                               const orion::RegisterNodeRequest* req,
                               orion::RegisterNodeReply* reply) override {
+        // Nodes that predate load reporting send no worker count
+        const int workers = req->load().workers() > 0 ? int(req->load().workers()) : 2;
         std::cout << "[Head] RegisterNode  node=" << req->node_id()
-                  << "  addr=" << req->address() << "\n" << std::flush;
+                  << "  addr=" << req->address() << "  workers=" << workers
+                  << "  cpus=" << req->load().cpus() << "\n" << std::flush;
 
-        registry_.register_node({req->node_id(), req->address(),
-                                 /*available_workers=*/2, /*alive=*/true});
+        orion::distributed::NodeInfo info{req->node_id(), req->address(), workers, /*alive=*/true};
+        info.load = from_proto(req->load());
+        registry_.register_node(info);
         reply->set_success(true);
+
+        // Tasks submitted while no node was up have been waiting for one
+        scheduler_.schedule();
+        return grpc::Status::OK;
+    }
+
+    grpc::Status Heartbeat(grpc::ServerContext*,
+                           const orion::HeartbeatRequest* req,
+                           orion::HeartbeatReply* reply) override {
+        reply->set_known(registry_.heartbeat(req->node_id(), from_proto(req->load())));
         return grpc::Status::OK;
     }
 
@@ -47,29 +113,11 @@ public:
     grpc::Status SubmitTask(grpc::ServerContext*,
                             const orion::TaskRequest* req,
                             orion::TaskReply* reply) override {
-        std::cout << "[Head] SubmitTask  task=" << req->task_id()
+        const orion::ObjectId task_id = orion::ObjectId::from_value(req->task());
+        std::cout << "[Head] SubmitTask  task=" << task_id
                   << "  fn=" << req->function_name() << "\n" << std::flush;
 
-        // Build an orion::Task from the proto request.
-        // The work closure is intentionally empty here — the head only makes the
-        // scheduling decision; NodeServiceImpl on the target node does the actual work.
-        orion::Task task;
-        task.id            = req->task_id();
-        task.function_name = req->function_name();
-
-        for (const auto& dep_id : req->dep_ids()) {
-            task.deps.push_back(orion::ObjectRef{dep_id});
-        }
-        // Forward literal args bytes so GrpcNodeClient can include them in the
-        // TaskRequest it sends to the worker node.
-        for (const auto& bytes : req->args()) {
-            task.args.push_back(bytes);
-        }
-
-        // No-op work on the head side — real execution happens on the node.
-        task.work = [](std::vector<std::any>) -> std::any { return std::any{}; };
-
-        scheduler_.submit(std::move(task));
+        scheduler_.submit(from_proto(*req));
 
         // The scheduler picks the node internally; for the reply we report which
         // node was selected (optimistic — from the last cluster pick).
@@ -78,31 +126,91 @@ public:
         return grpc::Status::OK;
     }
 
-    // ── Milestone 3 (stubbed) ────────────────────────────────────────────────
+    // A whole DAG: checked, ordered and submitted with one schedule() pass
+    grpc::Status SubmitGraph(grpc::ServerContext*,
+                             const orion::TaskBatch* req,
+                             orion::SubmitGraphReply* reply) override {
+        std::cout << "[Head] SubmitGraph  tasks=" << req->tasks_size() << "\n" << std::flush;
+
+        std::vector<orion::Task> tasks;
+        tasks.reserve(req->tasks_size());
+        for (const auto& task_req : req->tasks()) {
+            tasks.push_back(from_proto(task_req));
+        }
+        if (auto error = scheduler_.submit_graph(std::move(tasks))) {
+            std::cerr << "[Head] SubmitGraph rejected: " << *error << "\n";
+            return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT, *error);
+        }
+        reply->set_accepted(uint32_t(req->tasks_size()));
+        return grpc::Status::OK;
+    }
+
+    // ── Milestone 3 ─────────────────────────────────────────────────────────
     grpc::Status ReportObjectCreated(grpc::ServerContext*,
                                      const orion::ObjectReport* req,
                                      orion::Empty*) override {
-        std::cout << "[Head] ReportObjectCreated  object=" << req->object_id()
-                  << "  node=" << req->node_id() << "  (TODO)\n" << std::flush;
-        // Milestone 3: call scheduler_.on_object_created(req->object_id(), req->node_id())
-        return grpc::Status(grpc::StatusCode::UNIMPLEMENTED, "Milestone 3");
+        std::cout << "[Head] ReportObjectCreated  object="
+                  << orion::ObjectId::from_value(req->object())
+                  << "  node=" << req->node_id() << "\n" << std::flush;
+        scheduler_.on_object_created(orion::ObjectId::from_value(req->object()),
+                                     req->node_id());
+        return grpc::Status::OK;
+    }
+
+    // Nodes batch these: one call carries every object stored since the last
+    grpc::Status ReportObjectsCreated(grpc::ServerContext*,
+                                      const orion::ObjectCreatedReport* req,
+                                      orion::Empty*) override {
+        std::cout << "[Head] ReportObjectsCreated  node=" << req->node_id()
+                  << "  count=" << req->object_ids_size() << "\n" << std::flush;
+        std::vector<orion::ObjectId> ids;
+        ids.reserve(req->object_ids_size());
+        for (uint64_t id : req->object_ids()) {
+            ids.push_back(orion::ObjectId::from_value(id));
+        }
+        std::vector<uint64_t> sizes(req->sizes().begin(), req->sizes().end());
+        scheduler_.on_objects_created(ids, req->node_id(), sizes);
+        return grpc::Status::OK;
     }
 
     grpc::Status GetObjectLocation(grpc::ServerContext*,
                                    const orion::ObjectLocationRequest* req,
                                    orion::ObjectLocationReply* reply) override {
-        auto loc = scheduler_.object_location(req->object_id());
+        const orion::ObjectId object_id = orion::ObjectId::from_value(req->object());
+        auto loc = scheduler_.object_location(object_id);
         if (!loc) {
+            // Lost with its node, or not produced yet: worth asking again
+            if (scheduler_.reconstruct(object_id)) {
+                return grpc::Status(grpc::StatusCode::UNAVAILABLE,
+                                    "Object being produced: " + object_id.name());
+            }
             return grpc::Status(grpc::StatusCode::NOT_FOUND,
-                                "Object not found: " + req->object_id());
+                                "Object not found: " + object_id.name());
         }
         reply->set_node_id(*loc);
         // address lookup from registry (best-effort)
-        for (const auto& n : registry_.nodes()) {
-            if (n.node_id == *loc) {
-                reply->set_address(n.address);
-                break;
-            }
+        const auto members = registry_.snapshot();
+        if (const auto* node = members->find(*loc)) reply->set_address(node->address);
+        return grpc::Status::OK;
+    }
+
+    // ── Object lifetime ──────────────────────────────────────────────────────
+    grpc::Status ReleaseObjects(grpc::ServerContext*,
+                                const orion::ObjectIdList* req,
+                                orion::Empty*) override {
+        for (uint64_t id : req->ids()) {
+            scheduler_.release(orion::ObjectId::from_value(id));
+        }
+        return grpc::Status::OK;
+    }
+
+    grpc::Status ReportObjectsFreed(grpc::ServerContext*,
+                                    const orion::ObjectFreeReport* req,
+                                    orion::Empty*) override {
+        std::cout << "[Head] ReportObjectsFreed  node=" << req->node_id()
+                  << "  count=" << req->ids_size() << "\n" << std::flush;
+        for (uint64_t id : req->ids()) {
+            scheduler_.on_object_freed(orion::ObjectId::from_value(id), req->node_id());
         }
         return grpc::Status::OK;
     }
@@ -117,16 +225,72 @@ int main(int argc, char* argv[]) {
     std::string port           = (argc > 1) ? argv[1] : "50050";
     std::string server_address = "0.0.0.0:" + port;
 
+    orion::distributed::DispatchOptions dispatch;
+    if (argc > 2) dispatch.max_batch  = std::stoul(argv[2]);
+    if (argc > 3) dispatch.max_linger = std::chrono::microseconds(std::stoul(argv[3]));
+
+    orion::distributed::FailureDetectorOptions detection;
+    if (argc > 4) {
+        detection.timeout  = std::chrono::milliseconds(std::stoul(argv[4]));
+        detection.interval = std::min(detection.interval, detection.timeout / 4);
+    }
+
+    auto transport = orion::distributed::Transport::Grpc;
+    if (argc > 5) {
+        auto parsed = orion::distributed::parse_transport(argv[5]);
+        if (!parsed) {
+            std::cerr << "[Head] Unknown transport '" << argv[5] << "' (grpc or tcp)\n";
+            return 1;
+        }
+        transport = *parsed;
+    }
+
     orion::distributed::NodeRegistry registry;
 
-    // Milestone 2: use real gRPC dispatch to worker nodes
-    orion::distributed::GrpcNodeClient grpc_client(registry);
-    orion::distributed::ClusterScheduler scheduler(registry, grpc_client);
+    // Milestone 2: use real gRPC dispatch to worker nodes (or raw TCP)
+    std::unique_ptr<orion::distributed::NodeClient> client;
+    orion::distributed::TcpNodeClient* tcp_client = nullptr;
+    if (transport == orion::distributed::Transport::Tcp) {
+        auto tcp = std::make_unique<orion::distributed::TcpNodeClient>(registry);
+        tcp_client = tcp.get();
+        client = std::move(tcp);
+    } else {
+        client = std::make_unique<orion::distributed::GrpcNodeClient>(registry);
+    }
+    orion::distributed::ClusterScheduler scheduler(registry, *client, dispatch);
+
+    // Over TCP, node reports arrive on the dispatch connections rather than
+    // as ReportObjectsCreated / ReportObjectsFreed calls
+    if (tcp_client) {
+        tcp_client->set_report_handlers(
+            [&](const std::string& node_id, const std::vector<orion::ObjectId>& ids,
+                const std::vector<uint64_t>& sizes) {
+                std::cout << "[Head] ReportObjectsCreated  node=" << node_id
+                          << "  count=" << ids.size() << "\n" << std::flush;
+                scheduler.on_objects_created(ids, node_id, sizes);
+            },
+            [&](const std::string& node_id, const std::vector<orion::ObjectId>& ids) {
+                std::cout << "[Head] ReportObjectsFreed  node=" << node_id
+                          << "  count=" << ids.size() << "\n" << std::flush;
+                for (const auto& id : ids) scheduler.on_object_freed(id, node_id);
+            });
+    }
+
+    orion::distributed::FailureDetector detector(
+        registry,
+        [&](const std::string& node_id) { scheduler.on_node_dead(node_id); },
+        detection,
+        [&] {
+            scheduler.retry_failed();
+            scheduler.rebalance();
+        });
 
     HeadServiceImpl service(registry, scheduler);
 
     grpc::ServerBuilder builder;
     builder.AddListeningPort(server_address, grpc::InsecureServerCredentials());
+    // SubmitGraph carries whole DAGs; gRPC's 4 MiB default is ~100k tasks
+    builder.SetMaxReceiveMessageSize(kMaxGraphBytes);
     builder.RegisterService(&service);
 
     auto server = builder.BuildAndStart();
@@ -134,7 +298,8 @@ int main(int argc, char* argv[]) {
         std::cerr << "[Head] Failed to start on " << server_address << "\n";
         return 1;
     }
-    std::cout << "[Head] Listening on " << server_address << "\n" << std::flush;
+    std::cout << "[Head] Listening on " << server_address
+              << (tcp_client ? "  (nodes over tcp)" : "") << "\n" << std::flush;
     server->Wait();
     return 0;
 }
@@ -8,7 +8,21 @@
 
 namespace orion {
 
-    Runtime::Runtime(size_t num_workers) {
+    Runtime::Runtime(size_t num_workers, ExecutionMode mode)
+        : Runtime(num_workers, RuntimeOptions{.mode = mode}) {}
+
+    Runtime::Runtime(size_t num_workers, RuntimeOptions options) {
+        if (options.reference_counting) {
+            store_.enable_reference_counting();
+        }
+        store_.enable_spilling(std::move(options.spill));
+
+        if (options.mode == ExecutionMode::WorkStealing) {
+            pool_ = std::make_unique<WorkStealingPool>(num_workers, store_);
+            scheduler_ = std::make_unique<Scheduler>(*pool_, store_);
+            pool_->start();
+            return;
+        }
 
         // Create workers
         for (size_t i = 0; i < num_workers; ++i) {
@@ -29,21 +43,110 @@ namespace orion {
         }
     }
 
+    Runtime::~Runtime() {
+        // Threads must be gone before scheduler_ (their put callback target) is destroyed
+        shutdown();
+    }
+
     ObjectRef Runtime::submit(Task task) {
-        scheduler_->submit(task);
+        ObjectRef out = take_ownership(task);
+        scheduler_->submit(std::move(task));
+        scheduler_->schedule();
+        return out;
+    }
+
+    std::vector<ObjectRef> Runtime::submit_batch(std::vector<Task> tasks) {
+        std::vector<ObjectRef> out;
+        out.reserve(tasks.size());
+        for (auto& task : tasks) {
+            out.push_back(take_ownership(task));
+        }
+        scheduler_->submit_batch(tasks);
         scheduler_->schedule();
-        return ObjectRef{task.id};
+        return out;
+    }
+
+    ObjectRef Runtime::take_ownership(Task& task) {
+        // Take ownership of the output before the task can possibly finish
+        ObjectRef out{task.id, store_.make_owner(task.id)};
+        if (store_.reference_counting()) {
+            // The task is a consumer of its deps until it is destroyed
+            for (auto& dep : task.deps) {
+                if (!dep.owner) dep.owner = store_.make_owner(dep.id);
+            }
+        }
+        return out;
+    }
+
+    ObjectRef Runtime::submit(const ObjectId& id, CoTask task) {
+        ObjectRef out{id, store_.make_owner(id)};
+        std::move(task).launch(store_, id, [this](std::function<void()> job) {
+            scheduler_->post(std::move(job));
+        });
+        return out;
     }
 
     void Runtime::wait(const ObjectRef& ref) {
-        store_.get_blocking(ref.id);
+        store_.wait(ref.id);
+    }
+
+    void Runtime::wait_all(const std::vector<ObjectRef>& refs) {
+        for (const auto& ref : refs) {
+            store_.wait(ref.id);
+        }
+    }
+
+    size_t Runtime::wait_any(const std::vector<ObjectRef>& refs) {
+        std::vector<ObjectId> ids;
+        ids.reserve(refs.size());
+        for (const auto& ref : refs) {
+            ids.push_back(ref.id);
+        }
+        return store_.wait_any(ids);
     }
 
     std::any Runtime::get(const ObjectRef& ref) {
         return store_.get_blocking(ref.id);
     }
 
+    ObjectHandle Runtime::get_handle(const ObjectRef& ref) {
+        return store_.get_handle_blocking(ref.id);
+    }
+
+    void Runtime::set_on_put_callback(ObjectStore::PutObserver callback) {
+        store_.set_put_observer(std::move(callback));
+    }
+
+    void Runtime::set_on_free_callback(ObjectStore::OnFreeCallback callback) {
+        store_.set_on_free_callback(std::move(callback));
+    }
+
+    size_t Runtime::object_count() {
+        return store_.size();
+    }
+
+    SpillStats Runtime::spill_stats() {
+        return store_.spill_stats();
+    }
+
+    RuntimeLoad Runtime::load() {
+        RuntimeLoad load;
+        load.waiting = scheduler_->pending_count();
+        if (pool_) {
+            load.queued = pool_->queued();
+            load.running = pool_->running();
+        }
+        for (const auto& worker : workers_) {
+            load.queued += worker->queued();
+            load.running += worker->running();
+        }
+        return load;
+    }
+
     void Runtime::shutdown() {
+        if (pool_) {
+            pool_->stop();
+        }
         for (auto& w : workers_) {
             w->stop();
         }
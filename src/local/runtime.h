@@ -16,30 +16,135 @@
 #include "../core/task.h"
 #include "../core/worker.h"
 #include "../core/scheduler.h"
+#include "../core/work_stealing_pool.h"
+#include "../core/co_task.h"
+#include "../core/typed_ref.h"
 
 namespace orion {
 
+    // How ready tasks are spread over threads
+    enum class ExecutionMode {
+        RoundRobin,     // one private queue per Worker, strict rotation
+        WorkStealing,   // per-thread deques + stealing (WorkStealingPool)
+    };
+
+    struct RuntimeOptions {
+        ExecutionMode mode = ExecutionMode::RoundRobin;
+
+        // Free each object once no owning ObjectRef and no pending task
+        // holds it. Off: objects live as long as the Runtime.
+        bool reference_counting = false;
+
+        // Memory budget for the object store; cold objects beyond it are
+        // spilled to disk. spill.memory_budget == 0 disables spilling.
+        SpillConfig spill = {};
+    };
+
+    // Task counts at one moment (see Runtime::load)
+    struct RuntimeLoad {
+        size_t waiting = 0;   // submitted, inputs not all stored yet
+        size_t queued = 0;    // ready, not started
+        size_t running = 0;
+    };
+
     class Runtime {
     public:
         // Create runtime with N worker threads
-        explicit Runtime(size_t num_workers);
+        explicit Runtime(size_t num_workers,
+                         ExecutionMode mode = ExecutionMode::RoundRobin);
+        Runtime(size_t num_workers, RuntimeOptions options);
+        ~Runtime();
 
-        // Submit a task to the system
+        // Submit a task to the system. With reference counting on, the
+        // returned ref owns the output and the task holds its deps until it
+        // has run.
         ObjectRef submit(Task task);
 
+        // Submit a batch in one pass: one scheduler lock and one dispatch
+        // round for all of them. Refs come back in task order.
+        std::vector<ObjectRef> submit_batch(std::vector<Task> tasks);
+
+        // Submit a coroutine task; its co_return value is stored under `id`.
+        // It may co_await ObjectRefs without holding a worker thread.
+        ObjectRef submit(const ObjectId& id, CoTask task);
+
+        // Typed submit: fn's argument types come from the refs at compile
+        // time and it reads its inputs in place, without std::any copies.
+        // The output gets a generated id.
+        template <typename F, typename... Refs>
+            requires TypedInvocable<F, Refs...>
+        TypedRef<typed_result_t<F, Refs...>> submit(F&& fn, Refs&&... refs) {
+            return submit(ObjectId::generate(), std::forward<F>(fn), std::forward<Refs>(refs)...);
+        }
+
+        // Typed submit with an explicit output id
+        template <typename F, typename... Refs>
+            requires TypedInvocable<F, Refs...>
+        TypedRef<typed_result_t<F, Refs...>> submit(ObjectId id, F&& fn, Refs&&... refs) {
+            return {submit(make_typed_task(std::move(id), std::forward<F>(fn),
+                                           std::forward<Refs>(refs)...))};
+        }
+
         // Blocking wait
         void wait(const ObjectRef& ref);
 
-        // Get result (blocking)
+        // Block until every ref is available
+        void wait_all(const std::vector<ObjectRef>& refs);
+
+        // Block until any ref is available; returns its index in `refs`.
+        // Throws std::invalid_argument if `refs` is empty.
+        size_t wait_any(const std::vector<ObjectRef>& refs);
+
+        // Get result (blocking); copies the payload
         std::any get(const ObjectRef& ref);
 
+        // Get a shared handle to the result (blocking); no copy
+        ObjectHandle get_handle(const ObjectRef& ref);
+
+        // Typed result (blocking); copies the payload out of the store
+        template <typename T>
+            requires std::is_copy_constructible_v<T>
+        T get(const TypedRef<T>& ref) {
+            return typed_cast<T>(store_.get_handle_blocking(ref.id()));
+        }
+
+        // Typed result shared with the store (blocking); works for move-only T
+        template <typename T>
+        std::shared_ptr<const T> get_shared(const TypedRef<T>& ref) {
+            return typed_share<T>(store_.get_handle_blocking(ref.id()));
+        }
+
+        // Called with the id and size of every object stored, after the
+        // scheduler has seen it
+        void set_on_put_callback(ObjectStore::PutObserver callback);
+
+        // Called whenever reference counting frees an object
+        void set_on_free_callback(ObjectStore::OnFreeCallback callback);
+
+        // Objects currently held in the store (in memory or spilled)
+        size_t object_count();
+
+        // Memory / disk usage and spill + restore counters
+        SpillStats spill_stats();
+
+        // Tasks waiting, queued and running. Cheap: a few counter reads.
+        RuntimeLoad load();
+
+        // The underlying store, for a node's data plane (object transfer)
+        ObjectStore& store() { return store_; }
+
         // Graceful shutdown
         void shutdown();
 
     private:
+        // Owning ref for the task's output; with reference counting on,
+        // also makes the task hold its deps
+        ObjectRef take_ownership(Task& task);
+
         ObjectStore store_;
 
         std::vector<std::unique_ptr<Worker>> workers_;
+        std::unique_ptr<WorkStealingPool> pool_;
         std::unique_ptr<Scheduler> scheduler_;
     };
 
@@ -8,6 +8,9 @@
 
 #include <iostream>
 #include <any>
+#include <chrono>
+#include <optional>
+#include <thread>
 #include "local/runtime.h"
 
 using namespace orion;
@@ -21,7 +24,7 @@ using namespace orion;
 //         [](std::vector<std::any>) { return 2; }
 //     };
 //
-//     auto ref = rt.submit(t);
+//     auto ref = rt.submit(std::move(t));
 //
 //     rt.wait(ref);
 //
@@ -45,7 +48,7 @@ using namespace orion;
 //         [](std::vector<std::any>) { return 42; }
 //     };
 //
-//     auto ref = rt.submit(t);
+//     auto ref = rt.submit(std::move(t));
 //     rt.wait(ref);
 //
 //     node.stop();
@@ -77,6 +80,25 @@ int main() {
 
     ClusterScheduler cluster(registry, client);
 
+    // Objects a node has stored become visible to the scheduler; B is
+    // dispatched only once A has been reported
+    n1.set_create_listener([&](const std::vector<orion::ObjectId>& ids,
+                               const std::vector<uint64_t>& sizes) {
+        cluster.on_objects_created(ids, "node-1", sizes);
+    });
+    n2.set_create_listener([&](const std::vector<orion::ObjectId>& ids,
+                               const std::vector<uint64_t>& sizes) {
+        cluster.on_objects_created(ids, "node-2", sizes);
+    });
+
+    // Objects freed on a node leave the head's location table
+    n1.set_free_listener([&](const std::vector<orion::ObjectId>& ids) {
+        for (const auto& id : ids) cluster.on_object_freed(id, "node-1");
+    });
+    n2.set_free_listener([&](const std::vector<orion::ObjectId>& ids) {
+        for (const auto& id : ids) cluster.on_object_freed(id, "node-2");
+    });
+
     // Task A
     orion::Task t1{
         "A",
@@ -94,15 +116,25 @@ int main() {
         }
     };
 
-    cluster.submit(t1);
-    cluster.submit(t2);
-
-    // In v0.2 we assumed locations at dispatch time;
-    // real completion tracking comes next (heartbeats/object reports).
-    // For now you can just sleep or block at node-local store if you expose it.
+    cluster.submit(std::move(t1));
+    cluster.submit(std::move(t2));
+    cluster.flush();   // send the batches now rather than after the linger time
 
     std::cout << "Cluster scheduled tasks.\n";
 
+    // Wait for B's node to report it, then read it there
+    std::optional<std::string> where;
+    for (int i = 0; i < 200 && !(where = cluster.object_location("B")); ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    if (where) {
+        NodeRuntime& holder = (*where == "node-1") ? n1 : n2;
+        int b = std::any_cast<int>(holder.local_runtime().get(orion::ObjectRef{"B"}));
+        std::cout << "B = " << b << " (on " << *where << ")\n";
+    } else {
+        std::cout << "B was not reported\n";
+    }
+
     n1.stop();
     n2.stop();
 }
\ No newline at end of file
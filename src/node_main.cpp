@@ -3,17 +3,24 @@
 //   1. Registers with the head server via gRPC (Milestone 1)
 //   2. Runs a NodeService gRPC server so the head can dispatch tasks (Milestone 2)
 //
-// Usage:  ./node <head_port> <node_port> <node_id>
-// Example:./node 50050 6001 node-1
+// Usage:  ./node <head_port> <node_port> <node_id> [memory_budget_mb] [workers] [transport]
+// Example:./node 50050 6001 node-1 4096 8
+//
+// With a memory budget (0 = none), objects beyond it are spilled under /tmp.
+// workers defaults to 2; the head places work by tasks per worker.
+// transport "tcp" serves node_port with TcpNodeServer instead of the gRPC
+// NodeService, and fetches from other nodes over TCP; the head and every
+// other node must use "tcp" too.
 //
 // Observable Milestone 2 output:
 //   [NodeRuntime] Starting node node-1 on port 6001
 //   [NodeRuntime] Registration successful (node=node-1)
 //   [Node:node-1] NodeService listening on 0.0.0.0:6001
 //   [Node:node-1] Running. Press Ctrl-C to stop.
-//   [Node:node-1] ExecuteTask  task=t1  fn=add
+//   [Node:node-1] ExecuteTasks  count=1
 //   [Node:node-1] Task complete  fn=add
 
+#include <algorithm>
 #include <iostream>
 #include <string>
 #include <csignal>
@@ -21,11 +28,13 @@
 #include <thread>
 #include <chrono>
 #include <memory>
+#include <optional>
 
 #include <grpcpp/grpcpp.h>
 
 #include "distributed/node_runtime.h"
 #include "distributed/node_service_impl.h"
+#include "distributed/tcp_node_server.h"
 #include "distributed/functions/function_registry.h"
 #include "distributed/functions/builtin_functions.h"
 
@@ -37,10 +46,24 @@ int main(int argc, char* argv[]) {
     int         head_port = 50050;
     int         node_port = 6001;
     std::string node_id   = "node-1";
+    size_t      budget_mb = 0;   // 0 = unlimited
+    size_t      workers   = 2;
+    auto        transport = orion::distributed::Transport::Grpc;
 
     if (argc >= 2) head_port = std::stoi(argv[1]);
     if (argc >= 3) node_port = std::stoi(argv[2]);
     if (argc >= 4) node_id   = argv[3];
+    if (argc >= 5) budget_mb = std::stoull(argv[4]);
+    if (argc >= 6) workers   = std::max<size_t>(std::stoull(argv[5]), 1);
+    if (argc >= 7) {
+        auto parsed = orion::distributed::parse_transport(argv[6]);
+        if (!parsed) {
+            std::cerr << "[Node:" << node_id << "] Unknown transport '" << argv[6]
+                      << "' (grpc or tcp)\n";
+            return 1;
+        }
+        transport = *parsed;
+    }
 
     std::string cluster_address = head_host + ":" + std::to_string(head_port);
     std::string node_address    = "127.0.0.1:" + std::to_string(node_port);
@@ -48,34 +71,53 @@ int main(int argc, char* argv[]) {
 
     // ── 1. Build local runtime + register with head ──────────────────────────
     orion::distributed::NodeRuntime node(
-        /*num_workers=*/2,
+        workers,
         node_port,
         cluster_address,
         node_id,
         node_address
     );
+    if (budget_mb > 0) {
+        orion::SpillConfig spill;
+        spill.memory_budget = budget_mb << 20;
+        node.set_spill_config(spill);
+    }
+    node.set_transport(transport);
     node.start();   // registers with head internally
 
     // ── 2. Build function registry with builtins ─────────────────────────────
     orion::distributed::FunctionRegistry fn_reg;
     orion::distributed::register_builtin_functions(fn_reg);
 
-    // ── 3. Start NodeService gRPC server ─────────────────────────────────────
+    // ── 3. Start NodeService gRPC server (or the TCP one) ────────────────────
     orion::distributed::NodeServiceImpl node_service(node, fn_reg);
-
-    grpc::ServerBuilder builder;
-    builder.AddListeningPort(listen_address, grpc::InsecureServerCredentials());
-    builder.RegisterService(&node_service);
-
-    g_grpc_server = builder.BuildAndStart();
-    if (!g_grpc_server) {
-        std::cerr << "[Node:" << node_id << "] Failed to start NodeService on "
-                  << listen_address << "\n";
-        node.stop();
-        return 1;
+    std::optional<orion::distributed::TcpNodeServer> tcp_server;
+
+    if (transport == orion::distributed::Transport::Tcp) {
+        tcp_server.emplace(node, fn_reg);
+        if (tcp_server->start(listen_address) < 0) {
+            std::cerr << "[Node:" << node_id << "] Failed to start TcpNodeServer on "
+                      << listen_address << "\n";
+            node.stop();
+            return 1;
+        }
+        std::cout << "[Node:" << node_id << "] TcpNodeServer listening on "
+                  << listen_address << "\n" << std::flush;
+    } else {
+        grpc::ServerBuilder builder;
+        builder.AddListeningPort(listen_address, grpc::InsecureServerCredentials());
+        builder.RegisterService(&node_service);
+
+        g_grpc_server = builder.BuildAndStart();
+        if (!g_grpc_server) {
+            std::cerr << "[Node:" << node_id << "] Failed to start NodeService on "
+                      << listen_address << "\n";
+            node.stop();
+            return 1;
+        }
+        std::cout << "[Node:" << node_id << "] NodeService listening on "
+                  << listen_address << "\n" << std::flush;
     }
-    std::cout << "[Node:" << node_id << "] NodeService listening on "
-              << listen_address << "\n" << std::flush;
 
     // ── 4. Run until Ctrl-C ───────────────────────────────────────────────────
     std::signal(SIGINT, [](int) {
@@ -90,7 +132,8 @@ int main(int argc, char* argv[]) {
         std::this_thread::sleep_for(std::chrono::milliseconds(200));
     }
 
-    g_grpc_server->Shutdown();
+    if (g_grpc_server) g_grpc_server->Shutdown();
+    if (tcp_server) tcp_server->shutdown();
     node.stop();
     return 0;
 }
@@ -1,6 +1,7 @@
 // submit_test.cpp — Milestone 2 smoke test
-// Connects to the head server, submits two tasks (one with a dep), and
-// verifies they are accepted and dispatched to nodes.
+// Connects to the head server, submits two tasks, and verifies they are
+// accepted and dispatched to nodes. Then submits a three-task DAG in one
+// SubmitGraph call, consumer first: the head orders it itself.
 //
 // Usage:  ./submit_test [head_port]  (default: 50050)
 
@@ -10,6 +11,7 @@
 #include <vector>
 #include <grpcpp/grpcpp.h>
 #include "distributed/generated/orion.grpc.pb.h"
+#include "core/object_id.h"
 
 int main(int argc, char* argv[]) {
     std::string port = (argc > 1) ? argv[1] : "50050";
@@ -30,9 +32,9 @@ int main(int argc, char* argv[]) {
                       const std::vector<std::string>& deps,
                       const std::vector<int>& int_args = {}) {
         orion::TaskRequest req;
-        req.set_task_id(task_id);
+        req.set_task(orion::ObjectId(task_id).value());
         req.set_function_name(fn);
-        for (const auto& d : deps) req.add_dep_ids(d);
+        for (const auto& d : deps) req.add_deps(orion::ObjectId(d).value());
         for (int v : int_args)    req.add_args(pack_int(v));
 
         orion::TaskReply reply;
@@ -54,6 +56,47 @@ int main(int argc, char* argv[]) {
     // Task B: mul(6, 7) → expected 42  (sent to different node round-robin)
     submit("task-B", "mul", {}, {6, 7});
 
+    // graph-Z: add(graph-X, graph-Y) = add(add(1, 2), mul(3, 4)) → expected 15
+    {
+        orion::TaskBatch graph;
+        auto add_task = [&](const std::string& task_id, const std::string& fn,
+                            const std::vector<std::string>& deps,
+                            const std::vector<int>& int_args) {
+            orion::TaskRequest* req = graph.add_tasks();
+            req->set_task(orion::ObjectId(task_id).value());
+            req->set_function_name(fn);
+            for (const auto& d : deps) req->add_deps(orion::ObjectId(d).value());
+            for (int v : int_args)    req->add_args(pack_int(v));
+        };
+        add_task("graph-Z", "add", {"graph-X", "graph-Y"}, {});
+        add_task("graph-X", "add", {}, {1, 2});
+        add_task("graph-Y", "mul", {}, {3, 4});
+
+        orion::SubmitGraphReply reply;
+        grpc::ClientContext ctx;
+        grpc::Status status = stub->SubmitGraph(&ctx, graph, &reply);
+        if (status.ok()) {
+            std::cout << "[SubmitTest] Graph accepted  tasks=" << reply.accepted() << "\n";
+        } else {
+            std::cerr << "[SubmitTest] Graph FAILED: " << status.error_message() << "\n";
+        }
+    }
+
+    // Drop our handles so the nodes can free the results
+    {
+        orion::ObjectIdList req;
+        for (const char* id : {"task-A", "task-B", "graph-X", "graph-Y", "graph-Z"}) {
+            req.add_ids(orion::ObjectId(id).value());
+        }
+        orion::Empty reply;
+        grpc::ClientContext ctx;
+        grpc::Status status = stub->ReleaseObjects(&ctx, req, &reply);
+        if (!status.ok()) {
+            std::cerr << "[SubmitTest] ReleaseObjects FAILED: "
+                      << status.error_message() << "\n";
+        }
+    }
+
     std::cout << "[SubmitTest] Done.\n";
     return 0;
 }
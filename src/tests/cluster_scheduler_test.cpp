@@ -0,0 +1,198 @@
+// cluster_scheduler_test.cpp — ClusterScheduler::submit_graph validation:
+// duplicate ids, unknown deps and cycles are refused whole, a valid graph
+// runs. Two in-process nodes stand in for the cluster (InProcessNodeClient).
+//
+// Each check runs with a watchdog: a case that hangs fails instead of
+// blocking the run.
+//
+// Usage:  ./test_cluster_scheduler   (exit status 0 when every check passes)
+
+#include <any>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <future>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "core/worker.h"
+#include "distributed/node_runtime.h"
+#include "distributed/cluster/node_registry.h"
+#include "distributed/cluster/cluster_scheduler.h"
+#include "distributed/rpc/inprocess_node_client.h"
+
+namespace {
+
+    using namespace orion::distributed;
+
+    int failures = 0;
+
+    void check(bool ok, const std::string& what) {
+        std::cout << (ok ? "  ok    " : "  FAIL  ") << what << "\n";
+        if (!ok) ++failures;
+    }
+
+    // Runs `body` on its own thread; a hung case is reported and abandoned
+    void run(const std::string& name, std::function<void()> body) {
+        std::cout << name << "\n";
+        std::packaged_task<void()> task(std::move(body));
+        auto done = task.get_future();
+        std::thread(std::move(task)).detach();
+        if (done.wait_for(std::chrono::seconds(5)) != std::future_status::ready) {
+            check(false, "finished within 5 s");
+            std::cout << std::flush;
+            std::_Exit(1);   // the hung thread still holds the case's state
+        }
+        try {
+            done.get();
+        } catch (const std::exception& e) {
+            check(false, std::string("unexpected exception: ") + e.what());
+        }
+    }
+
+    // Two nodes wired to a scheduler the way main.cpp wires them
+    struct Cluster {
+        NodeRuntime n1{1, 0};
+        NodeRuntime n2{1, 0};
+        NodeRegistry registry;
+        InProcessNodeClient client;
+        std::optional<ClusterScheduler> scheduler;
+
+        Cluster() {
+            n1.start();
+            n2.start();
+            registry.register_node({"node-1", "localhost:0", 1, true});
+            registry.register_node({"node-2", "localhost:0", 1, true});
+            client.add_node("node-1", &n1);
+            client.add_node("node-2", &n2);
+            scheduler.emplace(registry, client);
+            wire(n1, "node-1");
+            wire(n2, "node-2");
+        }
+
+        ~Cluster() {
+            scheduler.reset();
+            n1.stop();
+            n2.stop();
+        }
+
+        void wire(NodeRuntime& node, const std::string& node_id) {
+            node.set_create_listener([this, node_id](const std::vector<orion::ObjectId>& ids,
+                                                     const std::vector<uint64_t>& sizes) {
+                scheduler->on_objects_created(ids, node_id, sizes);
+            });
+            node.set_free_listener([this, node_id](const std::vector<orion::ObjectId>& ids) {
+                for (const auto& id : ids) scheduler->on_object_freed(id, node_id);
+            });
+        }
+
+        // The object's value once its node has reported it; nullopt after 2 s
+        std::optional<int> result(const orion::ObjectId& id) {
+            std::optional<std::string> where;
+            for (int i = 0; i < 200 && !(where = scheduler->object_location(id)); ++i) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            }
+            if (!where) return std::nullopt;
+            NodeRuntime& holder = (*where == "node-1") ? n1 : n2;
+            return std::any_cast<int>(holder.local_runtime().get(orion::ObjectRef{id}));
+        }
+    };
+
+    orion::Task constant(const std::string& id, int value) {
+        return orion::Task{id, {}, [value](const std::vector<std::any>&) -> std::any {
+            return value;
+        }};
+    }
+
+    orion::Task plus_one(const std::string& id, const std::string& dep) {
+        return orion::Task{id, {orion::ObjectRef{dep}}, [](std::vector<std::any> args) -> std::any {
+            return std::any_cast<int>(args[0]) + 1;
+        }};
+    }
+
+    bool mentions(const std::optional<std::string>& error, const std::string& what) {
+        return error && error->find(what) != std::string::npos;
+    }
+
+    // A refused graph leaves nothing behind: no pending task, no output
+    void check_nothing_submitted(Cluster& cluster, const orion::ObjectId& id) {
+        check(cluster.scheduler->pending_count() == 0, "no task is left pending");
+        cluster.scheduler->flush();
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        check(!cluster.scheduler->object_location(id), "no task ran");
+    }
+
+    void duplicate_id_is_refused() {
+        Cluster cluster;
+        std::vector<orion::Task> graph;
+        graph.push_back(constant("dup.a", 1));
+        graph.push_back(constant("dup.a", 2));
+        check(mentions(cluster.scheduler->submit_graph(std::move(graph)), "appears twice"),
+              "a graph naming one task twice is refused");
+        check_nothing_submitted(cluster, orion::ObjectId("dup.a"));
+    }
+
+    void already_submitted_id_is_refused() {
+        Cluster cluster;
+        std::vector<orion::Task> first;
+        first.push_back(constant("again.a", 1));
+        check(!cluster.scheduler->submit_graph(std::move(first)), "the first graph is taken");
+        cluster.scheduler->flush();
+        check(cluster.result(orion::ObjectId("again.a")) == 1, "and runs");
+
+        std::vector<orion::Task> second;
+        second.push_back(constant("again.a", 2));
+        check(mentions(cluster.scheduler->submit_graph(std::move(second)), "already submitted"),
+              "a graph reusing a stored id is refused");
+    }
+
+    void unknown_dep_is_refused() {
+        Cluster cluster;
+        std::vector<orion::Task> graph;
+        graph.push_back(constant("unknown.a", 1));
+        graph.push_back(plus_one("unknown.b", "unknown.missing"));
+        check(mentions(cluster.scheduler->submit_graph(std::move(graph)), "unknown object"),
+              "a dep neither in the graph nor known is refused");
+        check_nothing_submitted(cluster, orion::ObjectId("unknown.a"));
+    }
+
+    void cycle_is_refused() {
+        Cluster cluster;
+        std::vector<orion::Task> graph;
+        graph.push_back(constant("cycle.root", 1));
+        graph.push_back(plus_one("cycle.a", "cycle.b"));
+        graph.push_back(plus_one("cycle.b", "cycle.a"));
+        check(mentions(cluster.scheduler->submit_graph(std::move(graph)), "cycle"),
+              "a graph with a cycle is refused");
+        check_nothing_submitted(cluster, orion::ObjectId("cycle.root"));
+    }
+
+    void valid_graph_runs_in_any_order() {
+        Cluster cluster;
+        std::vector<orion::Task> graph;
+        // Consumers first: the graph need not be in dependency order
+        graph.push_back(plus_one("chain.c", "chain.b"));
+        graph.push_back(plus_one("chain.b", "chain.a"));
+        graph.push_back(constant("chain.a", 40));
+        check(!cluster.scheduler->submit_graph(std::move(graph)), "a valid graph is taken");
+        cluster.scheduler->flush();
+        check(cluster.result(orion::ObjectId("chain.c")) == 42, "its last task sees the chain");
+    }
+
+} // namespace
+
+int main() {
+    orion::Worker::set_verbose(false);
+
+    run("submit_graph: duplicate id", duplicate_id_is_refused);
+    run("submit_graph: id already submitted", already_submitted_id_is_refused);
+    run("submit_graph: unknown dep", unknown_dep_is_refused);
+    run("submit_graph: cycle", cycle_is_refused);
+    run("submit_graph: valid graph", valid_graph_runs_in_any_order);
+
+    std::cout << (failures == 0 ? "all checks passed\n" : "checks failed\n");
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,312 @@
+// object_store_test.cpp — ObjectStore / Runtime edge cases: empty wait_any,
+// codec size checks, non-blocking and failed restores of spilled objects
+// and the tasks that read them, throwing coroutine tasks
+//
+// Each check runs with a watchdog: a case that hangs fails instead of
+// blocking the run.
+//
+// Usage:  ./test_object_store   (exit status 0 when every check passes)
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <future>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <typeindex>
+#include <vector>
+
+#include "core/object_codec.h"
+#include "core/object_store.h"
+#include "local/runtime.h"
+
+namespace {
+
+    int failures = 0;
+
+    void check(bool ok, const std::string& what) {
+        std::cout << (ok ? "  ok    " : "  FAIL  ") << what << "\n";
+        if (!ok) ++failures;
+    }
+
+    // Runs `body` on its own thread; a hung case is reported and abandoned
+    void run(const std::string& name, std::function<void()> body) {
+        std::cout << name << "\n";
+        std::packaged_task<void()> task(std::move(body));
+        auto done = task.get_future();
+        std::thread(std::move(task)).detach();
+        if (done.wait_for(std::chrono::seconds(5)) != std::future_status::ready) {
+            check(false, "finished within 5 s");
+            std::cout << std::flush;
+            std::_Exit(1);   // the hung thread still holds the case's state
+        }
+        try {
+            done.get();
+        } catch (const std::exception& e) {
+            check(false, std::string("unexpected exception: ") + e.what());
+        }
+    }
+
+    template <typename Fn>
+    bool throws_invalid_argument(Fn&& fn) {
+        try {
+            fn();
+        } catch (const std::invalid_argument&) {
+            return true;
+        }
+        return false;
+    }
+
+    void wait_any_rejects_empty_input() {
+        orion::ObjectStore store;
+        check(throws_invalid_argument([&] { store.wait_any({}); }),
+              "ObjectStore::wait_any({}) throws invalid_argument");
+
+        orion::Runtime rt(1);
+        check(throws_invalid_argument([&] { rt.wait_any({}); }),
+              "Runtime::wait_any({}) throws invalid_argument");
+    }
+
+    void wait_any_returns_present_index() {
+        orion::ObjectStore store;
+        const auto a = orion::ObjectId::generate();
+        const auto b = orion::ObjectId::generate();
+        std::thread producer([&] {
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+            store.put(b, 1);
+        });
+        check(store.wait_any({a, b}) == 1, "wait_any wakes on a later put");
+        producer.join();
+    }
+
+    // Spills like any payload; restoring it always fails
+    struct Corrupt {
+        int value = 0;
+    };
+
+    std::atomic<int> corrupt_decodes{0};
+
+    void register_corrupt_codec() {
+        static const bool registered = [] {
+            orion::ObjectCodec::Entry codec;
+            codec.name = "test.corrupt";
+            codec.size = [](const std::any&) -> size_t { return sizeof(int); };
+            codec.encode = [](const std::any& v, std::string& out) {
+                const int value = std::any_cast<const Corrupt&>(v).value;
+                out.append(reinterpret_cast<const char*>(&value), sizeof(value));
+            };
+            codec.decode = [](std::string_view) -> std::any {
+                ++corrupt_decodes;
+                throw std::runtime_error("injected decode failure");
+            };
+            return orion::ObjectCodec::register_type(std::type_index(typeid(Corrupt)),
+                                                     std::move(codec));
+        }();
+        (void)registered;
+    }
+
+    // Until `id` is written out as the least recently used object
+    void wait_until_spilled(orion::ObjectStore& store, const orion::ObjectId& id) {
+        while (store.resident(id)) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+
+    void restore_failure_fails_blocked_readers() {
+        register_corrupt_codec();
+
+        orion::SpillConfig spill;
+        spill.memory_budget = 4096;
+        orion::ObjectStore store;
+        store.enable_spilling(spill);
+        const auto id = orion::ObjectId::generate();
+        store.put(id, Corrupt{7});
+        // Newer, larger puts push it out as the least recently used
+        for (int i = 0; i < 8; ++i) {
+            store.put(orion::ObjectId::generate(), std::string(1024, 'x'));
+        }
+        wait_until_spilled(store, id);
+
+        // Both park on the restore the first one queues
+        auto read = [&] {
+            try {
+                store.get_handle_blocking(id);
+            } catch (const std::runtime_error&) {
+                return true;
+            }
+            return false;
+        };
+        auto first = std::async(std::launch::async, read);
+        auto second = std::async(std::launch::async, read);
+        check(first.get() && second.get(), "blocked readers get the decode error");
+        check(read(), "a later reader gets it without waiting");
+
+        store.put(id, Corrupt{8});
+        check(std::any_cast<Corrupt>(store.get_blocking(id)).value == 8,
+              "a new put replaces the unreadable object");
+    }
+
+    // get_handle misses on a spilled object instead of waiting for it;
+    // when_restored brings it back (or fails it) and then runs its callback
+    void restore_on_demand_without_blocking() {
+        register_corrupt_codec();
+
+        orion::SpillConfig spill;
+        spill.memory_budget = 4096;
+        orion::ObjectStore store;
+        store.enable_spilling(spill);
+        const auto text = orion::ObjectId::generate();
+        const auto corrupt = orion::ObjectId::generate();
+        store.put(text, std::string(512, 't'));
+        store.put(corrupt, Corrupt{7});
+        for (int i = 0; i < 8; ++i) {
+            store.put(orion::ObjectId::generate(), std::string(1024, 'x'));
+        }
+        wait_until_spilled(store, text);
+        wait_until_spilled(store, corrupt);
+
+        check(!store.get_handle(text), "get_handle misses while spilled");
+        check(!store.when_restored(orion::ObjectId::generate(), [] {}),
+              "when_restored does not wait for an absent object");
+
+        std::promise<void> restored;
+        check(store.when_restored(text, [&] { restored.set_value(); }),
+              "when_restored keeps the callback of a spilled object");
+        restored.get_future().wait();
+        const orion::ObjectHandle handle = store.get_handle(text);
+        check(handle && std::any_cast<const std::string&>(*handle) == std::string(512, 't'),
+              "the callback finds it resident");
+        check(!store.when_restored(text, [] {}), "a resident object needs no restore");
+
+        std::promise<void> failed;
+        check(store.when_restored(corrupt, [&] { failed.set_value(); }),
+              "when_restored queues the restore of an unreadable object");
+        failed.get_future().wait();
+        bool threw = false;
+        try {
+            store.get_handle(corrupt);
+        } catch (const std::runtime_error&) {
+            threw = true;
+        }
+        check(threw, "get_handle then rethrows its decode error");
+        check(!store.when_restored(corrupt, [] {}), "a failed object is not restored again");
+    }
+
+    // What a receiver relies on to reject a bad announced size instead of
+    // reading past or truncating the bytes
+    void codec_rejects_sizes_no_payload_has() {
+        const auto* scalar = orion::ObjectCodec::find(typeid(int));
+        const auto* vec = orion::ObjectCodec::find(typeid(std::vector<int>));
+        std::any value;
+        check(scalar->prepare(value, 3) == nullptr, "a scalar prepares only its own size");
+        check(vec->prepare(value, 6) == nullptr, "a vector prepares only whole elements");
+        check(vec->prepare(value, 0) != nullptr, "an empty vector is a valid size");
+
+        auto decode_throws = [](const orion::ObjectCodec::Entry* codec, size_t bytes) {
+            const std::string data(bytes, '\0');
+            try {
+                codec->decode(data);
+            } catch (const std::invalid_argument&) {
+                return true;
+            }
+            return false;
+        };
+        check(decode_throws(scalar, 3) && decode_throws(vec, 6),
+              "decode throws on those sizes too");
+    }
+
+    // A task whose input cannot be restored fails once, and its worker runs
+    // the next task
+    void restore_failure_fails_dependent_task(orion::ExecutionMode mode) {
+        register_corrupt_codec();
+
+        orion::RuntimeOptions options;
+        options.mode = mode;
+        options.spill.memory_budget = 4096;
+        orion::Runtime rt(1, options);
+
+        auto a = rt.submit(orion::Task{orion::ObjectId::generate(), {},
+                                       [] { return std::any(Corrupt{7}); }});
+        rt.wait(a);
+        for (int i = 0; i < 8; ++i) {
+            rt.wait(rt.submit(orion::Task{orion::ObjectId::generate(), {},
+                                          [] { return std::any(std::string(1024, 'x')); }}));
+        }
+        wait_until_spilled(rt.store(), a.id);
+
+        corrupt_decodes = 0;
+        auto b = rt.submit(orion::Task{orion::ObjectId::generate(), {a},
+                                       [](std::vector<std::any>) { return std::any(1); }});
+        bool failed = false;
+        try {
+            rt.get(b);
+        } catch (const std::runtime_error&) {
+            failed = true;
+        }
+        check(failed, "the dependent's output carries the decode error");
+
+        auto c = rt.submit(orion::Task{orion::ObjectId::generate(), {},
+                                       [] { return std::any(3); }});
+        check(std::any_cast<int>(rt.get(c)) == 3, "the worker runs the next task");
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        check(corrupt_decodes.load() == 1, "the restore is tried once, not retried in a loop");
+    }
+
+    orion::CoTask throw_after(orion::ObjectRef in) {
+        co_await in;
+        throw std::runtime_error("coroutine failed");
+    }
+
+    orion::CoTask add_one(orion::ObjectRef in) {
+        co_return orion::object_cast<int>(co_await in) + 1;
+    }
+
+    // The exception fails the coroutine's output, then its dependents'
+    void throwing_coroutine_fails_its_output() {
+        orion::Runtime rt(1);
+        const auto input = orion::ObjectId::generate();
+        auto a = rt.submit(orion::ObjectId::generate(), throw_after(orion::ObjectRef{input}));
+        auto b = rt.submit(orion::ObjectId::generate(), add_one(a));
+        rt.store().put(input, 1);   // resumes `a`, which throws
+
+        auto fails = [&](const orion::ObjectRef& ref) {
+            try {
+                rt.get(ref);
+            } catch (const std::runtime_error&) {
+                return true;
+            }
+            return false;
+        };
+        check(fails(a), "its output carries the exception");
+        check(fails(b), "a coroutine awaiting it fails too");
+
+        auto c = rt.submit(orion::Task{orion::ObjectId::generate(), {},
+                                       [] { return std::any(3); }});
+        check(std::any_cast<int>(rt.get(c)) == 3, "the worker runs the next task");
+    }
+
+} // namespace
+
+int main() {
+    orion::Worker::set_verbose(false);
+
+    run("wait_any: empty input", wait_any_rejects_empty_input);
+    run("wait_any: index of the object put", wait_any_returns_present_index);
+    run("codec: sizes no payload has", codec_rejects_sizes_no_payload_has);
+    run("restore: decode failure", restore_failure_fails_blocked_readers);
+    run("restore: on demand, without blocking", restore_on_demand_without_blocking);
+    run("restore: decode failure under a task (round robin)", [] {
+        restore_failure_fails_dependent_task(orion::ExecutionMode::RoundRobin);
+    });
+    run("restore: decode failure under a task (work stealing)", [] {
+        restore_failure_fails_dependent_task(orion::ExecutionMode::WorkStealing);
+    });
+    run("coroutine: exception", throwing_coroutine_fails_its_output);
+
+    std::cout << (failures == 0 ? "all checks passed\n" : "checks failed\n");
+    return failures == 0 ? 0 : 1;
+}